@@ -0,0 +1,81 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Sanguosha {
+namespace Common {
+
+// 按大小分级的缓冲区池，所有会话共享。
+// 接收消息体时按帧长取一块，处理完立即归还，空闲连接不占用消息体缓冲区；
+// 每一级缓存的总字节数有上限，超出部分直接释放，池子本身的内存也是有界的。
+class BufferPool {
+public:
+    // 分级：256B、1KB、4KB、16KB、64KB、256KB、1MB，更大的请求不走池
+    static constexpr size_t MIN_CLASS_SIZE = 256;
+    static constexpr size_t CLASS_COUNT = 7;
+    static constexpr size_t DEFAULT_MAX_CACHED_BYTES_PER_CLASS = 4 * 1024 * 1024;
+
+    // 独占的一块缓冲区，析构时自动归还
+    class Buffer {
+    public:
+        Buffer() = default;
+        ~Buffer() { reset(); }
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+        Buffer(const Buffer&) = delete;
+        Buffer& operator=(const Buffer&) = delete;
+
+        char* data() { return data_; }
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }         // 申请的长度
+        size_t capacity() const { return capacity_; } // 实际分配的长度
+        bool empty() const { return size_ == 0; }
+        char& operator[](size_t i) { return data_[i]; }
+        char operator[](size_t i) const { return data_[i]; }
+
+        // 归还给池子
+        void reset();
+
+    private:
+        friend class BufferPool;
+        BufferPool* pool_ = nullptr;
+        char* data_ = nullptr;
+        size_t size_ = 0;
+        size_t capacity_ = 0;
+    };
+
+    explicit BufferPool(size_t maxCachedBytesPerClass = DEFAULT_MAX_CACHED_BYTES_PER_CLASS);
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // 取一块至少size字节的缓冲区；size为0时返回空缓冲区
+    Buffer acquire(size_t size);
+
+    size_t cachedBytes() const;
+    uint64_t hits() const { return hits_.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+private:
+    struct SizeClass {
+        size_t size = 0;
+        size_t maxCached = 0;
+        std::vector<char*> free;
+        mutable std::mutex mutex;
+    };
+
+    static int classFor(size_t size);
+    void release(char* data, size_t capacity);
+
+    std::array<SizeClass, CLASS_COUNT> classes_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace Common
+} // namespace Sanguosha
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Sanguosha {
+namespace Common {
+
+// 机器的CPU/NUMA拓扑，从/sys/devices/system/node读取；读不到时视为单节点。
+// 只用于决定线程绑核和启动时打印，不依赖libnuma：线程先绑到某个核上，
+// 之后它首次写入的内存页由内核分配在该核所在的节点上（first-touch），各线程的池子自然是本地内存
+class CpuTopology {
+public:
+    static CpuTopology detect();
+
+    // cpu所在的NUMA节点，未知时返回0
+    int nodeOf(int cpu) const;
+    size_t nodeCount() const { return nodes_.empty() ? 1 : nodes_.size(); }
+    // 当前进程允许使用的CPU
+    const std::vector<int>& allowedCpus() const { return allowedCpus_; }
+    bool isAllowed(int cpu) const;
+
+    // 例如 "2 NUMA nodes: node0=0-7,16-23 node1=8-15,24-31; 32 cpus allowed"
+    std::string describe() const;
+
+private:
+    std::vector<std::vector<int>> nodes_; // 下标为节点号
+    std::vector<int> allowedCpus_;
+};
+
+// 解析内核cpulist格式（"0-3,8,10-11"），格式错误抛出std::invalid_argument
+std::vector<int> parseCpuList(const std::string& text);
+// 反向格式化，连续的编号合并成区间
+std::string formatCpuList(const std::vector<int>& cpus);
+
+// 把当前线程/指定线程绑到一个CPU上，失败时抛出std::system_error
+void pinCurrentThread(int cpu);
+void pinThread(std::thread& thread, int cpu);
+
+} // namespace Common
+} // namespace Sanguosha
@@ -0,0 +1,43 @@
+#pragma once
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <mutex>
+#include <utility>
+
+namespace Sanguosha {
+namespace Common {
+
+// 其他线程（如机器人搜索线程）向io线程投递回调的入口。
+// 持有者在io_context销毁前调用close()，之后的投递直接丢弃；
+// 回调里持有IoGate的shared_ptr，就不会投递到已经销毁的io_context上
+class IoGate {
+public:
+    explicit IoGate(boost::asio::io_context& io) : io_(&io) {}
+
+    IoGate(const IoGate&) = delete;
+    IoGate& operator=(const IoGate&) = delete;
+
+    // 已关闭时返回false，handler被丢弃
+    template <typename Handler>
+    bool post(Handler&& handler) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (io_ == nullptr) {
+            return false;
+        }
+        boost::asio::post(*io_, std::forward<Handler>(handler));
+        return true;
+    }
+
+    // 返回后不会再有新的投递进入io_context
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        io_ = nullptr;
+    }
+
+private:
+    std::mutex mutex_;
+    boost::asio::io_context* io_;
+};
+
+} // namespace Common
+} // namespace Sanguosha
@@ -0,0 +1,65 @@
+#pragma once
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Sanguosha {
+namespace Common {
+
+// 共享的哈希时间轮：整个服务器只持有一个steady_timer，
+// 所有响应窗口、回合倒计时等截止时间都挂在轮上，调度和取消都是O(1)。
+class TimerWheel {
+public:
+    using TimerId = uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr TimerId INVALID_TIMER = 0;
+
+    explicit TimerWheel(boost::asio::io_context& io,
+                        std::chrono::milliseconds tick = std::chrono::milliseconds(100),
+                        size_t slotCount = 512);
+    ~TimerWheel();
+
+    // 在delay之后执行回调（回调在io_context线程上执行）；可从任意线程调用
+    TimerId schedule(std::chrono::milliseconds delay, Callback callback);
+
+    // 取消尚未触发的定时器，返回是否成功取消
+    bool cancel(TimerId id);
+
+    // 停止时间轮，丢弃所有未触发的定时器
+    void stop();
+
+    size_t pending() const;
+    std::chrono::milliseconds tickInterval() const { return tick_; }
+
+private:
+    struct Entry {
+        uint64_t expireTick;
+        Callback callback;
+    };
+
+    uint64_t ticksSinceOrigin(std::chrono::steady_clock::time_point now) const;
+    void arm();
+    void onTick(const boost::system::error_code& ec);
+
+    boost::asio::io_context& io_;
+    boost::asio::steady_timer timer_;
+    const std::chrono::milliseconds tick_;
+    const std::chrono::steady_clock::time_point origin_;
+
+    std::vector<std::vector<TimerId>> slots_;
+    std::unordered_map<TimerId, Entry> entries_; // 已取消的定时器只从这里删除，槽位中惰性清理
+    uint64_t currentTick_ = 0;
+    TimerId nextId_ = 1;
+    bool armed_ = false;
+    bool stopped_ = false;
+    mutable std::mutex mutex_;
+};
+
+} // namespace Common
+} // namespace Sanguosha
@@ -0,0 +1,34 @@
+#pragma once
+#include <chrono>
+
+namespace Sanguosha {
+namespace Common {
+
+// 令牌桶限流：按固定速率补充令牌，最多攒到burst个。
+// 不加锁，由调用方保证串行访问（会话内部、或外层已持锁）。
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    // ratePerSecond <= 0 表示不限流
+    TokenBucket(double ratePerSecond, double burst);
+
+    bool tryAcquire(double tokens = 1.0, Clock::time_point now = Clock::now());
+
+    // 还需要等待多久才能攒够tokens个令牌（已足够时返回0）
+    std::chrono::milliseconds timeUntilAvailable(double tokens = 1.0, Clock::time_point now = Clock::now());
+
+    bool unlimited() const { return rate_ <= 0; }
+    double rate() const { return rate_; }
+
+private:
+    void refill(Clock::time_point now);
+
+    double rate_;
+    double burst_;
+    double tokens_;
+    Clock::time_point last_;
+};
+
+} // namespace Common
+} // namespace Sanguosha
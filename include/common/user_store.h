@@ -0,0 +1,78 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace Sanguosha {
+namespace Common {
+
+// 用户存储：用户名 -> 用户ID 的持久化哈希表。
+// 数据文件整体mmap到内存，开放寻址（线性探测），负载超过70%时写新文件翻倍扩容；
+// 前面有一层分片的内存缓存，热点用户重复登录不需要获取表锁。
+// ID由文件头里的计数器分配，只增不减，重启后也不会重复。
+class UserStore {
+public:
+    using UserId = uint64_t;
+
+    static constexpr UserId INVALID_USER = 0;
+    static constexpr UserId FIRST_USER_ID = 1000;
+    static constexpr size_t MAX_USERNAME_LENGTH = 51;
+
+    // 打开或创建数据文件，失败时抛出std::system_error
+    explicit UserStore(const std::string& path, uint32_t initialCapacity = 1u << 16);
+    ~UserStore();
+
+    UserStore(const UserStore&) = delete;
+    UserStore& operator=(const UserStore&) = delete;
+
+    // 查找用户名对应的ID，不存在时注册新用户；用户名为空或过长返回INVALID_USER
+    UserId findOrCreate(const std::string& username);
+    // 只查找，不存在返回INVALID_USER
+    UserId find(const std::string& username);
+    // 分配一个不关联用户名的ID（如游客），与注册用户共用同一个计数器
+    UserId allocateId();
+
+    uint64_t size() const;
+    uint32_t capacity() const;
+    // 把脏页刷到磁盘
+    void flush();
+
+private:
+    struct Header;
+    struct Slot;
+
+    static constexpr size_t CACHE_SHARDS = 16;
+    static constexpr size_t MAX_CACHE_ENTRIES_PER_SHARD = 1u << 16;
+
+    struct CacheShard {
+        std::mutex mutex;
+        std::unordered_map<std::string, UserId> entries;
+    };
+
+    static size_t fileBytes(uint32_t capacity);
+    void mapFile(int fd, size_t bytes);
+    void unmapFile();
+    Slot* slots() const;
+    const Slot* lookup(const std::string& username, uint64_t hash) const;
+    void insert(const std::string& username, uint64_t hash, UserId id);
+    void grow();
+
+    CacheShard& shardFor(uint64_t hash) { return cache_[hash % CACHE_SHARDS]; }
+    UserId cacheGet(const std::string& username, uint64_t hash);
+    void cachePut(const std::string& username, uint64_t hash, UserId id);
+
+    std::string path_;
+    int fd_ = -1;
+    void* base_ = nullptr;
+    size_t mappedBytes_ = 0;
+    Header* header_ = nullptr;
+    mutable std::shared_mutex tableMutex_; // 读共享，插入和扩容独占
+
+    std::array<CacheShard, CACHE_SHARDS> cache_;
+};
+
+} // namespace Common
+} // namespace Sanguosha
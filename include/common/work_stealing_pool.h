@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Sanguosha {
+namespace Common {
+
+// 工作窃取线程池：每个工作线程有自己的双端队列，
+// 本线程从队尾取任务，空闲时从其他线程的队首窃取，用于CPU密集的后台计算
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+    explicit WorkStealingPool(size_t threadCount);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // 提交任务；从池内线程提交时放入本线程队列，否则轮询分配
+    void submit(Task task);
+
+    size_t size() const { return threads_.size(); }
+    // 第i个工作线程绑到cpus[i % cpus.size()]，失败时抛出std::system_error
+    void pinThreads(const std::vector<int>& cpus);
+
+private:
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void workerLoop(size_t index);
+    bool popLocal(size_t index, Task& task);
+    bool steal(size_t index, Task& task);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> threads_;
+    std::mutex sleepMutex_;
+    std::condition_variable wakeup_;
+    std::atomic<size_t> pending_{0};
+    std::atomic<size_t> nextQueue_{0};
+    std::atomic<bool> stopping_{false};
+};
+
+} // namespace Common
+} // namespace Sanguosha
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <vector>
-#include <unordered_map>
+#include <array>
+#include <bitset>
 #include <random>
+#include <memory>
+#include <chrono>
 #include "sanguosha.pb.h"
+#include "common/timer_wheel.h"
+#include "game/game_simulator.h"
 
 // 前向声明，避免包含player.h
 namespace sanguosha {
@@ -26,12 +31,17 @@ class Server;
 
 namespace sanguosha {
 
-class GameInstance {
+class GameInstance : public std::enable_shared_from_this<GameInstance> {
 public:
+    // 回合和响应窗口的时限见ServerConfig；连续超时达到该次数视为挂机，判负
+    static constexpr uint32_t MAX_CONSECUTIVE_TIMEOUTS = 3;
+    // 座位数上限（身份局最多8人）
+    static constexpr size_t MAX_SEATS = 8;
+
     // 修改构造函数，使用正确的前向声明
     explicit GameInstance(uint32_t roomId, Sanguosha::Room::RoomManager& roomManager, Sanguosha::Network::Server& server);
 
-    // 开始1v1游戏
+    // 开始游戏：2人为1v1，3~8人为身份局；playerIds的顺序即座位顺序
     void startGame(const std::vector<uint32_t>& playerIds);
 
     // 处理玩家操作
@@ -42,29 +52,136 @@ public:
 
     bool isGameOver() const;
     uint32_t getWinner() const;
+    const std::vector<uint32_t>& getWinners() const { return winners_; }
+
+    // 是否正在等待某个玩家响应
+    bool isAwaitingResponse() const { return pending_.active; }
+
+    // 断线重连后补发只属于该玩家的私有信息（身份、未完成的响应提示）
+    void onPlayerReconnected(uint32_t playerId);
+    // 重连宽限期已过仍未回来，判负
+    void forfeitPlayer(uint32_t playerId);
+
+    // 崩溃恢复（见room/room_journal.h）。快照记下随机数的种子和已取的个数，不改动随机数本身，
+    // 恢复后回放其后的日志时洗牌结果与原来一致
+    void saveSnapshot(GameSnapshot* snapshot) const;
+    void restoreSnapshot(const GameSnapshot& snapshot);
+    // 回放日志中的一条游戏事件；回放期间不写日志、不调度机器人
+    void replay(const RoomJournalRecord& record);
+    // 恢复完成：重新开始计时，广播一次完整状态作为重连的关键帧，轮到机器人时继续
+    void resumeAfterRestore();
+
+    // 休眠（见RoomManager）：只有正在等一个已断线的真人玩家时才可以休眠，
+    // 这时只有计时器、重连和判负能推进对局。休眠前取出两个截止时间，唤醒后按剩余时间重新计时
+    bool awaitingDisconnectedPlayer() const;
+    std::chrono::steady_clock::time_point turnDeadline() const { return turnDeadline_; }
+    std::chrono::steady_clock::time_point responseDeadline() const { return pending_.deadline; }
+    void resumeTimers(std::chrono::steady_clock::time_point turnDeadline,
+                      std::chrono::steady_clock::time_point responseDeadline);
 
 private:
     // 添加缺失的方法声明
     void initDeck();
+    void assignRoles();
+    void sendRole(uint32_t seat);
     void dealInitialCards();
-    void processTurn(uint32_t playerId);
-    void resolveAttack(uint32_t attacker, uint32_t target);
+    bool drawCard(uint32_t& card);
+    void processTurn(uint32_t seat);
+    void resolveAttack(uint32_t attackerSeat, uint32_t targetSeat);
+    void applyAttackResult(uint32_t targetSeat, bool dodged);
+    void openResponseWindow(uint32_t sourceSeat, uint32_t targetSeat, CardType cardType);
+    void closeResponseWindow(bool responded);
+    void onResponseTimeout(uint32_t promptId);
+    void sendResponsePrompt();
+    bool removeHandCard(PlayerState& state, uint32_t card);
+    bool hasHandCard(const PlayerState& state, uint32_t card) const;
+    void fillPlayerStates(GameState* gameState, int viewerSeat = -1) const;
     void broadcastGameState(const sanguosha::GameState& gameState);
-    uint32_t getNextPlayer();
+    void endTurn(uint32_t seat, const std::string& log);
+    void scheduleTurnTimer();
+    std::chrono::milliseconds turnTimeout() const;
+    std::chrono::milliseconds responseTimeout() const;
+    void armTurnTimer(std::chrono::milliseconds delay);
+    void armResponseTimer(std::chrono::milliseconds delay);
+    void onTurnTimeout(uint64_t turnSeq);
+    void autoDiscard(uint32_t seat);
+    void killSeat(uint32_t seat);
+    void forfeitSeat(uint32_t seat, const std::string& log);
+    int findSeat(uint32_t playerId) const;
+    uint32_t nextAliveSeat(uint32_t seat) const;
+    uint32_t currentPlayerId() const { return seats_[currentSeat_].player_id(); }
     bool checkGameOver();
     void handleGameOver();
+    // 把状态变化之前的输入写进操作日志
+    void journal(RoomJournalRecord::Kind kind, uint32_t playerId, uint64_t sequence,
+                 const GameAction* action = nullptr);
+
+    // 机器人座位：状态变化后若轮到机器人决策，则提交到后台搜索
+    GameSimulator snapshotForBot() const;
+    void maybeScheduleBot();
+    void onBotDecision(uint64_t version, uint32_t botId, const SimAction& action);
 
     // 添加必要的成员变量
     std::vector<uint32_t> deck_;
-    std::mt19937 rng_;
+    std::vector<uint32_t> discardPile_; // 牌堆摸完后洗回牌堆
+    // 洗牌用的随机数：mt19937的完整状态有2.5KB，只记种子和已取的个数，恢复时重新播种再跳过同样多个
+    struct DeckRng {
+        using result_type = std::mt19937::result_type;
+        static constexpr result_type min() { return std::mt19937::min(); }
+        static constexpr result_type max() { return std::mt19937::max(); }
+        result_type operator()() {
+            ++draws;
+            return engine();
+        }
+        void seed(uint32_t value, uint64_t skip = 0) {
+            seedValue = value;
+            engine.seed(value);
+            engine.discard(skip);
+            draws = skip;
+        }
+        std::mt19937 engine;
+        uint32_t seedValue = 0;
+        uint64_t draws = 0;
+    };
+    DeckRng rng_;
 
     uint32_t roomId_;
     Sanguosha::Room::RoomManager& roomManager_; // 添加RoomManager引用
     Sanguosha::Network::Server& server_; // 使用正确的前向声明
-    std::unordered_map<uint32_t, PlayerState> playerStates_;
-    uint32_t currentPlayer_;
+    // 座位数组：下标即座位号，alive掩码用于O(1)查找下一个存活座位
+    std::vector<PlayerState> seats_;
+    std::array<Role, MAX_SEATS> roles_{};
+    std::bitset<MAX_SEATS> aliveMask_;
+    uint32_t currentSeat_;
     bool gameOver_;
     uint32_t winnerId_;
+    std::vector<uint32_t> winners_;
+    Role winnerRole_ = ROLE_NONE;
+
+    // 挂起的响应窗口：同一时刻一局游戏最多等待一个响应
+    struct PendingResponse {
+        bool active = false;
+        uint32_t promptId = 0;
+        uint32_t sourceSeat = 0;
+        uint32_t targetSeat = 0;
+        CardType cardType = CARD_UNKNOWN;
+        Sanguosha::Common::TimerWheel::TimerId timer = Sanguosha::Common::TimerWheel::INVALID_TIMER;
+        std::chrono::steady_clock::time_point deadline; // 重连补发提示时计算剩余时间
+    };
+    PendingResponse pending_;
+    uint32_t nextPromptId_ = 1;
+
+    // 回合截止时间
+    Sanguosha::Common::TimerWheel::TimerId turnTimer_ = Sanguosha::Common::TimerWheel::INVALID_TIMER;
+    uint64_t turnSeq_ = 0;
+    std::chrono::steady_clock::time_point turnDeadline_;
+    std::array<uint32_t, MAX_SEATS> consecutiveTimeouts_{};
+
+    // 每次状态变化递增，用于丢弃过期的机器人决策
+    uint64_t stateVersion_ = 0;
+
+    // 正在回放操作日志
+    bool replaying_ = false;
 };
 
 } // namespace sanguosha
\ No newline at end of file
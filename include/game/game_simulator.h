@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "sanguosha.pb.h"
+
+namespace sanguosha {
+
+// 模拟器中的一步操作；targetSeat只对杀有意义
+struct SimAction {
+    ActionType type = ACTION_END_TURN;
+    CardType card = CARD_UNKNOWN;
+    uint8_t targetSeat = 0;
+
+    bool operator==(const SimAction& other) const {
+        return type == other.type && card == other.card && targetSeat == other.targetSeat;
+    }
+};
+
+// 无网络、无广播的规则模型，与GameInstance的结算规则保持一致。
+// 状态是紧凑的值类型，可以廉价复制，供机器人搜索时大量推演。
+class GameSimulator {
+public:
+    static constexpr size_t MAX_SEATS = 8;
+
+    struct Seat {
+        uint32_t playerId = 0;
+        uint8_t hp = 0;
+        uint8_t maxHp = 0;
+        Role role = ROLE_NONE;
+        std::array<uint8_t, 4> cards{}; // 按CardType计数的手牌
+
+        uint32_t handSize() const { return cards[CARD_ATTACK] + cards[CARD_DEFEND] + cards[CARD_HEAL]; }
+    };
+
+    GameSimulator() = default;
+
+    // 由GameInstance填充状态
+    std::vector<Seat>& seats() { return seats_; }
+    const std::vector<Seat>& seats() const { return seats_; }
+    std::vector<uint8_t>& deck() { return deck_; }
+    std::vector<uint8_t>& discardPile() { return discardPile_; }
+    std::bitset<MAX_SEATS>& alive() { return alive_; }
+    void setCurrentSeat(uint32_t seat) { currentSeat_ = seat; }
+    void setPendingResponse(uint32_t sourceSeat, uint32_t targetSeat);
+
+    // 当前需要做决定的座位（响应窗口期间为被提示者）
+    uint32_t actingSeat() const { return pendingActive_ ? pendingTarget_ : currentSeat_; }
+    std::vector<SimAction> legalActions() const;
+    void apply(const SimAction& action);
+
+    bool isTerminal() const { return terminal_; }
+    // 座位seat在当前局面下的收益，终局为胜1负0，未结束时按体力估值
+    double reward(uint32_t seat) const;
+
+    // 信息集采样：保留viewerSeat自己的手牌，把其他人的手牌与牌堆重新洗匀
+    void determinize(uint32_t viewerSeat, std::mt19937& rng);
+
+private:
+    void damage(uint32_t seat);
+    void drawCards(uint32_t seat, int count);
+    void nextTurn();
+    void updateTerminal();
+    bool isWinner(uint32_t seat) const;
+
+    std::vector<Seat> seats_;
+    std::vector<uint8_t> deck_;
+    std::vector<uint8_t> discardPile_;
+    std::bitset<MAX_SEATS> alive_;
+    uint32_t currentSeat_ = 0;
+    bool pendingActive_ = false;
+    uint32_t pendingSource_ = 0;
+    uint32_t pendingTarget_ = 0;
+    bool terminal_ = false;
+    Role winnerRole_ = ROLE_NONE;
+};
+
+} // namespace sanguosha
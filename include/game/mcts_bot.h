@@ -0,0 +1,111 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+#include "game/game_simulator.h"
+
+namespace Sanguosha {
+namespace Common {
+class WorkStealingPool;
+}
+}
+
+namespace sanguosha {
+
+// 机器人玩家ID段，与真实玩家ID不重叠
+constexpr uint32_t BOT_ID_BASE = 0x80000000u;
+inline bool isBotPlayer(uint32_t playerId) { return playerId >= BOT_ID_BASE; }
+
+// 单棵树的蒙特卡洛树搜索（UCT），在一次信息集采样上运行到截止时间
+class MctsBot {
+public:
+    struct ActionStats {
+        SimAction action;
+        uint32_t visits = 0;
+        double reward = 0;
+    };
+
+    // 返回根节点每个候选操作的访问次数与累计收益
+    static std::vector<ActionStats> search(const GameSimulator& root, uint32_t seat,
+                                           std::chrono::steady_clock::time_point deadline,
+                                           uint32_t seed);
+
+    // 合并多次搜索的根节点统计，选访问次数最多的操作
+    static SimAction pickBest(const std::vector<std::vector<ActionStats>>& results);
+};
+
+// 可以分段运行的单棵搜索树：每段跑固定次数的迭代后让出线程，下一段可以在另一个线程上接着跑
+class MctsSearch {
+public:
+    MctsSearch(const GameSimulator& root, uint32_t seat, uint32_t seed);
+
+    // 再跑最多iterations次迭代，到deadline提前停止（整棵树至少完成一次迭代）；返回是否已到截止时间
+    bool run(uint32_t iterations, std::chrono::steady_clock::time_point deadline);
+    std::vector<MctsBot::ActionStats> rootStats() const;
+
+private:
+    struct Node {
+        SimAction action;
+        int parent = -1;
+        uint32_t actor = 0; // 做出action的座位，收益按它的视角累计
+        std::vector<int> children;
+        std::vector<SimAction> untried;
+        uint32_t visits = 0;
+        double reward = 0;
+    };
+
+    void iterate();
+
+    std::mt19937 rng_;
+    GameSimulator base_;
+    std::vector<Node> nodes_;
+    uint32_t iterations_ = 0;
+};
+
+// 机器人决策服务：在独立的工作窃取线程池上并行搜索（根并行，每个工作线程一棵树），
+// 结果通过回调返回，调用方负责把回调投递回自己的io线程。
+// 每棵树按SLICE_ITERATIONS分段提交，多个机器人同时思考时，空闲线程可以偷走忙碌线程队列里的分段
+class BotPlanner {
+public:
+    // 每步思考时间
+    static constexpr std::chrono::milliseconds MOVE_BUDGET{300};
+    // 每个任务跑的迭代次数，一段通常在几毫秒内
+    static constexpr uint32_t SLICE_ITERATIONS = 64;
+
+    static BotPlanner& Instance();
+
+    void requestMove(const GameSimulator& state, uint32_t seat,
+                     std::function<void(SimAction)> onDecision);
+    // 丢弃还没开始的搜索，并等正在进行的搜索结束（最多MOVE_BUDGET）；
+    // 返回后之前提交的请求不会再调用回调。停机时调用
+    void cancelAll();
+
+    // 按配置设置搜索线程数并绑核（见WorkStealingPool::pinThreads）。threads为0时，
+    // 指定了cpus则每个cpu一个线程，否则用一半核心。线程数变化时先cancelAll再重建线程池，
+    // 所以只在启动时、还没有搜索请求的时候调用
+    void configureWorkers(size_t threads, const std::vector<int>& cpus);
+    size_t workerCount() const;
+
+private:
+    struct Job;
+
+    BotPlanner();
+    ~BotPlanner();
+
+    void submitSlice(std::shared_ptr<Job> job, std::shared_ptr<MctsSearch> search, uint64_t epoch);
+
+    // 每次cancelAll递增，提交时记下的值不同就说明已被取消。声明在pool_之前，工作线程退出后才析构
+    std::mutex idleMutex_;
+    std::condition_variable idle_;
+    uint64_t epoch_ = 0;
+    size_t running_ = 0;
+    std::unique_ptr<Sanguosha::Common::WorkStealingPool> pool_;
+};
+
+} // namespace sanguosha
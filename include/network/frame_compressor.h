@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+namespace Sanguosha {
+namespace Network {
+
+// 按连接的流式压缩（登录时协商CAPABILITY_COMPRESS后启用）。
+// 同一连接上的压缩帧共用一个deflate上下文，后面的帧可以引用前面帧里出现过的内容，
+// 初始历史是双方内置的共享字典，所以第一帧就有不错的压缩率。
+// 压缩帧的消息体为 COMPRESSED标记 + raw deflate数据（去掉同步刷新末尾的00 00 FF FF），
+// 接收方必须按顺序解压所有压缩帧
+class FrameCompressor {
+public:
+    explicit FrameCompressor(int level = Z_DEFAULT_COMPRESSION);
+    ~FrameCompressor();
+
+    FrameCompressor(const FrameCompressor&) = delete;
+    FrameCompressor& operator=(const FrameCompressor&) = delete;
+
+    // 压缩一个完整帧（含长度头），返回带COMPRESSED标记的新帧
+    std::vector<char> compress(const std::vector<char>& frame);
+
+    // 共享字典：由典型消息的编码拼成，客户端与服务器必须一致
+    static const std::string& dictionary();
+    // 字典的adler32，登录响应中下发，客户端据此确认字典版本
+    static uint32_t dictionaryId();
+
+private:
+    z_stream stream_{};
+};
+
+// 解压一侧（客户端和测试使用）
+class FrameDecompressor {
+public:
+    FrameDecompressor();
+    ~FrameDecompressor();
+
+    FrameDecompressor(const FrameDecompressor&) = delete;
+    FrameDecompressor& operator=(const FrameDecompressor&) = delete;
+
+    // 解压一个压缩帧的消息体（含COMPRESSED标记），得到原始的GameMessage编码
+    bool decompress(const char* body, size_t size, std::string& out);
+
+private:
+    z_stream stream_{};
+};
+
+} // namespace Network
+} // namespace Sanguosha
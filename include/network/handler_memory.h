@@ -0,0 +1,102 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Sanguosha {
+namespace Network {
+
+// 异步操作的处理函数内存。
+// Asio每发起一次异步操作都要为操作对象（内含处理函数）分配内存，操作完成、调用处理函数之前释放。
+// 同一类操作（读等待、写、心跳定时器）在一个会话上同时最多只有一个，
+// 所以每类给一块固定的内存反复使用即可，稳态下的I/O不再走堆分配。
+// 只在所属会话的io线程上使用，不加锁。
+class HandlerMemory {
+public:
+    static constexpr size_t STORAGE_SIZE = 512; // 写操作（组合的async_write）约480字节
+
+    HandlerMemory() = default;
+    HandlerMemory(const HandlerMemory&) = delete;
+    HandlerMemory& operator=(const HandlerMemory&) = delete;
+
+    void* allocate(size_t size) {
+        if (!inUse_ && size <= sizeof(storage_)) {
+            inUse_ = true;
+            return &storage_;
+        }
+        // 操作对象比预留的大，或者同时有两个操作：退回堆分配，结果不变只是慢一些
+        ++fallbackAllocations_;
+        return ::operator new(size);
+    }
+
+    void deallocate(void* pointer) {
+        if (pointer == &storage_) {
+            inUse_ = false;
+        } else {
+            ::operator delete(pointer);
+        }
+    }
+
+    // 退回堆分配的次数，稳态下应为0
+    uint64_t fallbackAllocations() const { return fallbackAllocations_; }
+
+private:
+    std::aligned_storage_t<STORAGE_SIZE, alignof(std::max_align_t)> storage_;
+    bool inUse_ = false;
+    uint64_t fallbackAllocations_ = 0;
+};
+
+// 满足Allocator要求的轻量包装，Asio通过associated_allocator取到它
+template <typename T>
+class HandlerAllocator {
+public:
+    using value_type = T;
+
+    explicit HandlerAllocator(HandlerMemory& memory) : memory_(&memory) {}
+
+    template <typename U>
+    HandlerAllocator(const HandlerAllocator<U>& other) noexcept : memory_(other.memory_) {}
+
+    T* allocate(size_t n) const { return static_cast<T*>(memory_->allocate(sizeof(T) * n)); }
+    void deallocate(T* pointer, size_t) const { memory_->deallocate(pointer); }
+
+    template <typename U>
+    bool operator==(const HandlerAllocator<U>& other) const noexcept { return memory_ == other.memory_; }
+    template <typename U>
+    bool operator!=(const HandlerAllocator<U>& other) const noexcept { return memory_ != other.memory_; }
+
+private:
+    template <typename> friend class HandlerAllocator;
+    HandlerMemory* memory_;
+};
+
+// 给处理函数关联上HandlerMemory
+template <typename Handler>
+class AllocatingHandler {
+public:
+    using allocator_type = HandlerAllocator<Handler>;
+
+    AllocatingHandler(HandlerMemory& memory, Handler handler)
+        : memory_(memory), handler_(std::move(handler)) {}
+
+    allocator_type get_allocator() const noexcept { return allocator_type(memory_); }
+
+    template <typename... Args>
+    void operator()(Args&&... args) {
+        handler_(std::forward<Args>(args)...);
+    }
+
+private:
+    HandlerMemory& memory_;
+    Handler handler_;
+};
+
+template <typename Handler>
+AllocatingHandler<std::decay_t<Handler>> withHandlerMemory(HandlerMemory& memory, Handler&& handler) {
+    return AllocatingHandler<std::decay_t<Handler>>(memory, std::forward<Handler>(handler));
+}
+
+} // namespace Network
+} // namespace Sanguosha
@@ -0,0 +1,110 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "sanguosha.pb.h"
+
+namespace Sanguosha {
+namespace Network {
+
+class Session;
+
+// 单个消息类型的处理统计，多个io线程可以同时更新
+struct MessageStats {
+    // 延迟直方图：第i个桶统计 [2^(i-1), 2^i) 微秒，最后一个桶收纳更慢的
+    static constexpr size_t LATENCY_BUCKETS = 24;
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<uint64_t> errors{0};
+    std::atomic<uint64_t> totalNanos{0};
+    std::array<std::atomic<uint64_t>, LATENCY_BUCKETS> latency{};
+
+    void recordLatency(std::chrono::nanoseconds elapsed);
+    // 按直方图估算分位数（返回所在桶的上界，微秒）
+    uint64_t percentileMicros(double p) const;
+};
+
+// 各消息类型的统计表，按MessageType下标直接索引，越界的类型记在UNKNOWN上
+class MessageStatsTable {
+public:
+    static constexpr size_t TYPE_COUNT = sanguosha::MessageType_ARRAYSIZE;
+
+    static size_t indexOf(sanguosha::MessageType type) {
+        size_t index = static_cast<size_t>(type);
+        return index < TYPE_COUNT ? index : static_cast<size_t>(sanguosha::UNKNOWN);
+    }
+
+    MessageStats& at(sanguosha::MessageType type) { return stats_[indexOf(type)]; }
+    const MessageStats& at(sanguosha::MessageType type) const { return stats_[indexOf(type)]; }
+
+    // 解析失败、未登录等在分发之前就拒绝的消息
+    void recordError(sanguosha::MessageType type, size_t bytes);
+    // 不经过处理函数、只计数的消息（如BATCH外层信封）
+    void record(sanguosha::MessageType type, size_t bytes);
+    // 各类型的统计汇总，按总耗时从高到低排序
+    std::string report() const;
+
+private:
+    std::array<MessageStats, TYPE_COUNT> stats_;
+};
+
+// 处理函数的前置条件，在解析消息体之前检查
+enum class HandlerAccess { ANY, LOGGED_IN };
+
+// 按MessageType下标直接索引的处理函数表（不做哈希查找），取代Session中的switch分发；
+// 每次分发都记录次数、字节数、错误数和处理耗时
+template <typename Context>
+class MessageHandlerRegistry : public MessageStatsTable {
+public:
+    using Handler = std::function<void(Context&, const sanguosha::GameMessage&)>;
+
+    void add(sanguosha::MessageType type, Handler handler, HandlerAccess access = HandlerAccess::ANY) {
+        handlers_[indexOf(type)] = std::move(handler);
+        access_[indexOf(type)] = access;
+    }
+
+    bool has(sanguosha::MessageType type) const {
+        return indexOf(type) == static_cast<size_t>(type) && static_cast<bool>(handlers_[indexOf(type)]);
+    }
+
+    HandlerAccess access(sanguosha::MessageType type) const { return access_[indexOf(type)]; }
+
+    // 调用对应的处理函数；没有注册处理函数时计入错误并返回false。
+    // 处理函数抛出的异常计入错误后继续抛出，由调用方决定是否断开连接
+    bool dispatch(Context& context, const sanguosha::GameMessage& msg, size_t bytes) {
+        size_t index = indexOf(msg.type());
+        MessageStats& stats = at(msg.type());
+        stats.count.fetch_add(1, std::memory_order_relaxed);
+        stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+        const Handler& handler = handlers_[index];
+        if (!handler || index != static_cast<size_t>(msg.type())) {
+            stats.errors.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        try {
+            handler(context, msg);
+        } catch (...) {
+            stats.errors.fetch_add(1, std::memory_order_relaxed);
+            stats.recordLatency(std::chrono::steady_clock::now() - start);
+            throw;
+        }
+        stats.recordLatency(std::chrono::steady_clock::now() - start);
+        return true;
+    }
+
+private:
+    std::array<Handler, TYPE_COUNT> handlers_;
+    std::array<HandlerAccess, TYPE_COUNT> access_{};
+};
+
+using HandlerRegistry = MessageHandlerRegistry<Session>;
+
+} // namespace Network
+} // namespace Sanguosha
@@ -0,0 +1,81 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Sanguosha {
+namespace Network {
+
+// 热重启交接：新进程连上旧进程的交接socket（Unix域），旧进程用SCM_RIGHTS把监听socket
+// 和可以迁移的连接的文件描述符连同会话状态发过去。监听socket在两个进程间共享，
+// 交接期间不会有连接被拒绝；迁移过去的连接客户端无感知，不需要重连。
+//
+// 只有“干净”的连接可以迁移：没有读了一半的请求、没有待发送的帧、不在房间里、
+// 没有协商压缩（deflate上下文无法迁移）。其余连接留在旧进程里，按停机排空流程处理。
+
+// 一个迁移的连接
+struct HandoffSession {
+    int fd = -1;
+    uint32_t playerId = 0;     // 0表示还未登录
+    uint32_t capabilities = 0;
+    std::string resumeToken;   // 已登录玩家的重连令牌，迁移后继续有效
+};
+
+// 新进程收到的全部内容，文件描述符的所有权归调用方
+struct HandoffState {
+    int listenerFd = -1;
+    std::vector<HandoffSession> sessions;
+};
+
+// 交接socket的一端，阻塞读写（交接只在启动或升级时发生一次，数据量很小）。
+// 出错时抛出std::system_error或std::runtime_error
+class HandoffChannel {
+public:
+    // 接管已连接的socket的所有权
+    explicit HandoffChannel(int fd);
+    ~HandoffChannel();
+
+    HandoffChannel(const HandoffChannel&) = delete;
+    HandoffChannel& operator=(const HandoffChannel&) = delete;
+    HandoffChannel(HandoffChannel&& other) noexcept;
+
+    // 新进程：连接旧进程的交接socket并发出接管请求
+    static HandoffChannel connect(const std::string& path);
+
+    // 旧进程：等待对方的接管请求
+    void awaitRequest();
+    void sendListener(int fd);
+    void sendSession(const HandoffSession& session);
+    void sendDone();
+
+    // 新进程：接收直到DONE；接管完成（已开始在监听socket上接受连接）后回一个确认
+    HandoffState receiveAll();
+    void sendAck();
+    // 旧进程：等新进程确认，之后才能停止接受连接
+    void awaitAck();
+
+    // 读写超时，防止对端卡住时一直阻塞
+    static constexpr int IO_TIMEOUT_SEC = 10;
+
+private:
+    enum class Kind : uint32_t { REQUEST = 1, LISTENER = 2, SESSION = 3, DONE = 4, ACK = 5 };
+
+    struct Record {
+        uint32_t magic;
+        Kind kind;
+        uint32_t playerId;
+        uint32_t capabilities;
+        uint32_t payloadSize;
+    };
+
+    void send(Kind kind, uint32_t playerId, uint32_t capabilities, const std::string& payload, int fd);
+    void expect(Kind kind);
+    // 返回随记录附带的文件描述符，没有时为-1
+    int receive(Record& record, std::string& payload);
+    void readExactly(char* out, size_t size);
+
+    int fd_;
+};
+
+} // namespace Network
+} // namespace Sanguosha
@@ -0,0 +1,47 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include "common/timer_wheel.h"
+#include "common/token_bucket.h"
+
+namespace Sanguosha {
+namespace Network {
+
+// 登录准入控制：重启后所有客户端同时重连时，按令牌桶速率放行登录，
+// 超出速率的请求排队，队列也满了就直接拒绝并告诉客户端多久后重试。
+class LoginAdmission {
+public:
+    enum class Result { ADMITTED, QUEUED, REJECTED };
+    using Task = std::function<void()>;
+
+    LoginAdmission(Common::TimerWheel& wheel, double ratePerSecond, uint32_t burst, size_t queueLimit);
+
+    // 有令牌时立即执行task；否则排队，轮到时在时间轮线程上执行。
+    // retryAfterMs 为排队或拒绝时建议客户端等待的时间
+    Result submit(Task task, uint32_t& retryAfterMs);
+
+    size_t queued() const;
+    uint64_t admittedCount() const { return admitted_; }
+    uint64_t rejectedCount() const { return rejected_; }
+
+private:
+    void scheduleDrainLocked();
+    void drain();
+    uint32_t estimateWaitLocked(size_t position);
+
+    Common::TimerWheel& wheel_;
+    Common::TokenBucket bucket_;
+    const size_t queueLimit_;
+    std::deque<Task> queue_;
+    bool drainScheduled_ = false;
+    mutable std::mutex mutex_;
+
+    std::atomic<uint64_t> admitted_{0};
+    std::atomic<uint64_t> rejected_{0};
+};
+
+} // namespace Network
+} // namespace Sanguosha
@@ -11,12 +11,87 @@ class MessageCodec {
 public:
     // 消息头长度（4字节）
     static constexpr size_t HEADER_LENGTH = sizeof(uint32_t);
+
+    // 帧格式：4字节网络字节序的消息体长度 + 消息体。所有读写帧头的代码都经过这两个函数
+    static void writeHeader(char* out, uint32_t bodySize);
+    static uint32_t readHeader(const char* in);
+
+    // 完整帧的字节数。同时缓存msg各层的长度，紧接着的encodeInto不再重复计算
+    static size_t frameSize(const sanguosha::GameMessage& msg);
+    // 把完整帧直接序列化到调用方提供的缓冲区，没有中间拷贝；
+    // 必须在frameSize之后、msg未被修改时调用。返回写入的字节数，空间不足返回0
+    static size_t encodeInto(const sanguosha::GameMessage& msg, char* out, size_t capacity);
+    // 从调用方持有的内存（如接收缓冲区）直接解析消息体，msg可以复用
+    static bool decode(const char* body, size_t size, sanguosha::GameMessage& msg);
+
+    // 编码GameMessage信封：type加上oneof中编号为fieldNumber的payload。
+    // payload直接序列化进帧里，不用先拷贝进一个GameMessage；payload为空时只有type
+    static std::vector<char> encodeEnvelope(sanguosha::MessageType type, int fieldNumber,
+                                            const google::protobuf::MessageLite* payload);
     
-    // 序列化消息
+    // 序列化消息（分配新的帧）
     static std::vector<char> encode(const sanguosha::GameMessage& msg);
     
-    // 反序列化消息
+    // 把多个已编码的帧合并成一个BATCH帧，直接拼接各帧的消息体，不重新序列化
+    static std::vector<char> encodeBatch(const std::vector<std::shared_ptr<const std::vector<char>>>& frames);
+    
+    // 反序列化一个完整帧
     static sanguosha::GameMessage decode(const std::vector<char>& buffer);
+
+    // 紧凑编码（登录时协商CAPABILITY_COMPACT后可用）：GAME_ACTION和HEARTBEAT这两种
+    // 最频繁的小消息用定长小端结构体代替protobuf，解码不经过protobuf解析。
+    // 消息体首字节是标记，取值都是字段号为0的protobuf键，不会与protobuf消息混淆
+    enum CompactTag : uint8_t {
+        COMPACT_GAME_ACTION = 0x01,
+        COMPACT_HEARTBEAT = 0x02,
+        COMPRESSED = 0x03, // 压缩帧，见FrameCompressor
+    };
+
+#pragma pack(push, 1)
+    struct CompactGameAction {
+        uint8_t tag;
+        uint8_t actionType;
+        uint32_t cardId;
+        uint32_t targetPlayer;
+        uint32_t promptId;
+        uint32_t requestId;
+    };
+
+    struct CompactHeartbeat {
+        uint8_t tag;
+        uint64_t timestamp;
+        uint32_t requestId;
+    };
+#pragma pack(pop)
+
+    // 消息体是否为紧凑编码（只看首字节）
+    static bool isCompact(const char* body, size_t size) {
+        return size > 0 && static_cast<uint8_t>(body[0]) < 0x08;
+    }
+    // 紧凑消息对应的消息类型，标记无效时返回UNKNOWN
+    static sanguosha::MessageType compactType(const char* body, size_t size);
+    // 把紧凑消息的各字段写入msg；msg可以复用，相同类型的消息不会重新分配子消息
+    static bool decodeCompact(const char* body, size_t size, sanguosha::GameMessage& msg);
+    // 消息类型支持紧凑编码时编码成完整帧并返回true
+    static bool encodeCompact(const sanguosha::GameMessage& msg, std::vector<char>& frame);
+
+    // 信封预解析的结果：payload指向消息体内oneof成员的编码，不拷贝
+    struct Envelope {
+        sanguosha::MessageType type = sanguosha::UNKNOWN;
+        uint32_t requestId = 0;
+        int payloadField = 0;
+        const char* payload = nullptr;
+        size_t payloadSize = 0;
+    };
+
+    // 只扫描消息体的顶层字段，取出type、request_id和payload的位置，不做完整解析，
+    // 供路由、登录检查和限流在解析前做判断；数据格式错误返回false
+    static bool peekEnvelope(const char* body, size_t size, Envelope& envelope);
+    static bool peekType(const char* body, size_t size, sanguosha::MessageType& type);
+
+    // 逐条取出GameMessageBatch编码中的消息，不解析；没有更多消息或格式错误时返回false，
+    // 正常结束时cursor等于end
+    static bool nextBatchItem(const char*& cursor, const char* end, const char*& item, size_t& itemSize);
 };
 
 } // namespace Network
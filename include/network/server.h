@@ -4,38 +4,174 @@
 #include <unordered_map>
 #include <mutex>
 #include <memory>
+#include <random>
+#include <string>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include "network/session.h"
+#include "network/server_config.h"
+#include "network/login_admission.h"
+#include "network/handler_registry.h"
+#include "common/timer_wheel.h"
+#include "common/user_store.h"
+#include "common/buffer_pool.h"
+#include "common/io_gate.h"
 
 namespace Sanguosha {
 namespace Network {
 
 class Session; // 前向声明
 
+// 发送队列的全服统计
+struct OutboundMetrics {
+    std::atomic<uint64_t> queuedBytes{0};         // 所有会话当前积压的字节数
+    std::atomic<uint64_t> peakSessionBytes{0};    // 单个会话出现过的最大积压
+    std::atomic<uint64_t> droppedFrames{0};       // 因积压被丢弃的状态帧
+    std::atomic<uint64_t> slowConsumerDisconnects{0};
+    // 压缩前后的字节数，用来评估压缩省下的带宽
+    std::atomic<uint64_t> compressedFrames{0};
+    std::atomic<uint64_t> bytesBeforeCompression{0};
+    std::atomic<uint64_t> bytesAfterCompression{0};
+
+    void recordDepth(uint64_t sessionBytes) {
+        uint64_t peak = peakSessionBytes.load(std::memory_order_relaxed);
+        while (sessionBytes > peak &&
+               !peakSessionBytes.compare_exchange_weak(peak, sessionBytes, std::memory_order_relaxed)) {
+        }
+    }
+};
+
 class Server {
 public:
-    Server();
+    // 连接数已满时，提示客户端多久之后再连
+    static constexpr uint32_t CONNECTION_RETRY_AFTER_MS = 2000;
+
+    // 忙轮询模式空闲退避时单次阻塞等待的范围
+    static constexpr std::chrono::microseconds MIN_IDLE_BLOCK{1};
+    static constexpr std::chrono::microseconds MAX_IDLE_BLOCK{1000};
+
+    // 停机时等待发送队列写完的最长时间，以及排空期间的检查间隔
+    static constexpr std::chrono::milliseconds DRAIN_FLUSH_TIMEOUT{5000};
+    static constexpr std::chrono::milliseconds DRAIN_POLL_INTERVAL{200};
+
+    explicit Server(const ServerConfig& config = ServerConfig());
+    ~Server();
     void start(unsigned short port);
+
+    const ServerConfig& config() const { return config_; }
     
     // 添加三个关键的会话管理方法
     void registerSession(uint32_t playerId, std::shared_ptr<Session> session);
-    void unregisterSession(uint32_t playerId);
+    // 只有映射仍指向该会话（或已失效）时才移除，避免旧连接析构时覆盖重连后的新会话
+    void unregisterSession(uint32_t playerId, const Session* session);
     std::shared_ptr<Session> getSession(uint32_t playerId);
+
+    // 断线重连：登录时下发令牌，连接断开后在宽限期内凭令牌取回原玩家ID
+    std::string issueResumeToken(uint32_t playerId);
+    uint32_t resumePlayer(const std::string& token); // 令牌无效或已过期返回0
+    // 会话关闭时调用：释放连接并为已登录玩家开始宽限计时
+    void onSessionClosed(const std::shared_ptr<Session>& session);
+    // 会话交给了新进程（热重启）：只从表中移除，不开始宽限计时
+    void forgetSession(const std::shared_ptr<Session>& session);
+    // 热重启交接已完成：用户表由新进程写，本进程留下的会话不能再登录
+    bool handedOff() const { return handedOff_.load(); }
+    // 崩溃恢复出来的玩家还没有连接：按刚断线处理，宽限期内登录回到座位，否则释放座位
+    void holdSeat(uint32_t playerId);
     
     // 添加获取io_context的方法
     boost::asio::io_context& getIoContext() { return io_context_; }
+    // 其他线程向io线程投递回调用这个，停机后投递被丢弃而不是落到已销毁的io_context上
+    const std::shared_ptr<Common::IoGate>& getIoGate() const { return ioGate_; }
+
+    // 全服共享的时间轮，用于响应窗口等截止时间
+    Common::TimerWheel& getTimerWheel() { return timerWheel_; }
+
+    // 用户名 -> 玩家ID 的持久化存储，可从任意线程调用
+    Common::UserStore& getUserStore() { return userStore_; }
+
+    // 所有会话共享的接收缓冲区池
+    Common::BufferPool& getBufferPool() { return bufferPool_; }
+
+    // 登录准入队列，重连风暴时限制登录处理速率
+    LoginAdmission& getLoginAdmission() { return loginAdmission_; }
+    size_t connectionCount();
+
+    OutboundMetrics& outboundMetrics() { return outboundMetrics_; }
+
+    // 消息处理函数表，所有会话共用，同时记录各消息类型的处理统计
+    HandlerRegistry& getHandlerRegistry() { return handlers_; }
+
+    // 全服按消息类型统计被限流丢弃的消息数
+    void recordRateLimited(sanguosha::MessageType type);
+    uint64_t rateLimitedCount(sanguosha::MessageType type) const;
 
 private:
     void do_accept();
+    void rejectConnection(boost::asio::ip::tcp::socket socket);
+    void onGraceExpired(uint32_t playerId);
+    void scheduleStatsReport();
+    // 崩溃恢复：从stateDir恢复房间和游戏（热重启接管时除外），之后开始记录并定期写快照
+    void startPersistence();
+    void scheduleSnapshot();
+    // 构造其他成员之前先把当前线程绑到ioCpu：缓冲池、时间轮和用户表在构造函数里分配，
+    // 这样按first-touch落在事件循环所在的节点
+    static const ServerConfig& pinConstructingThread(const ServerConfig& config);
+    // 按配置把事件循环线程和机器人搜索线程绑核，并打印CPU/NUMA拓扑
+    void placeThreads();
+    // 默认阻塞在io_context::run()里；忙轮询模式下自己驱动事件循环
+    void runEventLoop();
+
+    // 优雅停机：收到SIGTERM/SIGINT后停止接受连接和开新局，等进行中的游戏打完
+    // （最多drainTimeoutSec秒），再等各连接的发送队列写完后关闭连接、退出事件循环。
+    // 排空期间再收到一次信号则跳过等待游戏结束
+    void waitForSignal();
+    void beginDrain();
+    void checkDrained();
+    void finishShutdown(std::chrono::steady_clock::time_point flushDeadline);
+
+    // 热重启（见hot_restart.h）：新进程启动时从旧进程接手监听socket和空闲连接；
+    // 旧进程在交接socket上等待，交接完成后对剩下的游戏按停机排空处理
+    void takeOver();
+    void listenForHandoff();
+    void acceptHandoff();
+    void handOff(boost::asio::local::stream_protocol::socket socket);
     
+    ServerConfig config_;
+    Common::BufferPool bufferPool_; // 先于会话构造、后于会话析构
     boost::asio::io_context io_context_;
+    std::shared_ptr<Common::IoGate> ioGate_;
     boost::asio::ip::tcp::acceptor acceptor_;
+    boost::asio::signal_set signals_;
+    boost::asio::local::stream_protocol::acceptor handoffAcceptor_;
+    bool draining_ = false;
+    bool shuttingDown_ = false;
+    std::atomic<bool> handedOff_{false};
+    std::chrono::steady_clock::time_point drainDeadline_;
+    Common::TimerWheel timerWheel_;
+    Common::UserStore userStore_;
+    LoginAdmission loginAdmission_;
+    // 拒绝连接时直接写出的预编码帧，不为被拒绝的连接做任何分配
+    std::vector<char> serverFullFrame_;
+    std::array<std::atomic<uint64_t>, sanguosha::MessageType_ARRAYSIZE> rateLimited_{};
+    OutboundMetrics outboundMetrics_;
+    HandlerRegistry handlers_;
     
     // 用于管理所有活跃会话的集合
     std::set<std::shared_ptr<Session>> sessions_;
     
     // 用于通过玩家ID查找其会话的映射表
     std::unordered_map<uint32_t, std::weak_ptr<Session>> playerSessions_;
-    std::mutex sessionMutex_; // 保护 playerSessions_ 的互斥锁
+    std::mutex sessionMutex_; // 保护 sessions_、playerSessions_ 和重连状态的互斥锁
+
+    // 重连状态：令牌 -> 玩家ID，以及每个玩家的令牌和宽限计时器
+    struct Presence {
+        std::string token;
+        Common::TimerWheel::TimerId graceTimer = Common::TimerWheel::INVALID_TIMER;
+    };
+    std::unordered_map<std::string, uint32_t> resumeTokens_;
+    std::unordered_map<uint32_t, Presence> presence_;
+    std::mt19937_64 tokenRng_{std::random_device{}()};
 };
 
 } // namespace Network
@@ -0,0 +1,102 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Sanguosha {
+namespace Network {
+
+// 令牌桶参数：每秒补充的令牌数和最多可攒的令牌数，速率为0表示不限
+struct RateLimit {
+    double ratePerSec = 0;
+    uint32_t burst = 1;
+};
+
+// 发送队列超过上限时的处理策略
+enum class OutboundPolicy {
+    DROP_OLDEST_STATE, // 从最旧的状态快照开始丢弃，直到放得下
+    LATEST_KEYFRAME,   // 状态快照只保留最新的一帧
+    DISCONNECT,        // 直接断开慢速客户端
+};
+
+// 服务器运行参数，命令行以 --key=value 形式覆盖默认值
+struct ServerConfig {
+    unsigned short port = 9527;
+    std::string userStorePath = "sanguosha_users.db";
+
+    // 单帧消息体长度上限，超过即断开连接（防止伪造的长度头让服务器分配大块内存）
+    uint32_t maxFrameSize = 64 * 1024;
+
+    // 每个会话待发送字节数上限及超限策略（--outbound-policy=drop-oldest|keyframe|disconnect）
+    uint32_t maxOutboundBytes = 256 * 1024;
+    OutboundPolicy outboundPolicy = OutboundPolicy::DROP_OLDEST_STATE;
+    // 协商了压缩的连接上，消息体不小于该长度的下行帧才压缩；0表示不提供压缩
+    uint32_t compressThreshold = 512;
+
+    // 连接数上限，超过后在创建Session之前直接拒绝
+    uint32_t maxConnections = 10000;
+    // 登录准入：令牌桶速率与突发量，以及排队上限（超过后拒绝并提示重试时间）
+    double loginRatePerSec = 200;
+    uint32_t loginBurst = 400;
+    uint32_t loginQueueLimit = 5000;
+
+    // 单个会话按消息类型限流（键为sanguosha::MessageType），未列出的类型使用默认值。
+    // 命令行：--rate-limit.GAME_ACTION=20/40
+    std::unordered_map<int, RateLimit> messageRateLimits = defaultMessageRateLimits();
+    RateLimit defaultRateLimit{5, 10};
+    // 连续被限流丢弃的消息达到该数量视为刷屏，断开连接
+    uint32_t floodDisconnectThreshold = 100;
+
+    // 热重启（见hot_restart.h）：handoffSocket非空时在该Unix socket路径上等待新进程来接管；
+    // --takeover=on 启动时先从该路径上的旧进程接手监听socket和空闲连接，而不是自己bind端口
+    std::string handoffSocket;
+    bool takeover = false;
+
+    // 房间和游戏状态的持久化目录（见room/room_journal.h），为空表示不持久化。
+    // 启动时从中恢复上次的房间和游戏；每snapshotIntervalSec秒写一次全量快照，0表示只在启动和停机时写
+    std::string stateDir;
+    uint32_t snapshotIntervalSec = 30;
+
+    // 回合时限（超时自动弃牌并结束回合）和响应窗口时限（超时按不出闪处理），毫秒
+    uint32_t turnTimeoutMs = 60000;
+    uint32_t responseTimeoutMs = 15000;
+    // 共享时间轮的刻度，所有截止时间按刻度取整
+    uint32_t timerTickMs = 100;
+    // 断线后保留座位的宽限期（毫秒），期间凭令牌重连可直接恢复，过期判负
+    uint32_t resumeGraceMs = 60000;
+    // 房间连续空闲超过该时长（毫秒）后休眠，见RoomManager::HibernatedRoom
+    uint32_t hibernateIdleMs = 5000;
+
+    // 收到SIGTERM后等待进行中的游戏结束的最长时间（秒），超时后不再等待直接退出
+    uint32_t drainTimeoutSec = 600;
+
+    // 按消息类型输出处理统计的间隔（秒），0表示不输出
+    uint32_t statsIntervalSec = 300;
+
+    // 线程绑核（cpulist格式，如 --worker-cpus=2-5,8）：事件循环线程绑到ioCpu，
+    // 机器人搜索线程轮流绑到workerCpus。-1/空表示交给调度器。
+    // 内存靠first-touch落在绑定的节点上，不做显式的NUMA分配：构造Server的线程在构造开始时
+    // 就绑到ioCpu，所以应当在之后调用start()的同一个线程上构造Server，否则构造期分配的
+    // 缓冲池、时间轮和用户表可能落在别的节点
+    int ioCpu = -1;
+    std::vector<int> workerCpus;
+    // 机器人搜索线程数，0表示指定了workerCpus时每个cpu一个线程，否则用一半核心
+    uint32_t botThreads = 0;
+
+    // 低延迟模式（--busy-poll=on）：事件循环不阻塞在epoll里，而是连续poll()，
+    // 空闲超过busyPollSpinUs后逐步退避到短时阻塞等待，用CPU换尾延迟
+    bool busyPoll = false;
+    uint32_t busyPollSpinUs = 200;
+    // 忙轮询模式下会话socket的SO_BUSY_POLL（微秒），0表示不设置；调高需要CAP_NET_ADMIN
+    uint32_t busyPollUsec = 50;
+
+    const RateLimit& rateLimitFor(int messageType) const;
+    static std::unordered_map<int, RateLimit> defaultMessageRateLimits();
+
+    // 解析命令行参数，未知参数或非法取值抛出std::invalid_argument
+    static ServerConfig fromArgs(int argc, char* argv[]);
+};
+
+} // namespace Network
+} // namespace Sanguosha
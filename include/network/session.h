@@ -1,7 +1,16 @@
 #pragma once
 #include <boost/asio.hpp>
 #include <memory>
+#include <chrono>
+#include <vector>
+#include <deque>
 #include "sanguosha.pb.h"
+#include "network/message_codec.h"
+#include "network/handler_registry.h"
+#include "network/frame_compressor.h"
+#include "network/handler_memory.h"
+#include "common/token_bucket.h"
+#include "common/buffer_pool.h"
 
 // 修改前向声明
 namespace Sanguosha {
@@ -15,28 +24,122 @@ namespace Network {
 
 class Session : public std::enable_shared_from_this<Session> {
 public:
+    // 发送帧的类别：状态快照可以被更新的快照取代，发送队列积压时优先丢弃
+    enum class FrameKind { CONTROL, STATE };
+
+    // 服务器支持的Capability位，登录时与客户端声明的取交集
+    static constexpr uint32_t SUPPORTED_CAPABILITIES =
+        sanguosha::CAPABILITY_BATCH | sanguosha::CAPABILITY_COMPACT | sanguosha::CAPABILITY_COMPRESS;
+
     explicit Session(boost::asio::ip::tcp::socket socket, Server& server);
     ~Session(); // 添加析构函数声明
     
     void start();
     void send(const sanguosha::GameMessage& msg);
+    // 发送对某个请求的响应，带回请求的关联ID
+    void reply(uint32_t requestId, sanguosha::GameMessage& response);
+    // 发送已经编码好的完整帧（广播时多个会话共享同一帧）；可从任意线程调用
+    void sendFrame(std::shared_ptr<const std::vector<char>> frame, FrameKind kind = FrameKind::CONTROL);
+    // 关闭连接并通知服务器（可重复调用）
+    void close();
+
+    // 热重启：连接当前没有进行到一半的收发、也没有协商压缩时，可以原样交给新进程
+    bool canHandOff() const;
+    // 交出socket：停止本会话的所有异步操作，不关闭连接也不开始重连宽限，返回文件描述符
+    int detach();
+    // 新进程里恢复迁移过来的会话状态，在start()之前调用
+    void adopt(uint32_t playerId, uint32_t capabilities);
+
+    uint32_t playerId() const { return playerId_; }
+    uint32_t capabilities() const { return capabilities_; }
+
+    // 把各消息类型的处理函数注册到表中（服务器构造时调用一次）
+    static void registerHandlers(HandlerRegistry& registry);
+    // 发送队列深度（帧数/字节数）
+    size_t outboundFrames() const { return outbox_.size(); }
+    size_t outboundBytes() const { return outboundBytes_; }
     
 private:
-    void doReadHeader();
-    void doReadBody();
-    void handleLogin(const sanguosha::LoginRequest& login);
-    void handleHeartbeat(const boost::system::error_code& ec);
+    struct OutboundFrame {
+        std::shared_ptr<const std::vector<char>> frame;
+        FrameKind kind;
+    };
+
+    // writeBuffers_中的一段。async_write会复制缓冲区序列，复制它只是复制两个指针
+    struct BufferRange {
+        const boost::asio::const_buffer* first;
+        const boost::asio::const_buffer* last;
+        const boost::asio::const_buffer* begin() const { return first; }
+        const boost::asio::const_buffer* end() const { return last; }
+    };
+
+    // 接收：等到可读后一次读走内核中所有已到达的数据，连续处理其中每个完整的帧，
+    // 客户端流水线发送的多个请求只需一次唤醒和一次系统调用
+    void doRead();
+    void onReadable();
+    void enableBusyPoll();
+    void processFrames();
+    // 以下返回false表示连接已关闭
+    bool handleFrame(const char* body, uint32_t size);
+    bool handleMessage(const char* body, size_t size, const MessageCodec::Envelope& envelope, bool compact);
+    bool handleBatch(const MessageCodec::Envelope& envelope, size_t size);
+    void ensureRecvCapacity(size_t bytes);
+    // 异步处理的请求（排队中的登录）完成前暂停处理后续请求，保证响应顺序
+    void pauseReading() { readPaused_ = true; }
+    void resumeReading();
+
+    void handleLogin(const sanguosha::LoginRequest& login, uint32_t requestId);
+    void processLogin(const sanguosha::LoginRequest& login, uint32_t requestId);
+    void handleHeartbeat(const sanguosha::Heartbeat& heartbeat, uint32_t requestId);
     void startHeartbeat();
-    void handleRoomRequest(const sanguosha::RoomRequest& request);
-    void handleRoomListRequest();
-    void handleGameAction(const sanguosha::GameAction& action);
+    void handleRoomRequest(const sanguosha::RoomRequest& request, uint32_t requestId);
+    void handleRoomListRequest(uint32_t requestId);
+    void handleGameAction(const sanguosha::GameAction& action, uint32_t requestId);
+    // 处理一批请求期间产生的控制帧先攒着，处理完合并成一个BATCH帧发出
+    void flushCoalesced();
+    // 按消息类型限流，在解析消息体之前调用
+    bool admitMessage(sanguosha::MessageType type);
+    // 发送队列：同一时刻只有一个async_write在进行
+    void enqueueFrame(std::shared_ptr<const std::vector<char>> frame, FrameKind kind);
+    bool makeRoom(size_t incoming, FrameKind kind);
+    void dropQueuedFrame(size_t index);
+    void doWrite();
+    void clearOutbox();
     
     boost::asio::ip::tcp::socket socket_;
     boost::asio::steady_timer heartbeat_timer_;
-    std::array<char, 128> header_buffer_;
-    std::vector<char> body_buffer_;
-    uint32_t expected_body_size_ = 0;
+    // 接收缓冲区只在有未处理完的数据时持有，空闲连接不占用
+    Common::BufferPool::Buffer recvBuffer_;
+    size_t recvBytes_ = 0;
+    bool readPaused_ = false;
+    uint32_t capabilities_ = 0; // 登录时协商出的Capability位
+    bool coalescing_ = false;
+    std::vector<std::shared_ptr<const std::vector<char>>> coalesced_;
+    // 压缩在帧离开发送队列时进行，积压时按策略丢弃的帧不会进入压缩流
+    std::unique_ptr<FrameCompressor> compressor_;
+    // 紧凑消息解码到这个复用的对象里，热路径上不反复分配
+    sanguosha::GameMessage compactMessage_;
     uint32_t playerId_ = 0;
+    bool closed_ = false;
+    // 每种消息类型一个令牌桶（下标为MessageType，越界的类型归入UNKNOWN）
+    std::vector<Common::TokenBucket> rateBuckets_;
+    std::vector<uint64_t> rateLimited_; // 各类型被丢弃的消息数
+    uint32_t consecutiveDropped_ = 0;
+    std::chrono::steady_clock::time_point lastActivity_ = std::chrono::steady_clock::now();
+    std::deque<OutboundFrame> outbox_; // 队首的inFlight_个帧正在写
+    size_t outboundBytes_ = 0;
+    size_t inFlight_ = 0;
+    size_t inFlightBytes_ = 0; // 正在写的帧压缩前的总长度
+    // 正在写的帧直接由outbox_持有（写完之前不会被移除），这里只放本次写的缓冲区描述，
+    // 以及压缩后的临时帧；两者都在写之间复用容量
+    std::vector<boost::asio::const_buffer> writeBuffers_;
+    std::vector<std::vector<char>> compressedFrames_;
+    // 三类异步操作各自复用一块处理函数内存
+    HandlerMemory readHandlerMemory_;
+    HandlerMemory writeHandlerMemory_;
+    HandlerMemory timerHandlerMemory_;
+    static constexpr size_t RECV_BUFFER_SIZE = 4096;
+    static constexpr size_t MAX_GATHER_FRAMES = 64; // 一次写出的最大帧数
     static constexpr int HEARTBEAT_INTERVAL = 30;
     static constexpr int HEARTBEAT_TIMEOUT = 60;
 
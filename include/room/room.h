@@ -12,11 +12,13 @@ namespace Room {
 }
 namespace Network {
     class Server; // 添加Server的前向声明
+    class Session;
 }
 }
 
 namespace sanguosha {
     class GameInstance;
+    class RoomSnapshot;
 }
 
 namespace Sanguosha {
@@ -25,15 +27,30 @@ namespace Room {
 class Room {
 public:
     enum class State { WAITING, PLAYING };
+
+    // 座位数范围：2人为1v1，最多8人身份局
+    static constexpr uint32_t MIN_PLAYERS = 2;
+    static constexpr uint32_t MAX_PLAYERS = 8;
     
-    explicit Room(uint32_t id);
+    explicit Room(uint32_t id, uint32_t capacity = MIN_PLAYERS);
     
     bool addPlayer(uint32_t playerId);
     bool removePlayer(uint32_t playerId);
+
+    // 绑定座位对应的会话，广播时直接使用，不必再按玩家ID查表
+    void bindSession(uint32_t playerId, std::weak_ptr<Sanguosha::Network::Session> session);
+    std::vector<std::shared_ptr<Sanguosha::Network::Session>> getSessions();
+
+    // 最近一次广播的完整游戏状态帧，断线重连时直接作为关键帧补发
+    void setStateFrame(std::shared_ptr<const std::vector<char>> frame);
+    std::shared_ptr<const std::vector<char>> stateFrame();
     
     bool startGame(RoomManager& roomManager, Sanguosha::Network::Server& server); // 使用完整命名空间
     
     uint32_t playerCount() const;
+    uint32_t capacity() const;
+    bool isFull() const;
+    uint32_t owner() const; // 房主（第一个加入的玩家）
     uint32_t id() const;
     State state() const;
     
@@ -42,10 +59,23 @@ public:
     bool isPlaying() const;
     std::shared_ptr<sanguosha::GameInstance> getGameInstance() const;
 
+    // 房间上每发生一次事件（入房、离开、广播、重连）递增，空闲检查据此判断期间有没有活动
+    void touch() { ++activity_; }
+    uint64_t activity() const { return activity_; }
+
+    // 崩溃恢复：房间（及进行中的游戏）的完整状态，会话绑定不保存，玩家重新登录时再绑定
+    void saveSnapshot(sanguosha::RoomSnapshot* snapshot);
+    static std::shared_ptr<Room> fromSnapshot(const sanguosha::RoomSnapshot& snapshot, RoomManager& roomManager,
+                                              Sanguosha::Network::Server& server);
+
 private:
     uint32_t id_;
+    uint32_t capacity_;
     std::vector<uint32_t> players_;
+    std::vector<std::weak_ptr<Sanguosha::Network::Session>> sessions_; // 与players_一一对应
+    std::shared_ptr<const std::vector<char>> stateFrame_;
     State state_;
+    uint64_t activity_ = 0;
     std::mutex mutex_;
     
     std::shared_ptr<sanguosha::GameInstance> gameInstance_;
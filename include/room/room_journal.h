@@ -0,0 +1,86 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "sanguosha.pb.h"
+
+namespace Sanguosha {
+namespace Room {
+
+// 房间和游戏状态的持久化：定期写一份全量快照，两次快照之间的每个事件追加到操作日志（WAL）。
+// 崩溃后重启时读最近一份快照，再按顺序回放其后的日志，就能恢复到崩溃前的局面。
+//
+// 目录中的文件：
+//   rooms.snapshot   最近一份快照，先写临时文件再rename替换，不会出现写了一半的快照
+//   rooms.wal.<N>    第N代日志，记录第N代快照之后的事件；新快照落盘后删除更早的日志
+//
+// 事件在调用线程（io线程）上序列化后放进队列，序列化快照、写文件和fdatasync都在后台线程上做，
+// 每FLUSH_INTERVAL批量落盘一次。崩溃时最多丢失最后一个批次；日志末尾写了一半的记录在恢复时丢弃。
+class RoomJournal {
+public:
+    // 批量落盘的间隔
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{10};
+
+    struct Recovery {
+        sanguosha::RoomManagerSnapshot snapshot;          // 没有快照时为空
+        std::vector<sanguosha::RoomJournalRecord> records; // 快照之后的事件，按发生顺序
+    };
+
+    // 读取目录中最近的快照和其后的日志，目录不存在时返回空结果
+    static Recovery recover(const std::string& directory);
+
+    // 创建目录（如不存在）并启动后台写线程；失败时抛出std::system_error。
+    // 打开后第一次调用必须是writeSnapshot，之后的事件才有对应的日志文件
+    explicit RoomJournal(const std::string& directory);
+    // 写完所有排队的内容后退出
+    ~RoomJournal();
+
+    RoomJournal(const RoomJournal&) = delete;
+    RoomJournal& operator=(const RoomJournal&) = delete;
+
+    void append(const sanguosha::RoomJournalRecord& record);
+    // 保存快照并开始新一代日志（generation由这里填写）；写快照失败时事件继续记在当前这一代
+    void writeSnapshot(std::unique_ptr<sanguosha::RoomManagerSnapshot> snapshot);
+    // 阻塞到目前排队的内容全部落盘
+    void flush();
+
+    uint64_t generation() const;
+
+private:
+    struct Task {
+        std::string records; // 已编码的日志记录
+        std::unique_ptr<sanguosha::RoomManagerSnapshot> snapshot; // 非空表示先写快照，成功后切换到新一代日志
+    };
+
+    void run();
+    void process(Task& task);
+    void rotate(sanguosha::RoomManagerSnapshot& snapshot);
+    void writeAll(int fd, const std::string& bytes, const std::string& path);
+    std::string walPath(uint64_t generation) const;
+    void reportError(const std::exception& e);
+
+    std::string directory_;
+    int walFd_ = -1;       // 只在后台线程上使用
+    uint64_t walGeneration_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeup_;
+    std::condition_variable flushed_;
+    std::deque<Task> tasks_;
+    uint64_t generation_ = 0;  // 最近一次分配的快照代数
+    uint64_t enqueued_ = 0;    // 入队的任务数
+    uint64_t completed_ = 0;   // 已落盘的任务数
+    size_t flushWaiters_ = 0;
+    bool stopping_ = false;
+    bool failed_ = false;      // 写失败只报告一次，之后继续尝试
+    std::thread writer_;
+};
+
+} // namespace Room
+} // namespace Sanguosha
@@ -3,18 +3,23 @@
 #include <unordered_map>
 #include <memory>
 #include <mutex>
-#include <boost/asio/steady_timer.hpp>
-#include <boost/asio/io_context.hpp>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
 #include "sanguosha.pb.h"
+#include "common/timer_wheel.h"
 #include <google/protobuf/message.h>
 
 // 前向声明替代包含
 namespace Sanguosha {
 namespace Room {
     class Room; // 前向声明Room类
+    class RoomJournal;
 }
 namespace Network {
     class Server; // 添加Server的前向声明
+    class Session;
 }
 }
 
@@ -23,40 +28,108 @@ namespace Room {
 
 class RoomManager {
 public:
+    // 等待超过该时长仍未坐满的房间由机器人补位
+    static constexpr uint32_t BOT_FILL_DELAY_MS = 20000;
+
     static RoomManager& Instance();
     
-    uint32_t createRoom();
-    uint32_t createRoom(const std::vector<uint32_t>& playerIds);
+    uint32_t createRoom(uint32_t capacity = 2); // 默认1v1
+    uint32_t createRoom(const std::vector<uint32_t>& playerIds, uint32_t capacity);
     bool joinRoom(uint32_t roomId, uint32_t playerId);
+    // 房主提前开始游戏（人数不必坐满）
+    bool startRoom(uint32_t roomId, uint32_t playerId);
+    // 离开房间：对局中离开按判负处理，最后一个人离开时回收房间
     bool leaveRoom(uint32_t roomId, uint32_t playerId);
+    // 移除房间（游戏结束后调用）
+    bool closeRoom(uint32_t roomId);
+    // 休眠中的房间会被唤醒
     std::shared_ptr<Room> getRoom(uint32_t roomId); // 使用完整命名空间
-    void setIoContext(boost::asio::io_context& io);
-    void startCleanupTask();
     uint32_t matchPlayers(const std::vector<uint32_t>& playerIds);
     
     void broadcastMessage(uint32_t roomId, sanguosha::MessageType type, 
-                         const google::protobuf::Message& message, 
-                         Sanguosha::Network::Server& server); // 使用完整命名空间
+                         const google::protobuf::Message& message);
     
     void setServer(Sanguosha::Network::Server& server); // 使用完整命名空间
 
-    std::mutex& getMutex() { return mutex_; }
-    const std::unordered_map<uint32_t, std::shared_ptr<Room>>& getRooms() const { return rooms_; }
+    // 房间列表（包括休眠中的房间，不唤醒）
+    void listRooms(sanguosha::RoomListResponse* response);
 
+    // 按玩家索引查找，休眠中的房间会被唤醒；只需判断玩家在不在房间里时用roomIdOf
     std::shared_ptr<Room> getRoomByPlayerId(uint32_t playerId);
+    // 玩家所在的房间号（包括休眠的房间，不唤醒），不在房间里返回0
+    uint32_t roomIdOf(uint32_t playerId);
+
+    // 断线重连：重新绑定座位会话并补发关键帧
+    void onPlayerReconnected(uint32_t playerId, const std::shared_ptr<Sanguosha::Network::Session>& session);
+    // 重连宽限期已过：等待中的房间直接离开，游戏中判负
+    void onPlayerAbandoned(uint32_t playerId);
+
+    // 停机排空：之后不再建房、入房、开局或补机器人，还没开局的房间直接解散；返回解散的房间数
+    size_t stopMatchmaking();
+    bool acceptingGames() const { return acceptingGames_.load(); }
+    // 热重启交接失败时恢复（已解散的房间不会恢复）
+    void resumeMatchmaking() { acceptingGames_ = true; }
+    // 还在进行中的游戏数（包括休眠中的）
+    size_t activeGameCount();
+    size_t hibernatedRoomCount();
+
+    // 崩溃恢复（见room_journal.h）。启动时先restore再enableJournal，之后房间和游戏的每个变化
+    // 都追加到操作日志，服务器定期调用snapshot()写全量快照。只在io线程上调用
+    // 从目录中恢复房间和游戏，返回恢复的房间数；恢复的玩家按断线处理，宽限期内登录即回到座位
+    size_t restore(const std::string& directory);
+    void enableJournal(const std::string& directory);
+    // 写最后一份快照并等待落盘，之后不再记录
+    void disableJournal();
+    bool journalEnabled() const { return journal_ != nullptr; }
+    void snapshot();
+    // 记录房间当前的完整状态 / 一条游戏事件
+    void journalRoom(Room& room);
+    void journalGameEvent(const sanguosha::RoomJournalRecord& record);
 
 private:
     RoomManager();
     ~RoomManager();
-    void cleanupRooms();
-    
+    void scheduleBotFill(uint32_t roomId);
+    void fillWithBots(uint32_t roomId);
+    void journalClosed(uint32_t roomId);
+    void applyJournalRecord(const sanguosha::RoomJournalRecord& record);
+    // 恢复出的房间：登记进房间表并推进房间号、机器人编号，调用方持有mutex_
+    void adoptRestoredRoom(const sanguosha::RoomSnapshot& snapshot);
+
+    // 休眠：空闲超过hibernateIdleMs的房间（等人的房间，或者正在等一个已断线玩家的游戏）压缩成一条序列化记录，
+    // 释放Room、GameInstance（含随机数状态约7KB）；下一次访问该房间或截止时间到达时再还原。
+    // 以下带Locked后缀的函数由调用方持有mutex_
+    struct HibernatedRoom {
+        std::string record;   // sanguosha::RoomSnapshot
+        // 列房间、匹配时直接用，不必解析record
+        uint32_t capacity = 0;
+        std::vector<uint32_t> players;
+        bool playing = false;
+        std::shared_ptr<const std::vector<char>> stateFrame; // 重连关键帧（广播时已编码好的帧，共享不复制）
+        std::chrono::steady_clock::time_point turnDeadline;
+        std::chrono::steady_clock::time_point responseDeadline;
+        Common::TimerWheel::TimerId wakeTimer = Common::TimerWheel::INVALID_TIMER;
+    };
+    // 活跃的房间直接返回，休眠的先唤醒；不存在返回nullptr
+    std::shared_ptr<Room> findRoomLocked(uint32_t roomId);
+    std::shared_ptr<Room> wakeLocked(uint32_t roomId);
+    void hibernateLocked(const std::shared_ptr<Room>& room);
+    // 空闲检查：每个活跃房间同一时刻只挂一个检查，到期时有过活动就顺延
+    void scheduleIdleCheck(uint32_t roomId, uint64_t activity);
+    void checkIdle(uint32_t roomId, uint64_t activity);
+    // 回收房间：从房间表和玩家索引中移除并记入日志
+    void removeRoomLocked(uint32_t roomId);
+    void indexPlayersLocked(uint32_t roomId, const std::vector<uint32_t>& players);
+
     std::unordered_map<uint32_t, std::shared_ptr<Room>> rooms_;
+    std::unordered_map<uint32_t, HibernatedRoom> hibernated_;
+    // 玩家 -> 所在房间（包括休眠的房间），替代逐个房间扫描
+    std::unordered_map<uint32_t, uint32_t> playerRooms_;
     uint32_t nextRoomId_ = 1;
+    uint32_t nextBotId_ = 0;
+    std::atomic<bool> acceptingGames_{true};
+    std::unique_ptr<RoomJournal> journal_;
     std::mutex mutex_;
-    boost::asio::io_context* io_ = nullptr;
-    std::unique_ptr<boost::asio::steady_timer> cleanupTimer_;
-    
-    static boost::asio::io_context dummy_io_context_;
     
     Sanguosha::Network::Server* serverPtr_ = nullptr; // 使用完整命名空间
 };
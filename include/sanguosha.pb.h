@@ -1,112 +1,166 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: sanguosha.proto
 
-#ifndef PROTOBUF_INCLUDED_sanguosha_2eproto
-#define PROTOBUF_INCLUDED_sanguosha_2eproto
+#ifndef GOOGLE_PROTOBUF_INCLUDED_sanguosha_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_sanguosha_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 3006001
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3006001 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-#define PROTOBUF_INTERNAL_EXPORT_protobuf_sanguosha_2eproto 
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_sanguosha_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
 
-namespace protobuf_sanguosha_2eproto {
 // Internal implementation detail -- do not use these members.
-struct TableStruct {
-  static const ::google::protobuf::internal::ParseTableField entries[];
-  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
-  static const ::google::protobuf::internal::ParseTable schema[13];
-  static const ::google::protobuf::internal::FieldMetadata field_metadata[];
-  static const ::google::protobuf::internal::SerializationTable serialization_table[];
-  static const ::google::protobuf::uint32 offsets[];
+struct TableStruct_sanguosha_2eproto {
+  static const uint32_t offsets[];
 };
-void AddDescriptors();
-}  // namespace protobuf_sanguosha_2eproto
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_sanguosha_2eproto;
 namespace sanguosha {
+class ActionResult;
+struct ActionResultDefaultTypeInternal;
+extern ActionResultDefaultTypeInternal _ActionResult_default_instance_;
 class GameAction;
-class GameActionDefaultTypeInternal;
+struct GameActionDefaultTypeInternal;
 extern GameActionDefaultTypeInternal _GameAction_default_instance_;
 class GameMessage;
-class GameMessageDefaultTypeInternal;
+struct GameMessageDefaultTypeInternal;
 extern GameMessageDefaultTypeInternal _GameMessage_default_instance_;
+class GameMessageBatch;
+struct GameMessageBatchDefaultTypeInternal;
+extern GameMessageBatchDefaultTypeInternal _GameMessageBatch_default_instance_;
 class GameOver;
-class GameOverDefaultTypeInternal;
+struct GameOverDefaultTypeInternal;
 extern GameOverDefaultTypeInternal _GameOver_default_instance_;
+class GameSnapshot;
+struct GameSnapshotDefaultTypeInternal;
+extern GameSnapshotDefaultTypeInternal _GameSnapshot_default_instance_;
 class GameStart;
-class GameStartDefaultTypeInternal;
+struct GameStartDefaultTypeInternal;
 extern GameStartDefaultTypeInternal _GameStart_default_instance_;
 class GameState;
-class GameStateDefaultTypeInternal;
+struct GameStateDefaultTypeInternal;
 extern GameStateDefaultTypeInternal _GameState_default_instance_;
 class Heartbeat;
-class HeartbeatDefaultTypeInternal;
+struct HeartbeatDefaultTypeInternal;
 extern HeartbeatDefaultTypeInternal _Heartbeat_default_instance_;
 class LoginRequest;
-class LoginRequestDefaultTypeInternal;
+struct LoginRequestDefaultTypeInternal;
 extern LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
 class LoginResponse;
-class LoginResponseDefaultTypeInternal;
+struct LoginResponseDefaultTypeInternal;
 extern LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
 class PlayerState;
-class PlayerStateDefaultTypeInternal;
+struct PlayerStateDefaultTypeInternal;
 extern PlayerStateDefaultTypeInternal _PlayerState_default_instance_;
+class ResponsePrompt;
+struct ResponsePromptDefaultTypeInternal;
+extern ResponsePromptDefaultTypeInternal _ResponsePrompt_default_instance_;
 class RoomInfo;
-class RoomInfoDefaultTypeInternal;
+struct RoomInfoDefaultTypeInternal;
 extern RoomInfoDefaultTypeInternal _RoomInfo_default_instance_;
+class RoomJournalRecord;
+struct RoomJournalRecordDefaultTypeInternal;
+extern RoomJournalRecordDefaultTypeInternal _RoomJournalRecord_default_instance_;
 class RoomListResponse;
-class RoomListResponseDefaultTypeInternal;
+struct RoomListResponseDefaultTypeInternal;
 extern RoomListResponseDefaultTypeInternal _RoomListResponse_default_instance_;
+class RoomManagerSnapshot;
+struct RoomManagerSnapshotDefaultTypeInternal;
+extern RoomManagerSnapshotDefaultTypeInternal _RoomManagerSnapshot_default_instance_;
 class RoomRequest;
-class RoomRequestDefaultTypeInternal;
+struct RoomRequestDefaultTypeInternal;
 extern RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
 class RoomResponse;
-class RoomResponseDefaultTypeInternal;
+struct RoomResponseDefaultTypeInternal;
 extern RoomResponseDefaultTypeInternal _RoomResponse_default_instance_;
+class RoomSnapshot;
+struct RoomSnapshotDefaultTypeInternal;
+extern RoomSnapshotDefaultTypeInternal _RoomSnapshot_default_instance_;
 }  // namespace sanguosha
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
+template<> ::sanguosha::ActionResult* Arena::CreateMaybeMessage<::sanguosha::ActionResult>(Arena*);
 template<> ::sanguosha::GameAction* Arena::CreateMaybeMessage<::sanguosha::GameAction>(Arena*);
 template<> ::sanguosha::GameMessage* Arena::CreateMaybeMessage<::sanguosha::GameMessage>(Arena*);
+template<> ::sanguosha::GameMessageBatch* Arena::CreateMaybeMessage<::sanguosha::GameMessageBatch>(Arena*);
 template<> ::sanguosha::GameOver* Arena::CreateMaybeMessage<::sanguosha::GameOver>(Arena*);
+template<> ::sanguosha::GameSnapshot* Arena::CreateMaybeMessage<::sanguosha::GameSnapshot>(Arena*);
 template<> ::sanguosha::GameStart* Arena::CreateMaybeMessage<::sanguosha::GameStart>(Arena*);
 template<> ::sanguosha::GameState* Arena::CreateMaybeMessage<::sanguosha::GameState>(Arena*);
 template<> ::sanguosha::Heartbeat* Arena::CreateMaybeMessage<::sanguosha::Heartbeat>(Arena*);
 template<> ::sanguosha::LoginRequest* Arena::CreateMaybeMessage<::sanguosha::LoginRequest>(Arena*);
 template<> ::sanguosha::LoginResponse* Arena::CreateMaybeMessage<::sanguosha::LoginResponse>(Arena*);
 template<> ::sanguosha::PlayerState* Arena::CreateMaybeMessage<::sanguosha::PlayerState>(Arena*);
+template<> ::sanguosha::ResponsePrompt* Arena::CreateMaybeMessage<::sanguosha::ResponsePrompt>(Arena*);
 template<> ::sanguosha::RoomInfo* Arena::CreateMaybeMessage<::sanguosha::RoomInfo>(Arena*);
+template<> ::sanguosha::RoomJournalRecord* Arena::CreateMaybeMessage<::sanguosha::RoomJournalRecord>(Arena*);
 template<> ::sanguosha::RoomListResponse* Arena::CreateMaybeMessage<::sanguosha::RoomListResponse>(Arena*);
+template<> ::sanguosha::RoomManagerSnapshot* Arena::CreateMaybeMessage<::sanguosha::RoomManagerSnapshot>(Arena*);
 template<> ::sanguosha::RoomRequest* Arena::CreateMaybeMessage<::sanguosha::RoomRequest>(Arena*);
 template<> ::sanguosha::RoomResponse* Arena::CreateMaybeMessage<::sanguosha::RoomResponse>(Arena*);
-}  // namespace protobuf
-}  // namespace google
+template<> ::sanguosha::RoomSnapshot* Arena::CreateMaybeMessage<::sanguosha::RoomSnapshot>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
 namespace sanguosha {
 
-enum MessageType {
+enum RoomJournalRecord_Kind : int {
+  RoomJournalRecord_Kind_ROOM_STATE = 0,
+  RoomJournalRecord_Kind_ROOM_CLOSED = 1,
+  RoomJournalRecord_Kind_GAME_ACTION = 2,
+  RoomJournalRecord_Kind_TURN_TIMEOUT = 3,
+  RoomJournalRecord_Kind_RESPONSE_TIMEOUT = 4,
+  RoomJournalRecord_Kind_FORFEIT = 5,
+  RoomJournalRecord_Kind_RoomJournalRecord_Kind_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RoomJournalRecord_Kind_RoomJournalRecord_Kind_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RoomJournalRecord_Kind_IsValid(int value);
+constexpr RoomJournalRecord_Kind RoomJournalRecord_Kind_Kind_MIN = RoomJournalRecord_Kind_ROOM_STATE;
+constexpr RoomJournalRecord_Kind RoomJournalRecord_Kind_Kind_MAX = RoomJournalRecord_Kind_FORFEIT;
+constexpr int RoomJournalRecord_Kind_Kind_ARRAYSIZE = RoomJournalRecord_Kind_Kind_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomJournalRecord_Kind_descriptor();
+template<typename T>
+inline const std::string& RoomJournalRecord_Kind_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RoomJournalRecord_Kind>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RoomJournalRecord_Kind_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RoomJournalRecord_Kind_descriptor(), enum_t_value);
+}
+inline bool RoomJournalRecord_Kind_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RoomJournalRecord_Kind* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RoomJournalRecord_Kind>(
+    RoomJournalRecord_Kind_descriptor(), name, value);
+}
+enum MessageType : int {
   UNKNOWN = 0,
   LOGIN_REQUEST = 1,
   LOGIN_RESPONSE = 2,
@@ -120,167 +174,264 @@ enum MessageType {
   GAME_STATE_REQUEST = 10,
   ROOM_LIST_REQUEST = 11,
   ROOM_LIST_RESPONSE = 12,
-  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  RESPONSE_PROMPT = 13,
+  BATCH = 14,
+  ACTION_RESULT = 15,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool MessageType_IsValid(int value);
-const MessageType MessageType_MIN = UNKNOWN;
-const MessageType MessageType_MAX = ROOM_LIST_RESPONSE;
-const int MessageType_ARRAYSIZE = MessageType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* MessageType_descriptor();
-inline const ::std::string& MessageType_Name(MessageType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    MessageType_descriptor(), value);
+constexpr MessageType MessageType_MIN = UNKNOWN;
+constexpr MessageType MessageType_MAX = ACTION_RESULT;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
 }
 inline bool MessageType_Parse(
-    const ::std::string& name, MessageType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<MessageType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
     MessageType_descriptor(), name, value);
 }
-enum RoomAction {
+enum Capability : int {
+  CAPABILITY_NONE = 0,
+  CAPABILITY_BATCH = 1,
+  CAPABILITY_COMPACT = 2,
+  CAPABILITY_COMPRESS = 4,
+  Capability_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Capability_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Capability_IsValid(int value);
+constexpr Capability Capability_MIN = CAPABILITY_NONE;
+constexpr Capability Capability_MAX = CAPABILITY_COMPRESS;
+constexpr int Capability_ARRAYSIZE = Capability_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Capability_descriptor();
+template<typename T>
+inline const std::string& Capability_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Capability>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Capability_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Capability_descriptor(), enum_t_value);
+}
+inline bool Capability_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Capability* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Capability>(
+    Capability_descriptor(), name, value);
+}
+enum RoomAction : int {
   CREATE_ROOM = 0,
   JOIN_ROOM = 1,
   LEAVE_ROOM = 2,
   START_GAME = 3,
-  RoomAction_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  RoomAction_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  RoomAction_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RoomAction_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RoomAction_IsValid(int value);
-const RoomAction RoomAction_MIN = CREATE_ROOM;
-const RoomAction RoomAction_MAX = START_GAME;
-const int RoomAction_ARRAYSIZE = RoomAction_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* RoomAction_descriptor();
-inline const ::std::string& RoomAction_Name(RoomAction value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    RoomAction_descriptor(), value);
+constexpr RoomAction RoomAction_MIN = CREATE_ROOM;
+constexpr RoomAction RoomAction_MAX = START_GAME;
+constexpr int RoomAction_ARRAYSIZE = RoomAction_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomAction_descriptor();
+template<typename T>
+inline const std::string& RoomAction_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RoomAction>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RoomAction_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RoomAction_descriptor(), enum_t_value);
 }
 inline bool RoomAction_Parse(
-    const ::std::string& name, RoomAction* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<RoomAction>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RoomAction* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RoomAction>(
     RoomAction_descriptor(), name, value);
 }
-enum RoomStatus {
+enum RoomStatus : int {
   WAITING = 0,
   PLAYING = 1,
-  RoomStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  RoomStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  RoomStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RoomStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool RoomStatus_IsValid(int value);
-const RoomStatus RoomStatus_MIN = WAITING;
-const RoomStatus RoomStatus_MAX = PLAYING;
-const int RoomStatus_ARRAYSIZE = RoomStatus_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* RoomStatus_descriptor();
-inline const ::std::string& RoomStatus_Name(RoomStatus value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    RoomStatus_descriptor(), value);
+constexpr RoomStatus RoomStatus_MIN = WAITING;
+constexpr RoomStatus RoomStatus_MAX = PLAYING;
+constexpr int RoomStatus_ARRAYSIZE = RoomStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RoomStatus_descriptor();
+template<typename T>
+inline const std::string& RoomStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RoomStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RoomStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RoomStatus_descriptor(), enum_t_value);
 }
 inline bool RoomStatus_Parse(
-    const ::std::string& name, RoomStatus* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<RoomStatus>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RoomStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RoomStatus>(
     RoomStatus_descriptor(), name, value);
 }
-enum CardType {
+enum CardType : int {
   CARD_UNKNOWN = 0,
   CARD_ATTACK = 1,
   CARD_DEFEND = 2,
   CARD_HEAL = 3,
-  CardType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  CardType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  CardType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  CardType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool CardType_IsValid(int value);
-const CardType CardType_MIN = CARD_UNKNOWN;
-const CardType CardType_MAX = CARD_HEAL;
-const int CardType_ARRAYSIZE = CardType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* CardType_descriptor();
-inline const ::std::string& CardType_Name(CardType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    CardType_descriptor(), value);
+constexpr CardType CardType_MIN = CARD_UNKNOWN;
+constexpr CardType CardType_MAX = CARD_HEAL;
+constexpr int CardType_ARRAYSIZE = CardType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* CardType_descriptor();
+template<typename T>
+inline const std::string& CardType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, CardType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function CardType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    CardType_descriptor(), enum_t_value);
 }
 inline bool CardType_Parse(
-    const ::std::string& name, CardType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<CardType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, CardType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<CardType>(
     CardType_descriptor(), name, value);
 }
-enum GamePhase {
+enum GamePhase : int {
   PHASE_UNKNOWN = 0,
   DRAW_PHASE = 1,
   PLAY_PHASE = 2,
   DISCARD_PHASE = 3,
-  GamePhase_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  GamePhase_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  RESPONSE_PHASE = 4,
+  GamePhase_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  GamePhase_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool GamePhase_IsValid(int value);
-const GamePhase GamePhase_MIN = PHASE_UNKNOWN;
-const GamePhase GamePhase_MAX = DISCARD_PHASE;
-const int GamePhase_ARRAYSIZE = GamePhase_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* GamePhase_descriptor();
-inline const ::std::string& GamePhase_Name(GamePhase value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    GamePhase_descriptor(), value);
+constexpr GamePhase GamePhase_MIN = PHASE_UNKNOWN;
+constexpr GamePhase GamePhase_MAX = RESPONSE_PHASE;
+constexpr int GamePhase_ARRAYSIZE = GamePhase_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* GamePhase_descriptor();
+template<typename T>
+inline const std::string& GamePhase_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, GamePhase>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function GamePhase_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    GamePhase_descriptor(), enum_t_value);
 }
 inline bool GamePhase_Parse(
-    const ::std::string& name, GamePhase* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<GamePhase>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, GamePhase* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<GamePhase>(
     GamePhase_descriptor(), name, value);
 }
-enum ActionType {
+enum ActionType : int {
   ACTION_PLAY_CARD = 0,
   ACTION_END_TURN = 1,
-  ActionType_INT_MIN_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32min,
-  ActionType_INT_MAX_SENTINEL_DO_NOT_USE_ = ::google::protobuf::kint32max
+  ACTION_RESPOND = 2,
+  ActionType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  ActionType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ActionType_IsValid(int value);
-const ActionType ActionType_MIN = ACTION_PLAY_CARD;
-const ActionType ActionType_MAX = ACTION_END_TURN;
-const int ActionType_ARRAYSIZE = ActionType_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ActionType_descriptor();
-inline const ::std::string& ActionType_Name(ActionType value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ActionType_descriptor(), value);
+constexpr ActionType ActionType_MIN = ACTION_PLAY_CARD;
+constexpr ActionType ActionType_MAX = ACTION_RESPOND;
+constexpr int ActionType_ARRAYSIZE = ActionType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ActionType_descriptor();
+template<typename T>
+inline const std::string& ActionType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ActionType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ActionType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ActionType_descriptor(), enum_t_value);
 }
 inline bool ActionType_Parse(
-    const ::std::string& name, ActionType* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ActionType>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ActionType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ActionType>(
     ActionType_descriptor(), name, value);
 }
+enum Role : int {
+  ROLE_NONE = 0,
+  ROLE_LORD = 1,
+  ROLE_LOYALIST = 2,
+  ROLE_REBEL = 3,
+  ROLE_RENEGADE = 4,
+  Role_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Role_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Role_IsValid(int value);
+constexpr Role Role_MIN = ROLE_NONE;
+constexpr Role Role_MAX = ROLE_RENEGADE;
+constexpr int Role_ARRAYSIZE = Role_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Role_descriptor();
+template<typename T>
+inline const std::string& Role_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Role>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Role_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Role_descriptor(), enum_t_value);
+}
+inline bool Role_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Role* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Role>(
+    Role_descriptor(), name, value);
+}
 // ===================================================================
 
-class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginRequest) */ {
+class LoginRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginRequest) */ {
  public:
-  LoginRequest();
-  virtual ~LoginRequest();
+  inline LoginRequest() : LoginRequest(nullptr) {}
+  ~LoginRequest() override;
+  explicit PROTOBUF_CONSTEXPR LoginRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginRequest(const LoginRequest& from);
-
-  inline LoginRequest& operator=(const LoginRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LoginRequest(LoginRequest&& from) noexcept
     : LoginRequest() {
     *this = ::std::move(from);
   }
 
+  inline LoginRequest& operator=(const LoginRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LoginRequest& operator=(LoginRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LoginRequest* internal_default_instance() {
     return reinterpret_cast<const LoginRequest*>(
                &_LoginRequest_default_instance_);
@@ -288,125 +439,195 @@ class LoginRequest : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     0;
 
-  void Swap(LoginRequest* other);
   friend void swap(LoginRequest& a, LoginRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(LoginRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginRequest* New() const final {
-    return CreateMaybeMessage<LoginRequest>(NULL);
-  }
-
-  LoginRequest* New(::google::protobuf::Arena* arena) const final {
+  LoginRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginRequest& from);
-  void MergeFrom(const LoginRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginRequest& from) {
+    LoginRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.LoginRequest";
   }
+  protected:
+  explicit LoginRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kPasswordFieldNumber = 2,
+    kResumeTokenFieldNumber = 3,
+    kCapabilitiesFieldNumber = 4,
+  };
   // string username = 1;
   void clear_username();
-  static const int kUsernameFieldNumber = 1;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // string password = 2;
   void clear_password();
-  static const int kPasswordFieldNumber = 2;
-  const ::std::string& password() const;
-  void set_password(const ::std::string& value);
-  #if LANG_CXX11
-  void set_password(::std::string&& value);
-  #endif
-  void set_password(const char* value);
-  void set_password(const char* value, size_t size);
-  ::std::string* mutable_password();
-  ::std::string* release_password();
-  void set_allocated_password(::std::string* password);
+  const std::string& password() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_password(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_password();
+  PROTOBUF_NODISCARD std::string* release_password();
+  void set_allocated_password(std::string* password);
+  private:
+  const std::string& _internal_password() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_password(const std::string& value);
+  std::string* _internal_mutable_password();
+  public:
+
+  // string resume_token = 3;
+  void clear_resume_token();
+  const std::string& resume_token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_token();
+  PROTOBUF_NODISCARD std::string* release_resume_token();
+  void set_allocated_resume_token(std::string* resume_token);
+  private:
+  const std::string& _internal_resume_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_token(const std::string& value);
+  std::string* _internal_mutable_resume_token();
+  public:
+
+  // uint32 capabilities = 4;
+  void clear_capabilities();
+  uint32_t capabilities() const;
+  void set_capabilities(uint32_t value);
+  private:
+  uint32_t _internal_capabilities() const;
+  void _internal_set_capabilities(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.LoginRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::internal::ArenaStringPtr password_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr password_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_token_;
+    uint32_t capabilities_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginResponse) */ {
+class LoginResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.LoginResponse) */ {
  public:
-  LoginResponse();
-  virtual ~LoginResponse();
+  inline LoginResponse() : LoginResponse(nullptr) {}
+  ~LoginResponse() override;
+  explicit PROTOBUF_CONSTEXPR LoginResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   LoginResponse(const LoginResponse& from);
-
-  inline LoginResponse& operator=(const LoginResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   LoginResponse(LoginResponse&& from) noexcept
     : LoginResponse() {
     *this = ::std::move(from);
   }
 
+  inline LoginResponse& operator=(const LoginResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline LoginResponse& operator=(LoginResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const LoginResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LoginResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const LoginResponse* internal_default_instance() {
     return reinterpret_cast<const LoginResponse*>(
                &_LoginResponse_default_instance_);
@@ -414,124 +635,245 @@ class LoginResponse : public ::google::protobuf::Message /* @@protoc_insertion_p
   static constexpr int kIndexInFileMessages =
     1;
 
-  void Swap(LoginResponse* other);
   friend void swap(LoginResponse& a, LoginResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(LoginResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LoginResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline LoginResponse* New() const final {
-    return CreateMaybeMessage<LoginResponse>(NULL);
-  }
-
-  LoginResponse* New(::google::protobuf::Arena* arena) const final {
+  LoginResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<LoginResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const LoginResponse& from);
-  void MergeFrom(const LoginResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LoginResponse& from) {
+    LoginResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(LoginResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.LoginResponse";
   }
+  protected:
+  explicit LoginResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 2,
+    kResumeTokenFieldNumber = 4,
+    kUserIdFieldNumber = 3,
+    kSuccessFieldNumber = 1,
+    kResumedFieldNumber = 5,
+    kRoomIdFieldNumber = 6,
+    kRetryAfterMsFieldNumber = 7,
+    kCapabilitiesFieldNumber = 8,
+    kDictionaryIdFieldNumber = 9,
+  };
   // string error_message = 2;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 2;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
+
+  // string resume_token = 4;
+  void clear_resume_token();
+  const std::string& resume_token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_token();
+  PROTOBUF_NODISCARD std::string* release_resume_token();
+  void set_allocated_resume_token(std::string* resume_token);
+  private:
+  const std::string& _internal_resume_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_token(const std::string& value);
+  std::string* _internal_mutable_resume_token();
+  public:
+
+  // uint32 user_id = 3;
+  void clear_user_id();
+  uint32_t user_id() const;
+  void set_user_id(uint32_t value);
+  private:
+  uint32_t _internal_user_id() const;
+  void _internal_set_user_id(uint32_t value);
+  public:
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
-  // uint32 user_id = 3;
-  void clear_user_id();
-  static const int kUserIdFieldNumber = 3;
-  ::google::protobuf::uint32 user_id() const;
-  void set_user_id(::google::protobuf::uint32 value);
+  // bool resumed = 5;
+  void clear_resumed();
+  bool resumed() const;
+  void set_resumed(bool value);
+  private:
+  bool _internal_resumed() const;
+  void _internal_set_resumed(bool value);
+  public:
+
+  // uint32 room_id = 6;
+  void clear_room_id();
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
+
+  // uint32 retry_after_ms = 7;
+  void clear_retry_after_ms();
+  uint32_t retry_after_ms() const;
+  void set_retry_after_ms(uint32_t value);
+  private:
+  uint32_t _internal_retry_after_ms() const;
+  void _internal_set_retry_after_ms(uint32_t value);
+  public:
+
+  // uint32 capabilities = 8;
+  void clear_capabilities();
+  uint32_t capabilities() const;
+  void set_capabilities(uint32_t value);
+  private:
+  uint32_t _internal_capabilities() const;
+  void _internal_set_capabilities(uint32_t value);
+  public:
+
+  // uint32 dictionary_id = 9;
+  void clear_dictionary_id();
+  uint32_t dictionary_id() const;
+  void set_dictionary_id(uint32_t value);
+  private:
+  uint32_t _internal_dictionary_id() const;
+  void _internal_set_dictionary_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.LoginResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  bool success_;
-  ::google::protobuf::uint32 user_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_token_;
+    uint32_t user_id_;
+    bool success_;
+    bool resumed_;
+    uint32_t room_id_;
+    uint32_t retry_after_ms_;
+    uint32_t capabilities_;
+    uint32_t dictionary_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.Heartbeat) */ {
+class Heartbeat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.Heartbeat) */ {
  public:
-  Heartbeat();
-  virtual ~Heartbeat();
+  inline Heartbeat() : Heartbeat(nullptr) {}
+  ~Heartbeat() override;
+  explicit PROTOBUF_CONSTEXPR Heartbeat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Heartbeat(const Heartbeat& from);
-
-  inline Heartbeat& operator=(const Heartbeat& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   Heartbeat(Heartbeat&& from) noexcept
     : Heartbeat() {
     *this = ::std::move(from);
   }
 
+  inline Heartbeat& operator=(const Heartbeat& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline Heartbeat& operator=(Heartbeat&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Heartbeat& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Heartbeat& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const Heartbeat* internal_default_instance() {
     return reinterpret_cast<const Heartbeat*>(
                &_Heartbeat_default_instance_);
@@ -539,102 +881,147 @@ class Heartbeat : public ::google::protobuf::Message /* @@protoc_insertion_point
   static constexpr int kIndexInFileMessages =
     2;
 
-  void Swap(Heartbeat* other);
   friend void swap(Heartbeat& a, Heartbeat& b) {
     a.Swap(&b);
   }
+  inline void Swap(Heartbeat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Heartbeat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline Heartbeat* New() const final {
-    return CreateMaybeMessage<Heartbeat>(NULL);
-  }
-
-  Heartbeat* New(::google::protobuf::Arena* arena) const final {
+  Heartbeat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<Heartbeat>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Heartbeat& from);
-  void MergeFrom(const Heartbeat& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Heartbeat& from) {
+    Heartbeat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Heartbeat* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.Heartbeat";
   }
+  protected:
+  explicit Heartbeat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTimestampFieldNumber = 1,
+  };
   // uint64 timestamp = 1;
   void clear_timestamp();
-  static const int kTimestampFieldNumber = 1;
-  ::google::protobuf::uint64 timestamp() const;
-  void set_timestamp(::google::protobuf::uint64 value);
+  uint64_t timestamp() const;
+  void set_timestamp(uint64_t value);
+  private:
+  uint64_t _internal_timestamp() const;
+  void _internal_set_timestamp(uint64_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.Heartbeat)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint64 timestamp_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomInfo) */ {
+class RoomInfo final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomInfo) */ {
  public:
-  RoomInfo();
-  virtual ~RoomInfo();
+  inline RoomInfo() : RoomInfo(nullptr) {}
+  ~RoomInfo() override;
+  explicit PROTOBUF_CONSTEXPR RoomInfo(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomInfo(const RoomInfo& from);
-
-  inline RoomInfo& operator=(const RoomInfo& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomInfo(RoomInfo&& from) noexcept
     : RoomInfo() {
     *this = ::std::move(from);
   }
 
+  inline RoomInfo& operator=(const RoomInfo& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomInfo& operator=(RoomInfo&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomInfo& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomInfo& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomInfo* internal_default_instance() {
     return reinterpret_cast<const RoomInfo*>(
                &_RoomInfo_default_instance_);
@@ -642,137 +1029,205 @@ class RoomInfo : public ::google::protobuf::Message /* @@protoc_insertion_point(
   static constexpr int kIndexInFileMessages =
     3;
 
-  void Swap(RoomInfo* other);
   friend void swap(RoomInfo& a, RoomInfo& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomInfo* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomInfo* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomInfo* New() const final {
-    return CreateMaybeMessage<RoomInfo>(NULL);
-  }
-
-  RoomInfo* New(::google::protobuf::Arena* arena) const final {
+  RoomInfo* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomInfo>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomInfo& from);
-  void MergeFrom(const RoomInfo& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomInfo& from) {
+    RoomInfo::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomInfo* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomInfo";
   }
+  protected:
+  explicit RoomInfo(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPlayersFieldNumber = 2,
+    kRoomIdFieldNumber = 1,
+    kCurrentPlayersFieldNumber = 3,
+    kMaxPlayersFieldNumber = 4,
+    kStatusFieldNumber = 5,
+  };
   // repeated uint32 players = 2;
   int players_size() const;
+  private:
+  int _internal_players_size() const;
+  public:
   void clear_players();
-  static const int kPlayersFieldNumber = 2;
-  ::google::protobuf::uint32 players(int index) const;
-  void set_players(int index, ::google::protobuf::uint32 value);
-  void add_players(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_players(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_players() const;
+  void _internal_add_players(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_players();
+  public:
+  uint32_t players(int index) const;
+  void set_players(int index, uint32_t value);
+  void add_players(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       players() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_players();
 
   // uint32 room_id = 1;
   void clear_room_id();
-  static const int kRoomIdFieldNumber = 1;
-  ::google::protobuf::uint32 room_id() const;
-  void set_room_id(::google::protobuf::uint32 value);
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
 
   // uint32 current_players = 3;
   void clear_current_players();
-  static const int kCurrentPlayersFieldNumber = 3;
-  ::google::protobuf::uint32 current_players() const;
-  void set_current_players(::google::protobuf::uint32 value);
+  uint32_t current_players() const;
+  void set_current_players(uint32_t value);
+  private:
+  uint32_t _internal_current_players() const;
+  void _internal_set_current_players(uint32_t value);
+  public:
 
   // uint32 max_players = 4;
   void clear_max_players();
-  static const int kMaxPlayersFieldNumber = 4;
-  ::google::protobuf::uint32 max_players() const;
-  void set_max_players(::google::protobuf::uint32 value);
+  uint32_t max_players() const;
+  void set_max_players(uint32_t value);
+  private:
+  uint32_t _internal_max_players() const;
+  void _internal_set_max_players(uint32_t value);
+  public:
 
   // .sanguosha.RoomStatus status = 5;
   void clear_status();
-  static const int kStatusFieldNumber = 5;
   ::sanguosha::RoomStatus status() const;
   void set_status(::sanguosha::RoomStatus value);
+  private:
+  ::sanguosha::RoomStatus _internal_status() const;
+  void _internal_set_status(::sanguosha::RoomStatus value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomInfo)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > players_;
-  mutable int _players_cached_byte_size_;
-  ::google::protobuf::uint32 room_id_;
-  ::google::protobuf::uint32 current_players_;
-  ::google::protobuf::uint32 max_players_;
-  int status_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > players_;
+    mutable std::atomic<int> _players_cached_byte_size_;
+    uint32_t room_id_;
+    uint32_t current_players_;
+    uint32_t max_players_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomRequest : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomRequest) */ {
+class RoomRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomRequest) */ {
  public:
-  RoomRequest();
-  virtual ~RoomRequest();
+  inline RoomRequest() : RoomRequest(nullptr) {}
+  ~RoomRequest() override;
+  explicit PROTOBUF_CONSTEXPR RoomRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomRequest(const RoomRequest& from);
-
-  inline RoomRequest& operator=(const RoomRequest& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomRequest(RoomRequest&& from) noexcept
     : RoomRequest() {
     *this = ::std::move(from);
   }
 
+  inline RoomRequest& operator=(const RoomRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomRequest& operator=(RoomRequest&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomRequest& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomRequest& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomRequest* internal_default_instance() {
     return reinterpret_cast<const RoomRequest*>(
                &_RoomRequest_default_instance_);
@@ -780,109 +1235,169 @@ class RoomRequest : public ::google::protobuf::Message /* @@protoc_insertion_poi
   static constexpr int kIndexInFileMessages =
     4;
 
-  void Swap(RoomRequest* other);
   friend void swap(RoomRequest& a, RoomRequest& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomRequest* New() const final {
-    return CreateMaybeMessage<RoomRequest>(NULL);
-  }
-
-  RoomRequest* New(::google::protobuf::Arena* arena) const final {
+  RoomRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomRequest>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomRequest& from);
-  void MergeFrom(const RoomRequest& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomRequest& from) {
+    RoomRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomRequest* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomRequest";
   }
+  protected:
+  explicit RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kActionFieldNumber = 1,
+    kRoomIdFieldNumber = 2,
+    kMaxPlayersFieldNumber = 3,
+  };
   // .sanguosha.RoomAction action = 1;
   void clear_action();
-  static const int kActionFieldNumber = 1;
   ::sanguosha::RoomAction action() const;
   void set_action(::sanguosha::RoomAction value);
+  private:
+  ::sanguosha::RoomAction _internal_action() const;
+  void _internal_set_action(::sanguosha::RoomAction value);
+  public:
 
   // uint32 room_id = 2;
   void clear_room_id();
-  static const int kRoomIdFieldNumber = 2;
-  ::google::protobuf::uint32 room_id() const;
-  void set_room_id(::google::protobuf::uint32 value);
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
+
+  // uint32 max_players = 3;
+  void clear_max_players();
+  uint32_t max_players() const;
+  void set_max_players(uint32_t value);
+  private:
+  uint32_t _internal_max_players() const;
+  void _internal_set_max_players(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomRequest)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int action_;
-  ::google::protobuf::uint32 room_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int action_;
+    uint32_t room_id_;
+    uint32_t max_players_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomResponse) */ {
+class RoomResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomResponse) */ {
  public:
-  RoomResponse();
-  virtual ~RoomResponse();
+  inline RoomResponse() : RoomResponse(nullptr) {}
+  ~RoomResponse() override;
+  explicit PROTOBUF_CONSTEXPR RoomResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomResponse(const RoomResponse& from);
-
-  inline RoomResponse& operator=(const RoomResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomResponse(RoomResponse&& from) noexcept
     : RoomResponse() {
     *this = ::std::move(from);
   }
 
+  inline RoomResponse& operator=(const RoomResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline RoomResponse& operator=(RoomResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomResponse* internal_default_instance() {
     return reinterpret_cast<const RoomResponse*>(
                &_RoomResponse_default_instance_);
@@ -890,130 +1405,183 @@ class RoomResponse : public ::google::protobuf::Message /* @@protoc_insertion_po
   static constexpr int kIndexInFileMessages =
     5;
 
-  void Swap(RoomResponse* other);
   friend void swap(RoomResponse& a, RoomResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomResponse* New() const final {
-    return CreateMaybeMessage<RoomResponse>(NULL);
-  }
-
-  RoomResponse* New(::google::protobuf::Arena* arena) const final {
+  RoomResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomResponse& from);
-  void MergeFrom(const RoomResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomResponse& from) {
+    RoomResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomResponse";
   }
+  protected:
+  explicit RoomResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kErrorMessageFieldNumber = 2,
+    kRoomInfoFieldNumber = 3,
+    kSuccessFieldNumber = 1,
+  };
   // string error_message = 2;
   void clear_error_message();
-  static const int kErrorMessageFieldNumber = 2;
-  const ::std::string& error_message() const;
-  void set_error_message(const ::std::string& value);
-  #if LANG_CXX11
-  void set_error_message(::std::string&& value);
-  #endif
-  void set_error_message(const char* value);
-  void set_error_message(const char* value, size_t size);
-  ::std::string* mutable_error_message();
-  ::std::string* release_error_message();
-  void set_allocated_error_message(::std::string* error_message);
+  const std::string& error_message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_message();
+  PROTOBUF_NODISCARD std::string* release_error_message();
+  void set_allocated_error_message(std::string* error_message);
+  private:
+  const std::string& _internal_error_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_message(const std::string& value);
+  std::string* _internal_mutable_error_message();
+  public:
 
   // .sanguosha.RoomInfo room_info = 3;
   bool has_room_info() const;
-  void clear_room_info();
-  static const int kRoomInfoFieldNumber = 3;
   private:
-  const ::sanguosha::RoomInfo& _internal_room_info() const;
+  bool _internal_has_room_info() const;
   public:
+  void clear_room_info();
   const ::sanguosha::RoomInfo& room_info() const;
-  ::sanguosha::RoomInfo* release_room_info();
+  PROTOBUF_NODISCARD ::sanguosha::RoomInfo* release_room_info();
   ::sanguosha::RoomInfo* mutable_room_info();
   void set_allocated_room_info(::sanguosha::RoomInfo* room_info);
+  private:
+  const ::sanguosha::RoomInfo& _internal_room_info() const;
+  ::sanguosha::RoomInfo* _internal_mutable_room_info();
+  public:
+  void unsafe_arena_set_allocated_room_info(
+      ::sanguosha::RoomInfo* room_info);
+  ::sanguosha::RoomInfo* unsafe_arena_release_room_info();
 
   // bool success = 1;
   void clear_success();
-  static const int kSuccessFieldNumber = 1;
   bool success() const;
   void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::internal::ArenaStringPtr error_message_;
-  ::sanguosha::RoomInfo* room_info_;
-  bool success_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_message_;
+    ::sanguosha::RoomInfo* room_info_;
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class RoomListResponse : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomListResponse) */ {
+class RoomListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomListResponse) */ {
  public:
-  RoomListResponse();
-  virtual ~RoomListResponse();
+  inline RoomListResponse() : RoomListResponse(nullptr) {}
+  ~RoomListResponse() override;
+  explicit PROTOBUF_CONSTEXPR RoomListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   RoomListResponse(const RoomListResponse& from);
-
-  inline RoomListResponse& operator=(const RoomListResponse& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   RoomListResponse(RoomListResponse&& from) noexcept
     : RoomListResponse() {
     *this = ::std::move(from);
   }
 
-  inline RoomListResponse& operator=(RoomListResponse&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline RoomListResponse& operator=(const RoomListResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomListResponse& operator=(RoomListResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const RoomListResponse& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomListResponse& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const RoomListResponse* internal_default_instance() {
     return reinterpret_cast<const RoomListResponse*>(
                &_RoomListResponse_default_instance_);
@@ -1021,108 +1589,156 @@ class RoomListResponse : public ::google::protobuf::Message /* @@protoc_insertio
   static constexpr int kIndexInFileMessages =
     6;
 
-  void Swap(RoomListResponse* other);
   friend void swap(RoomListResponse& a, RoomListResponse& b) {
     a.Swap(&b);
   }
+  inline void Swap(RoomListResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomListResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline RoomListResponse* New() const final {
-    return CreateMaybeMessage<RoomListResponse>(NULL);
-  }
-
-  RoomListResponse* New(::google::protobuf::Arena* arena) const final {
+  RoomListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<RoomListResponse>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const RoomListResponse& from);
-  void MergeFrom(const RoomListResponse& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomListResponse& from) {
+    RoomListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(RoomListResponse* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomListResponse";
   }
+  protected:
+  explicit RoomListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kRoomsFieldNumber = 1,
+  };
   // repeated .sanguosha.RoomInfo rooms = 1;
   int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
   void clear_rooms();
-  static const int kRoomsFieldNumber = 1;
   ::sanguosha::RoomInfo* mutable_rooms(int index);
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >*
       mutable_rooms();
+  private:
+  const ::sanguosha::RoomInfo& _internal_rooms(int index) const;
+  ::sanguosha::RoomInfo* _internal_add_rooms();
+  public:
   const ::sanguosha::RoomInfo& rooms(int index) const;
   ::sanguosha::RoomInfo* add_rooms();
-  const ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >&
       rooms() const;
 
   // @@protoc_insertion_point(class_scope:sanguosha.RoomListResponse)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo > rooms_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo > rooms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameAction : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameAction) */ {
+class GameAction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameAction) */ {
  public:
-  GameAction();
-  virtual ~GameAction();
+  inline GameAction() : GameAction(nullptr) {}
+  ~GameAction() override;
+  explicit PROTOBUF_CONSTEXPR GameAction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameAction(const GameAction& from);
-
-  inline GameAction& operator=(const GameAction& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameAction(GameAction&& from) noexcept
     : GameAction() {
     *this = ::std::move(from);
   }
 
+  inline GameAction& operator=(const GameAction& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameAction& operator=(GameAction&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameAction& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameAction& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GameAction* internal_default_instance() {
     return reinterpret_cast<const GameAction*>(
                &_GameAction_default_instance_);
@@ -1130,516 +1746,973 @@ class GameAction : public ::google::protobuf::Message /* @@protoc_insertion_poin
   static constexpr int kIndexInFileMessages =
     7;
 
-  void Swap(GameAction* other);
   friend void swap(GameAction& a, GameAction& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameAction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameAction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameAction* New() const final {
-    return CreateMaybeMessage<GameAction>(NULL);
-  }
-
-  GameAction* New(::google::protobuf::Arena* arena) const final {
+  GameAction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameAction>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameAction& from);
-  void MergeFrom(const GameAction& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameAction& from) {
+    GameAction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameAction* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameAction";
   }
+  protected:
+  explicit GameAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTypeFieldNumber = 1,
+    kCardIdFieldNumber = 2,
+    kTargetPlayerFieldNumber = 3,
+    kPromptIdFieldNumber = 4,
+  };
   // .sanguosha.ActionType type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::sanguosha::ActionType type() const;
   void set_type(::sanguosha::ActionType value);
+  private:
+  ::sanguosha::ActionType _internal_type() const;
+  void _internal_set_type(::sanguosha::ActionType value);
+  public:
 
   // uint32 card_id = 2;
   void clear_card_id();
-  static const int kCardIdFieldNumber = 2;
-  ::google::protobuf::uint32 card_id() const;
-  void set_card_id(::google::protobuf::uint32 value);
+  uint32_t card_id() const;
+  void set_card_id(uint32_t value);
+  private:
+  uint32_t _internal_card_id() const;
+  void _internal_set_card_id(uint32_t value);
+  public:
 
   // uint32 target_player = 3;
   void clear_target_player();
-  static const int kTargetPlayerFieldNumber = 3;
-  ::google::protobuf::uint32 target_player() const;
-  void set_target_player(::google::protobuf::uint32 value);
+  uint32_t target_player() const;
+  void set_target_player(uint32_t value);
+  private:
+  uint32_t _internal_target_player() const;
+  void _internal_set_target_player(uint32_t value);
+  public:
+
+  // uint32 prompt_id = 4;
+  void clear_prompt_id();
+  uint32_t prompt_id() const;
+  void set_prompt_id(uint32_t value);
+  private:
+  uint32_t _internal_prompt_id() const;
+  void _internal_set_prompt_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.GameAction)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int type_;
-  ::google::protobuf::uint32 card_id_;
-  ::google::protobuf::uint32 target_player_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int type_;
+    uint32_t card_id_;
+    uint32_t target_player_;
+    uint32_t prompt_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class PlayerState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.PlayerState) */ {
+class ResponsePrompt final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.ResponsePrompt) */ {
  public:
-  PlayerState();
-  virtual ~PlayerState();
+  inline ResponsePrompt() : ResponsePrompt(nullptr) {}
+  ~ResponsePrompt() override;
+  explicit PROTOBUF_CONSTEXPR ResponsePrompt(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  PlayerState(const PlayerState& from);
+  ResponsePrompt(const ResponsePrompt& from);
+  ResponsePrompt(ResponsePrompt&& from) noexcept
+    : ResponsePrompt() {
+    *this = ::std::move(from);
+  }
 
-  inline PlayerState& operator=(const PlayerState& from) {
+  inline ResponsePrompt& operator=(const ResponsePrompt& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
+  inline ResponsePrompt& operator=(ResponsePrompt&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResponsePrompt& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResponsePrompt* internal_default_instance() {
+    return reinterpret_cast<const ResponsePrompt*>(
+               &_ResponsePrompt_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(ResponsePrompt& a, ResponsePrompt& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResponsePrompt* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResponsePrompt* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResponsePrompt* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResponsePrompt>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResponsePrompt& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponsePrompt& from) {
+    ResponsePrompt::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResponsePrompt* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.ResponsePrompt";
+  }
+  protected:
+  explicit ResponsePrompt(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPromptIdFieldNumber = 1,
+    kCardTypeFieldNumber = 2,
+    kSourcePlayerFieldNumber = 3,
+    kTimeoutMsFieldNumber = 4,
+  };
+  // uint32 prompt_id = 1;
+  void clear_prompt_id();
+  uint32_t prompt_id() const;
+  void set_prompt_id(uint32_t value);
+  private:
+  uint32_t _internal_prompt_id() const;
+  void _internal_set_prompt_id(uint32_t value);
+  public:
+
+  // .sanguosha.CardType card_type = 2;
+  void clear_card_type();
+  ::sanguosha::CardType card_type() const;
+  void set_card_type(::sanguosha::CardType value);
+  private:
+  ::sanguosha::CardType _internal_card_type() const;
+  void _internal_set_card_type(::sanguosha::CardType value);
+  public:
+
+  // uint32 source_player = 3;
+  void clear_source_player();
+  uint32_t source_player() const;
+  void set_source_player(uint32_t value);
+  private:
+  uint32_t _internal_source_player() const;
+  void _internal_set_source_player(uint32_t value);
+  public:
+
+  // uint32 timeout_ms = 4;
+  void clear_timeout_ms();
+  uint32_t timeout_ms() const;
+  void set_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_timeout_ms() const;
+  void _internal_set_timeout_ms(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.ResponsePrompt)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t prompt_id_;
+    int card_type_;
+    uint32_t source_player_;
+    uint32_t timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PlayerState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.PlayerState) */ {
+ public:
+  inline PlayerState() : PlayerState(nullptr) {}
+  ~PlayerState() override;
+  explicit PROTOBUF_CONSTEXPR PlayerState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PlayerState(const PlayerState& from);
   PlayerState(PlayerState&& from) noexcept
     : PlayerState() {
     *this = ::std::move(from);
   }
 
+  inline PlayerState& operator=(const PlayerState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline PlayerState& operator=(PlayerState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const PlayerState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PlayerState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const PlayerState* internal_default_instance() {
     return reinterpret_cast<const PlayerState*>(
                &_PlayerState_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  void Swap(PlayerState* other);
   friend void swap(PlayerState& a, PlayerState& b) {
     a.Swap(&b);
   }
+  inline void Swap(PlayerState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PlayerState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline PlayerState* New() const final {
-    return CreateMaybeMessage<PlayerState>(NULL);
-  }
-
-  PlayerState* New(::google::protobuf::Arena* arena) const final {
+  PlayerState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<PlayerState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const PlayerState& from);
-  void MergeFrom(const PlayerState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PlayerState& from) {
+    PlayerState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(PlayerState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.PlayerState";
   }
+  protected:
+  explicit PlayerState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kHandCardsFieldNumber = 5,
+    kUsernameFieldNumber = 2,
+    kPlayerIdFieldNumber = 1,
+    kHpFieldNumber = 3,
+    kMaxHpFieldNumber = 4,
+    kRoleFieldNumber = 6,
+    kSeatFieldNumber = 7,
+  };
   // repeated uint32 hand_cards = 5;
   int hand_cards_size() const;
+  private:
+  int _internal_hand_cards_size() const;
+  public:
   void clear_hand_cards();
-  static const int kHandCardsFieldNumber = 5;
-  ::google::protobuf::uint32 hand_cards(int index) const;
-  void set_hand_cards(int index, ::google::protobuf::uint32 value);
-  void add_hand_cards(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_hand_cards(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_hand_cards() const;
+  void _internal_add_hand_cards(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_hand_cards();
+  public:
+  uint32_t hand_cards(int index) const;
+  void set_hand_cards(int index, uint32_t value);
+  void add_hand_cards(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       hand_cards() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_hand_cards();
 
   // string username = 2;
   void clear_username();
-  static const int kUsernameFieldNumber = 2;
-  const ::std::string& username() const;
-  void set_username(const ::std::string& value);
-  #if LANG_CXX11
-  void set_username(::std::string&& value);
-  #endif
-  void set_username(const char* value);
-  void set_username(const char* value, size_t size);
-  ::std::string* mutable_username();
-  ::std::string* release_username();
-  void set_allocated_username(::std::string* username);
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
 
   // uint32 player_id = 1;
   void clear_player_id();
-  static const int kPlayerIdFieldNumber = 1;
-  ::google::protobuf::uint32 player_id() const;
-  void set_player_id(::google::protobuf::uint32 value);
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
 
   // uint32 hp = 3;
   void clear_hp();
-  static const int kHpFieldNumber = 3;
-  ::google::protobuf::uint32 hp() const;
-  void set_hp(::google::protobuf::uint32 value);
+  uint32_t hp() const;
+  void set_hp(uint32_t value);
+  private:
+  uint32_t _internal_hp() const;
+  void _internal_set_hp(uint32_t value);
+  public:
 
   // uint32 max_hp = 4;
   void clear_max_hp();
-  static const int kMaxHpFieldNumber = 4;
-  ::google::protobuf::uint32 max_hp() const;
-  void set_max_hp(::google::protobuf::uint32 value);
+  uint32_t max_hp() const;
+  void set_max_hp(uint32_t value);
+  private:
+  uint32_t _internal_max_hp() const;
+  void _internal_set_max_hp(uint32_t value);
+  public:
+
+  // .sanguosha.Role role = 6;
+  void clear_role();
+  ::sanguosha::Role role() const;
+  void set_role(::sanguosha::Role value);
+  private:
+  ::sanguosha::Role _internal_role() const;
+  void _internal_set_role(::sanguosha::Role value);
+  public:
+
+  // uint32 seat = 7;
+  void clear_seat();
+  uint32_t seat() const;
+  void set_seat(uint32_t value);
+  private:
+  uint32_t _internal_seat() const;
+  void _internal_set_seat(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.PlayerState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > hand_cards_;
-  mutable int _hand_cards_cached_byte_size_;
-  ::google::protobuf::internal::ArenaStringPtr username_;
-  ::google::protobuf::uint32 player_id_;
-  ::google::protobuf::uint32 hp_;
-  ::google::protobuf::uint32 max_hp_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > hand_cards_;
+    mutable std::atomic<int> _hand_cards_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    uint32_t player_id_;
+    uint32_t hp_;
+    uint32_t max_hp_;
+    int role_;
+    uint32_t seat_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameState : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameState) */ {
+class GameState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameState) */ {
  public:
-  GameState();
-  virtual ~GameState();
+  inline GameState() : GameState(nullptr) {}
+  ~GameState() override;
+  explicit PROTOBUF_CONSTEXPR GameState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameState(const GameState& from);
-
-  inline GameState& operator=(const GameState& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameState(GameState&& from) noexcept
     : GameState() {
     *this = ::std::move(from);
   }
 
+  inline GameState& operator=(const GameState& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameState& operator=(GameState&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameState& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameState& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GameState* internal_default_instance() {
     return reinterpret_cast<const GameState*>(
                &_GameState_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
-  void Swap(GameState* other);
   friend void swap(GameState& a, GameState& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameState* New() const final {
-    return CreateMaybeMessage<GameState>(NULL);
-  }
-
-  GameState* New(::google::protobuf::Arena* arena) const final {
+  GameState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameState>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameState& from);
-  void MergeFrom(const GameState& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameState& from) {
+    GameState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameState* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameState";
   }
+  protected:
+  explicit GameState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPlayersFieldNumber = 2,
+    kGameLogFieldNumber = 4,
+    kCurrentPlayerFieldNumber = 1,
+    kPhaseFieldNumber = 3,
+    kTurnTimeoutMsFieldNumber = 5,
+  };
   // repeated .sanguosha.PlayerState players = 2;
   int players_size() const;
+  private:
+  int _internal_players_size() const;
+  public:
   void clear_players();
-  static const int kPlayersFieldNumber = 2;
   ::sanguosha::PlayerState* mutable_players(int index);
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >*
       mutable_players();
+  private:
+  const ::sanguosha::PlayerState& _internal_players(int index) const;
+  ::sanguosha::PlayerState* _internal_add_players();
+  public:
   const ::sanguosha::PlayerState& players(int index) const;
   ::sanguosha::PlayerState* add_players();
-  const ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >&
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >&
       players() const;
 
   // string game_log = 4;
   void clear_game_log();
-  static const int kGameLogFieldNumber = 4;
-  const ::std::string& game_log() const;
-  void set_game_log(const ::std::string& value);
-  #if LANG_CXX11
-  void set_game_log(::std::string&& value);
-  #endif
-  void set_game_log(const char* value);
-  void set_game_log(const char* value, size_t size);
-  ::std::string* mutable_game_log();
-  ::std::string* release_game_log();
-  void set_allocated_game_log(::std::string* game_log);
+  const std::string& game_log() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_game_log(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_game_log();
+  PROTOBUF_NODISCARD std::string* release_game_log();
+  void set_allocated_game_log(std::string* game_log);
+  private:
+  const std::string& _internal_game_log() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_game_log(const std::string& value);
+  std::string* _internal_mutable_game_log();
+  public:
 
   // uint32 current_player = 1;
   void clear_current_player();
-  static const int kCurrentPlayerFieldNumber = 1;
-  ::google::protobuf::uint32 current_player() const;
-  void set_current_player(::google::protobuf::uint32 value);
+  uint32_t current_player() const;
+  void set_current_player(uint32_t value);
+  private:
+  uint32_t _internal_current_player() const;
+  void _internal_set_current_player(uint32_t value);
+  public:
 
   // .sanguosha.GamePhase phase = 3;
   void clear_phase();
-  static const int kPhaseFieldNumber = 3;
   ::sanguosha::GamePhase phase() const;
   void set_phase(::sanguosha::GamePhase value);
+  private:
+  ::sanguosha::GamePhase _internal_phase() const;
+  void _internal_set_phase(::sanguosha::GamePhase value);
+  public:
+
+  // uint32 turn_timeout_ms = 5;
+  void clear_turn_timeout_ms();
+  uint32_t turn_timeout_ms() const;
+  void set_turn_timeout_ms(uint32_t value);
+  private:
+  uint32_t _internal_turn_timeout_ms() const;
+  void _internal_set_turn_timeout_ms(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.GameState)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState > players_;
-  ::google::protobuf::internal::ArenaStringPtr game_log_;
-  ::google::protobuf::uint32 current_player_;
-  int phase_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState > players_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr game_log_;
+    uint32_t current_player_;
+    int phase_;
+    uint32_t turn_timeout_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameStart : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameStart) */ {
+class GameStart final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameStart) */ {
  public:
-  GameStart();
-  virtual ~GameStart();
+  inline GameStart() : GameStart(nullptr) {}
+  ~GameStart() override;
+  explicit PROTOBUF_CONSTEXPR GameStart(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameStart(const GameStart& from);
-
-  inline GameStart& operator=(const GameStart& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameStart(GameStart&& from) noexcept
     : GameStart() {
     *this = ::std::move(from);
   }
 
+  inline GameStart& operator=(const GameStart& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameStart& operator=(GameStart&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameStart& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameStart& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const GameStart* internal_default_instance() {
     return reinterpret_cast<const GameStart*>(
                &_GameStart_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
-  void Swap(GameStart* other);
   friend void swap(GameStart& a, GameStart& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameStart* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameStart* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameStart* New() const final {
-    return CreateMaybeMessage<GameStart>(NULL);
-  }
-
-  GameStart* New(::google::protobuf::Arena* arena) const final {
+  GameStart* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameStart>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameStart& from);
-  void MergeFrom(const GameStart& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameStart& from) {
+    GameStart::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameStart* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameStart";
   }
+  protected:
+  explicit GameStart(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kPlayerIdsFieldNumber = 2,
+    kRoomIdFieldNumber = 1,
+  };
   // repeated uint32 player_ids = 2;
   int player_ids_size() const;
+  private:
+  int _internal_player_ids_size() const;
+  public:
   void clear_player_ids();
-  static const int kPlayerIdsFieldNumber = 2;
-  ::google::protobuf::uint32 player_ids(int index) const;
-  void set_player_ids(int index, ::google::protobuf::uint32 value);
-  void add_player_ids(::google::protobuf::uint32 value);
-  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+  private:
+  uint32_t _internal_player_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_player_ids() const;
+  void _internal_add_player_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_player_ids();
+  public:
+  uint32_t player_ids(int index) const;
+  void set_player_ids(int index, uint32_t value);
+  void add_player_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
       player_ids() const;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
       mutable_player_ids();
 
   // uint32 room_id = 1;
   void clear_room_id();
-  static const int kRoomIdFieldNumber = 1;
-  ::google::protobuf::uint32 room_id() const;
-  void set_room_id(::google::protobuf::uint32 value);
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:sanguosha.GameStart)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > player_ids_;
-  mutable int _player_ids_cached_byte_size_;
-  ::google::protobuf::uint32 room_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > player_ids_;
+    mutable std::atomic<int> _player_ids_cached_byte_size_;
+    uint32_t room_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameMessage : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameMessage) */ {
+class GameMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameMessage) */ {
  public:
-  GameMessage();
-  virtual ~GameMessage();
+  inline GameMessage() : GameMessage(nullptr) {}
+  ~GameMessage() override;
+  explicit PROTOBUF_CONSTEXPR GameMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   GameMessage(const GameMessage& from);
-
-  inline GameMessage& operator=(const GameMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  #if LANG_CXX11
   GameMessage(GameMessage&& from) noexcept
     : GameMessage() {
     *this = ::std::move(from);
   }
 
+  inline GameMessage& operator=(const GameMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
   inline GameMessage& operator=(GameMessage&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameMessage& default_instance();
 
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameMessage& default_instance() {
+    return *internal_default_instance();
+  }
   enum ContentCase {
     kLoginRequest = 2,
     kLoginResponse = 3,
@@ -1650,198 +2723,364 @@ class GameMessage : public ::google::protobuf::Message /* @@protoc_insertion_poi
     kGameState = 8,
     kGameStart = 9,
     kGameOver = 10,
+    kResponsePrompt = 11,
     kRoomListResponse = 14,
+    kBatch = 13,
+    kActionResult = 15,
     CONTENT_NOT_SET = 0,
   };
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
   static inline const GameMessage* internal_default_instance() {
     return reinterpret_cast<const GameMessage*>(
                &_GameMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
-  void Swap(GameMessage* other);
   friend void swap(GameMessage& a, GameMessage& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameMessage* New() const final {
-    return CreateMaybeMessage<GameMessage>(NULL);
-  }
-
-  GameMessage* New(::google::protobuf::Arena* arena) const final {
+  GameMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<GameMessage>(arena);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const GameMessage& from);
-  void MergeFrom(const GameMessage& from);
-  void Clear() final;
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameMessage& from) {
+    GameMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(GameMessage* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameMessage";
   }
+  protected:
+  explicit GameMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTypeFieldNumber = 1,
+    kRequestIdFieldNumber = 12,
+    kLoginRequestFieldNumber = 2,
+    kLoginResponseFieldNumber = 3,
+    kHeartbeatFieldNumber = 4,
+    kRoomRequestFieldNumber = 5,
+    kRoomResponseFieldNumber = 6,
+    kGameActionFieldNumber = 7,
+    kGameStateFieldNumber = 8,
+    kGameStartFieldNumber = 9,
+    kGameOverFieldNumber = 10,
+    kResponsePromptFieldNumber = 11,
+    kRoomListResponseFieldNumber = 14,
+    kBatchFieldNumber = 13,
+    kActionResultFieldNumber = 15,
+  };
   // .sanguosha.MessageType type = 1;
   void clear_type();
-  static const int kTypeFieldNumber = 1;
   ::sanguosha::MessageType type() const;
   void set_type(::sanguosha::MessageType value);
+  private:
+  ::sanguosha::MessageType _internal_type() const;
+  void _internal_set_type(::sanguosha::MessageType value);
+  public:
+
+  // uint32 request_id = 12;
+  void clear_request_id();
+  uint32_t request_id() const;
+  void set_request_id(uint32_t value);
+  private:
+  uint32_t _internal_request_id() const;
+  void _internal_set_request_id(uint32_t value);
+  public:
 
   // .sanguosha.LoginRequest login_request = 2;
   bool has_login_request() const;
-  void clear_login_request();
-  static const int kLoginRequestFieldNumber = 2;
   private:
-  const ::sanguosha::LoginRequest& _internal_login_request() const;
+  bool _internal_has_login_request() const;
   public:
+  void clear_login_request();
   const ::sanguosha::LoginRequest& login_request() const;
-  ::sanguosha::LoginRequest* release_login_request();
+  PROTOBUF_NODISCARD ::sanguosha::LoginRequest* release_login_request();
   ::sanguosha::LoginRequest* mutable_login_request();
   void set_allocated_login_request(::sanguosha::LoginRequest* login_request);
+  private:
+  const ::sanguosha::LoginRequest& _internal_login_request() const;
+  ::sanguosha::LoginRequest* _internal_mutable_login_request();
+  public:
+  void unsafe_arena_set_allocated_login_request(
+      ::sanguosha::LoginRequest* login_request);
+  ::sanguosha::LoginRequest* unsafe_arena_release_login_request();
 
   // .sanguosha.LoginResponse login_response = 3;
   bool has_login_response() const;
-  void clear_login_response();
-  static const int kLoginResponseFieldNumber = 3;
   private:
-  const ::sanguosha::LoginResponse& _internal_login_response() const;
+  bool _internal_has_login_response() const;
   public:
+  void clear_login_response();
   const ::sanguosha::LoginResponse& login_response() const;
-  ::sanguosha::LoginResponse* release_login_response();
+  PROTOBUF_NODISCARD ::sanguosha::LoginResponse* release_login_response();
   ::sanguosha::LoginResponse* mutable_login_response();
   void set_allocated_login_response(::sanguosha::LoginResponse* login_response);
+  private:
+  const ::sanguosha::LoginResponse& _internal_login_response() const;
+  ::sanguosha::LoginResponse* _internal_mutable_login_response();
+  public:
+  void unsafe_arena_set_allocated_login_response(
+      ::sanguosha::LoginResponse* login_response);
+  ::sanguosha::LoginResponse* unsafe_arena_release_login_response();
 
   // .sanguosha.Heartbeat heartbeat = 4;
   bool has_heartbeat() const;
-  void clear_heartbeat();
-  static const int kHeartbeatFieldNumber = 4;
   private:
-  const ::sanguosha::Heartbeat& _internal_heartbeat() const;
+  bool _internal_has_heartbeat() const;
   public:
+  void clear_heartbeat();
   const ::sanguosha::Heartbeat& heartbeat() const;
-  ::sanguosha::Heartbeat* release_heartbeat();
+  PROTOBUF_NODISCARD ::sanguosha::Heartbeat* release_heartbeat();
   ::sanguosha::Heartbeat* mutable_heartbeat();
   void set_allocated_heartbeat(::sanguosha::Heartbeat* heartbeat);
+  private:
+  const ::sanguosha::Heartbeat& _internal_heartbeat() const;
+  ::sanguosha::Heartbeat* _internal_mutable_heartbeat();
+  public:
+  void unsafe_arena_set_allocated_heartbeat(
+      ::sanguosha::Heartbeat* heartbeat);
+  ::sanguosha::Heartbeat* unsafe_arena_release_heartbeat();
 
   // .sanguosha.RoomRequest room_request = 5;
   bool has_room_request() const;
-  void clear_room_request();
-  static const int kRoomRequestFieldNumber = 5;
   private:
-  const ::sanguosha::RoomRequest& _internal_room_request() const;
+  bool _internal_has_room_request() const;
   public:
+  void clear_room_request();
   const ::sanguosha::RoomRequest& room_request() const;
-  ::sanguosha::RoomRequest* release_room_request();
+  PROTOBUF_NODISCARD ::sanguosha::RoomRequest* release_room_request();
   ::sanguosha::RoomRequest* mutable_room_request();
   void set_allocated_room_request(::sanguosha::RoomRequest* room_request);
+  private:
+  const ::sanguosha::RoomRequest& _internal_room_request() const;
+  ::sanguosha::RoomRequest* _internal_mutable_room_request();
+  public:
+  void unsafe_arena_set_allocated_room_request(
+      ::sanguosha::RoomRequest* room_request);
+  ::sanguosha::RoomRequest* unsafe_arena_release_room_request();
 
   // .sanguosha.RoomResponse room_response = 6;
   bool has_room_response() const;
-  void clear_room_response();
-  static const int kRoomResponseFieldNumber = 6;
   private:
-  const ::sanguosha::RoomResponse& _internal_room_response() const;
+  bool _internal_has_room_response() const;
   public:
+  void clear_room_response();
   const ::sanguosha::RoomResponse& room_response() const;
-  ::sanguosha::RoomResponse* release_room_response();
+  PROTOBUF_NODISCARD ::sanguosha::RoomResponse* release_room_response();
   ::sanguosha::RoomResponse* mutable_room_response();
   void set_allocated_room_response(::sanguosha::RoomResponse* room_response);
+  private:
+  const ::sanguosha::RoomResponse& _internal_room_response() const;
+  ::sanguosha::RoomResponse* _internal_mutable_room_response();
+  public:
+  void unsafe_arena_set_allocated_room_response(
+      ::sanguosha::RoomResponse* room_response);
+  ::sanguosha::RoomResponse* unsafe_arena_release_room_response();
 
   // .sanguosha.GameAction game_action = 7;
   bool has_game_action() const;
-  void clear_game_action();
-  static const int kGameActionFieldNumber = 7;
   private:
-  const ::sanguosha::GameAction& _internal_game_action() const;
+  bool _internal_has_game_action() const;
   public:
+  void clear_game_action();
   const ::sanguosha::GameAction& game_action() const;
-  ::sanguosha::GameAction* release_game_action();
+  PROTOBUF_NODISCARD ::sanguosha::GameAction* release_game_action();
   ::sanguosha::GameAction* mutable_game_action();
   void set_allocated_game_action(::sanguosha::GameAction* game_action);
+  private:
+  const ::sanguosha::GameAction& _internal_game_action() const;
+  ::sanguosha::GameAction* _internal_mutable_game_action();
+  public:
+  void unsafe_arena_set_allocated_game_action(
+      ::sanguosha::GameAction* game_action);
+  ::sanguosha::GameAction* unsafe_arena_release_game_action();
 
   // .sanguosha.GameState game_state = 8;
   bool has_game_state() const;
-  void clear_game_state();
-  static const int kGameStateFieldNumber = 8;
   private:
-  const ::sanguosha::GameState& _internal_game_state() const;
+  bool _internal_has_game_state() const;
   public:
+  void clear_game_state();
   const ::sanguosha::GameState& game_state() const;
-  ::sanguosha::GameState* release_game_state();
+  PROTOBUF_NODISCARD ::sanguosha::GameState* release_game_state();
   ::sanguosha::GameState* mutable_game_state();
   void set_allocated_game_state(::sanguosha::GameState* game_state);
+  private:
+  const ::sanguosha::GameState& _internal_game_state() const;
+  ::sanguosha::GameState* _internal_mutable_game_state();
+  public:
+  void unsafe_arena_set_allocated_game_state(
+      ::sanguosha::GameState* game_state);
+  ::sanguosha::GameState* unsafe_arena_release_game_state();
 
   // .sanguosha.GameStart game_start = 9;
   bool has_game_start() const;
-  void clear_game_start();
-  static const int kGameStartFieldNumber = 9;
   private:
-  const ::sanguosha::GameStart& _internal_game_start() const;
+  bool _internal_has_game_start() const;
   public:
+  void clear_game_start();
   const ::sanguosha::GameStart& game_start() const;
-  ::sanguosha::GameStart* release_game_start();
+  PROTOBUF_NODISCARD ::sanguosha::GameStart* release_game_start();
   ::sanguosha::GameStart* mutable_game_start();
   void set_allocated_game_start(::sanguosha::GameStart* game_start);
+  private:
+  const ::sanguosha::GameStart& _internal_game_start() const;
+  ::sanguosha::GameStart* _internal_mutable_game_start();
+  public:
+  void unsafe_arena_set_allocated_game_start(
+      ::sanguosha::GameStart* game_start);
+  ::sanguosha::GameStart* unsafe_arena_release_game_start();
 
   // .sanguosha.GameOver game_over = 10;
   bool has_game_over() const;
-  void clear_game_over();
-  static const int kGameOverFieldNumber = 10;
   private:
-  const ::sanguosha::GameOver& _internal_game_over() const;
+  bool _internal_has_game_over() const;
   public:
+  void clear_game_over();
   const ::sanguosha::GameOver& game_over() const;
-  ::sanguosha::GameOver* release_game_over();
+  PROTOBUF_NODISCARD ::sanguosha::GameOver* release_game_over();
   ::sanguosha::GameOver* mutable_game_over();
   void set_allocated_game_over(::sanguosha::GameOver* game_over);
+  private:
+  const ::sanguosha::GameOver& _internal_game_over() const;
+  ::sanguosha::GameOver* _internal_mutable_game_over();
+  public:
+  void unsafe_arena_set_allocated_game_over(
+      ::sanguosha::GameOver* game_over);
+  ::sanguosha::GameOver* unsafe_arena_release_game_over();
+
+  // .sanguosha.ResponsePrompt response_prompt = 11;
+  bool has_response_prompt() const;
+  private:
+  bool _internal_has_response_prompt() const;
+  public:
+  void clear_response_prompt();
+  const ::sanguosha::ResponsePrompt& response_prompt() const;
+  PROTOBUF_NODISCARD ::sanguosha::ResponsePrompt* release_response_prompt();
+  ::sanguosha::ResponsePrompt* mutable_response_prompt();
+  void set_allocated_response_prompt(::sanguosha::ResponsePrompt* response_prompt);
+  private:
+  const ::sanguosha::ResponsePrompt& _internal_response_prompt() const;
+  ::sanguosha::ResponsePrompt* _internal_mutable_response_prompt();
+  public:
+  void unsafe_arena_set_allocated_response_prompt(
+      ::sanguosha::ResponsePrompt* response_prompt);
+  ::sanguosha::ResponsePrompt* unsafe_arena_release_response_prompt();
 
   // .sanguosha.RoomListResponse room_list_response = 14;
   bool has_room_list_response() const;
-  void clear_room_list_response();
-  static const int kRoomListResponseFieldNumber = 14;
   private:
-  const ::sanguosha::RoomListResponse& _internal_room_list_response() const;
+  bool _internal_has_room_list_response() const;
   public:
+  void clear_room_list_response();
   const ::sanguosha::RoomListResponse& room_list_response() const;
-  ::sanguosha::RoomListResponse* release_room_list_response();
+  PROTOBUF_NODISCARD ::sanguosha::RoomListResponse* release_room_list_response();
   ::sanguosha::RoomListResponse* mutable_room_list_response();
   void set_allocated_room_list_response(::sanguosha::RoomListResponse* room_list_response);
+  private:
+  const ::sanguosha::RoomListResponse& _internal_room_list_response() const;
+  ::sanguosha::RoomListResponse* _internal_mutable_room_list_response();
+  public:
+  void unsafe_arena_set_allocated_room_list_response(
+      ::sanguosha::RoomListResponse* room_list_response);
+  ::sanguosha::RoomListResponse* unsafe_arena_release_room_list_response();
+
+  // .sanguosha.GameMessageBatch batch = 13;
+  bool has_batch() const;
+  private:
+  bool _internal_has_batch() const;
+  public:
+  void clear_batch();
+  const ::sanguosha::GameMessageBatch& batch() const;
+  PROTOBUF_NODISCARD ::sanguosha::GameMessageBatch* release_batch();
+  ::sanguosha::GameMessageBatch* mutable_batch();
+  void set_allocated_batch(::sanguosha::GameMessageBatch* batch);
+  private:
+  const ::sanguosha::GameMessageBatch& _internal_batch() const;
+  ::sanguosha::GameMessageBatch* _internal_mutable_batch();
+  public:
+  void unsafe_arena_set_allocated_batch(
+      ::sanguosha::GameMessageBatch* batch);
+  ::sanguosha::GameMessageBatch* unsafe_arena_release_batch();
+
+  // .sanguosha.ActionResult action_result = 15;
+  bool has_action_result() const;
+  private:
+  bool _internal_has_action_result() const;
+  public:
+  void clear_action_result();
+  const ::sanguosha::ActionResult& action_result() const;
+  PROTOBUF_NODISCARD ::sanguosha::ActionResult* release_action_result();
+  ::sanguosha::ActionResult* mutable_action_result();
+  void set_allocated_action_result(::sanguosha::ActionResult* action_result);
+  private:
+  const ::sanguosha::ActionResult& _internal_action_result() const;
+  ::sanguosha::ActionResult* _internal_mutable_action_result();
+  public:
+  void unsafe_arena_set_allocated_action_result(
+      ::sanguosha::ActionResult* action_result);
+  ::sanguosha::ActionResult* unsafe_arena_release_action_result();
 
   void clear_content();
   ContentCase content_case() const;
   // @@protoc_insertion_point(class_scope:sanguosha.GameMessage)
  private:
+  class _Internal;
   void set_has_login_request();
   void set_has_login_response();
   void set_has_heartbeat();
@@ -1851,1456 +3090,5080 @@ class GameMessage : public ::google::protobuf::Message /* @@protoc_insertion_poi
   void set_has_game_state();
   void set_has_game_start();
   void set_has_game_over();
+  void set_has_response_prompt();
   void set_has_room_list_response();
+  void set_has_batch();
+  void set_has_action_result();
 
   inline bool has_content() const;
   inline void clear_has_content();
 
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  int type_;
-  union ContentUnion {
-    ContentUnion() {}
-    ::sanguosha::LoginRequest* login_request_;
-    ::sanguosha::LoginResponse* login_response_;
-    ::sanguosha::Heartbeat* heartbeat_;
-    ::sanguosha::RoomRequest* room_request_;
-    ::sanguosha::RoomResponse* room_response_;
-    ::sanguosha::GameAction* game_action_;
-    ::sanguosha::GameState* game_state_;
-    ::sanguosha::GameStart* game_start_;
-    ::sanguosha::GameOver* game_over_;
-    ::sanguosha::RoomListResponse* room_list_response_;
-  } content_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  ::google::protobuf::uint32 _oneof_case_[1];
-
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int type_;
+    uint32_t request_id_;
+    union ContentUnion {
+      constexpr ContentUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::sanguosha::LoginRequest* login_request_;
+      ::sanguosha::LoginResponse* login_response_;
+      ::sanguosha::Heartbeat* heartbeat_;
+      ::sanguosha::RoomRequest* room_request_;
+      ::sanguosha::RoomResponse* room_response_;
+      ::sanguosha::GameAction* game_action_;
+      ::sanguosha::GameState* game_state_;
+      ::sanguosha::GameStart* game_start_;
+      ::sanguosha::GameOver* game_over_;
+      ::sanguosha::ResponsePrompt* response_prompt_;
+      ::sanguosha::RoomListResponse* room_list_response_;
+      ::sanguosha::GameMessageBatch* batch_;
+      ::sanguosha::ActionResult* action_result_;
+    } content_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
 // -------------------------------------------------------------------
 
-class GameOver : public ::google::protobuf::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameOver) */ {
+class GameMessageBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameMessageBatch) */ {
  public:
-  GameOver();
-  virtual ~GameOver();
+  inline GameMessageBatch() : GameMessageBatch(nullptr) {}
+  ~GameMessageBatch() override;
+  explicit PROTOBUF_CONSTEXPR GameMessageBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  GameOver(const GameOver& from);
+  GameMessageBatch(const GameMessageBatch& from);
+  GameMessageBatch(GameMessageBatch&& from) noexcept
+    : GameMessageBatch() {
+    *this = ::std::move(from);
+  }
 
-  inline GameOver& operator=(const GameOver& from) {
+  inline GameMessageBatch& operator=(const GameMessageBatch& from) {
     CopyFrom(from);
     return *this;
   }
-  #if LANG_CXX11
-  GameOver(GameOver&& from) noexcept
-    : GameOver() {
-    *this = ::std::move(from);
-  }
-
-  inline GameOver& operator=(GameOver&& from) noexcept {
-    if (GetArenaNoVirtual() == from.GetArenaNoVirtual()) {
-      if (this != &from) InternalSwap(&from);
+  inline GameMessageBatch& operator=(GameMessageBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
-  #endif
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const GameOver& default_instance();
 
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const GameOver* internal_default_instance() {
-    return reinterpret_cast<const GameOver*>(
-               &_GameOver_default_instance_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameMessageBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameMessageBatch* internal_default_instance() {
+    return reinterpret_cast<const GameMessageBatch*>(
+               &_GameMessageBatch_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
-  void Swap(GameOver* other);
-  friend void swap(GameOver& a, GameOver& b) {
+  friend void swap(GameMessageBatch& a, GameMessageBatch& b) {
     a.Swap(&b);
   }
+  inline void Swap(GameMessageBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameMessageBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  inline GameOver* New() const final {
-    return CreateMaybeMessage<GameOver>(NULL);
+  GameMessageBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameMessageBatch>(arena);
   }
-
-  GameOver* New(::google::protobuf::Arena* arena) const final {
-    return CreateMaybeMessage<GameOver>(arena);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameMessageBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameMessageBatch& from) {
+    GameMessageBatch::MergeImpl(*this, from);
   }
-  void CopyFrom(const ::google::protobuf::Message& from) final;
-  void MergeFrom(const ::google::protobuf::Message& from) final;
-  void CopyFrom(const GameOver& from);
-  void MergeFrom(const GameOver& from);
-  void Clear() final;
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
   size_t ByteSizeLong() const final;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input) final;
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const final;
-  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
-      bool deterministic, ::google::protobuf::uint8* target) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(GameOver* other);
+  void InternalSwap(GameMessageBatch* other);
+
   private:
-  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
-    return NULL;
-  }
-  inline void* MaybeArenaPtr() const {
-    return NULL;
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameMessageBatch";
   }
+  protected:
+  explicit GameMessageBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const final;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // uint32 winner_id = 1;
-  void clear_winner_id();
-  static const int kWinnerIdFieldNumber = 1;
-  ::google::protobuf::uint32 winner_id() const;
-  void set_winner_id(::google::protobuf::uint32 value);
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .sanguosha.GameMessage messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::sanguosha::GameMessage* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >*
+      mutable_messages();
+  private:
+  const ::sanguosha::GameMessage& _internal_messages(int index) const;
+  ::sanguosha::GameMessage* _internal_add_messages();
+  public:
+  const ::sanguosha::GameMessage& messages(int index) const;
+  ::sanguosha::GameMessage* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >&
+      messages() const;
 
-  // @@protoc_insertion_point(class_scope:sanguosha.GameOver)
+  // @@protoc_insertion_point(class_scope:sanguosha.GameMessageBatch)
  private:
-
-  ::google::protobuf::internal::InternalMetadataWithArena _internal_metadata_;
-  ::google::protobuf::uint32 winner_id_;
-  mutable ::google::protobuf::internal::CachedSize _cached_size_;
-  friend struct ::protobuf_sanguosha_2eproto::TableStruct;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class ActionResult final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.ActionResult) */ {
+ public:
+  inline ActionResult() : ActionResult(nullptr) {}
+  ~ActionResult() override;
+  explicit PROTOBUF_CONSTEXPR ActionResult(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  ActionResult(const ActionResult& from);
+  ActionResult(ActionResult&& from) noexcept
+    : ActionResult() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// LoginRequest
+  inline ActionResult& operator=(const ActionResult& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ActionResult& operator=(ActionResult&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// string username = 1;
-inline void LoginRequest::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LoginRequest::username() const {
-  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.username)
-  return username_.GetNoArena();
-}
-inline void LoginRequest::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.username)
-}
-#if LANG_CXX11
-inline void LoginRequest::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.LoginRequest.username)
-}
-#endif
-inline void LoginRequest::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.LoginRequest.username)
-}
-inline void LoginRequest::set_username(const char* value, size_t size) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.LoginRequest.username)
-}
-inline ::std::string* LoginRequest::mutable_username() {
-  
-  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* LoginRequest::release_username() {
-  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.username)
-  
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void LoginRequest::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.username)
-}
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ActionResult& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ActionResult* internal_default_instance() {
+    return reinterpret_cast<const ActionResult*>(
+               &_ActionResult_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
 
-// string password = 2;
-inline void LoginRequest::clear_password() {
-  password_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LoginRequest::password() const {
-  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.password)
-  return password_.GetNoArena();
-}
-inline void LoginRequest::set_password(const ::std::string& value) {
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.password)
-}
-#if LANG_CXX11
-inline void LoginRequest::set_password(::std::string&& value) {
-  
-  password_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.LoginRequest.password)
-}
-#endif
-inline void LoginRequest::set_password(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.LoginRequest.password)
-}
-inline void LoginRequest::set_password(const char* value, size_t size) {
-  
-  password_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.LoginRequest.password)
-}
-inline ::std::string* LoginRequest::mutable_password() {
-  
-  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.password)
-  return password_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline ::std::string* LoginRequest::release_password() {
-  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.password)
-  
-  return password_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline void LoginRequest::set_allocated_password(::std::string* password) {
-  if (password != NULL) {
-    
-  } else {
-    
+  friend void swap(ActionResult& a, ActionResult& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ActionResult* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ActionResult* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  password_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), password);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.password)
-}
 
-// -------------------------------------------------------------------
+  // implements Message ----------------------------------------------
 
-// LoginResponse
+  ActionResult* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ActionResult>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ActionResult& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ActionResult& from) {
+    ActionResult::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// bool success = 1;
-inline void LoginResponse::clear_success() {
-  success_ = false;
-}
-inline bool LoginResponse::success() const {
-  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.success)
-  return success_;
-}
-inline void LoginResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.success)
-}
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
-// string error_message = 2;
-inline void LoginResponse::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
-}
-inline const ::std::string& LoginResponse::error_message() const {
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ActionResult* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.ActionResult";
+  }
+  protected:
+  explicit ActionResult(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSuccessFieldNumber = 1,
+  };
+  // bool success = 1;
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.ActionResult)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    bool success_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameOver final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameOver) */ {
+ public:
+  inline GameOver() : GameOver(nullptr) {}
+  ~GameOver() override;
+  explicit PROTOBUF_CONSTEXPR GameOver(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameOver(const GameOver& from);
+  GameOver(GameOver&& from) noexcept
+    : GameOver() {
+    *this = ::std::move(from);
+  }
+
+  inline GameOver& operator=(const GameOver& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameOver& operator=(GameOver&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameOver& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameOver* internal_default_instance() {
+    return reinterpret_cast<const GameOver*>(
+               &_GameOver_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(GameOver& a, GameOver& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameOver* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameOver* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameOver* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameOver>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameOver& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameOver& from) {
+    GameOver::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameOver* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameOver";
+  }
+  protected:
+  explicit GameOver(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWinnerIdsFieldNumber = 2,
+    kWinnerIdFieldNumber = 1,
+    kWinnerRoleFieldNumber = 3,
+  };
+  // repeated uint32 winner_ids = 2;
+  int winner_ids_size() const;
+  private:
+  int _internal_winner_ids_size() const;
+  public:
+  void clear_winner_ids();
+  private:
+  uint32_t _internal_winner_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_winner_ids() const;
+  void _internal_add_winner_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_winner_ids();
+  public:
+  uint32_t winner_ids(int index) const;
+  void set_winner_ids(int index, uint32_t value);
+  void add_winner_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      winner_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_winner_ids();
+
+  // uint32 winner_id = 1;
+  void clear_winner_id();
+  uint32_t winner_id() const;
+  void set_winner_id(uint32_t value);
+  private:
+  uint32_t _internal_winner_id() const;
+  void _internal_set_winner_id(uint32_t value);
+  public:
+
+  // .sanguosha.Role winner_role = 3;
+  void clear_winner_role();
+  ::sanguosha::Role winner_role() const;
+  void set_winner_role(::sanguosha::Role value);
+  private:
+  ::sanguosha::Role _internal_winner_role() const;
+  void _internal_set_winner_role(::sanguosha::Role value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.GameOver)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > winner_ids_;
+    mutable std::atomic<int> _winner_ids_cached_byte_size_;
+    uint32_t winner_id_;
+    int winner_role_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GameSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.GameSnapshot) */ {
+ public:
+  inline GameSnapshot() : GameSnapshot(nullptr) {}
+  ~GameSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR GameSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GameSnapshot(const GameSnapshot& from);
+  GameSnapshot(GameSnapshot&& from) noexcept
+    : GameSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline GameSnapshot& operator=(const GameSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GameSnapshot& operator=(GameSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GameSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GameSnapshot* internal_default_instance() {
+    return reinterpret_cast<const GameSnapshot*>(
+               &_GameSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(GameSnapshot& a, GameSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GameSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GameSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GameSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GameSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GameSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GameSnapshot& from) {
+    GameSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GameSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.GameSnapshot";
+  }
+  protected:
+  explicit GameSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSeatsFieldNumber = 1,
+    kDeckFieldNumber = 4,
+    kDiscardPileFieldNumber = 5,
+    kConsecutiveTimeoutsFieldNumber = 8,
+    kAliveMaskFieldNumber = 2,
+    kCurrentSeatFieldNumber = 3,
+    kTurnSeqFieldNumber = 7,
+    kRngSeedFieldNumber = 6,
+    kNextPromptIdFieldNumber = 9,
+    kPendingPromptIdFieldNumber = 10,
+    kPendingSourceSeatFieldNumber = 11,
+    kPendingTargetSeatFieldNumber = 12,
+    kPendingCardTypeFieldNumber = 13,
+    kRngDrawsFieldNumber = 14,
+  };
+  // repeated .sanguosha.PlayerState seats = 1;
+  int seats_size() const;
+  private:
+  int _internal_seats_size() const;
+  public:
+  void clear_seats();
+  ::sanguosha::PlayerState* mutable_seats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >*
+      mutable_seats();
+  private:
+  const ::sanguosha::PlayerState& _internal_seats(int index) const;
+  ::sanguosha::PlayerState* _internal_add_seats();
+  public:
+  const ::sanguosha::PlayerState& seats(int index) const;
+  ::sanguosha::PlayerState* add_seats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >&
+      seats() const;
+
+  // repeated uint32 deck = 4;
+  int deck_size() const;
+  private:
+  int _internal_deck_size() const;
+  public:
+  void clear_deck();
+  private:
+  uint32_t _internal_deck(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_deck() const;
+  void _internal_add_deck(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_deck();
+  public:
+  uint32_t deck(int index) const;
+  void set_deck(int index, uint32_t value);
+  void add_deck(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      deck() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_deck();
+
+  // repeated uint32 discard_pile = 5;
+  int discard_pile_size() const;
+  private:
+  int _internal_discard_pile_size() const;
+  public:
+  void clear_discard_pile();
+  private:
+  uint32_t _internal_discard_pile(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_discard_pile() const;
+  void _internal_add_discard_pile(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_discard_pile();
+  public:
+  uint32_t discard_pile(int index) const;
+  void set_discard_pile(int index, uint32_t value);
+  void add_discard_pile(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      discard_pile() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_discard_pile();
+
+  // repeated uint32 consecutive_timeouts = 8;
+  int consecutive_timeouts_size() const;
+  private:
+  int _internal_consecutive_timeouts_size() const;
+  public:
+  void clear_consecutive_timeouts();
+  private:
+  uint32_t _internal_consecutive_timeouts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_consecutive_timeouts() const;
+  void _internal_add_consecutive_timeouts(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_consecutive_timeouts();
+  public:
+  uint32_t consecutive_timeouts(int index) const;
+  void set_consecutive_timeouts(int index, uint32_t value);
+  void add_consecutive_timeouts(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      consecutive_timeouts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_consecutive_timeouts();
+
+  // uint32 alive_mask = 2;
+  void clear_alive_mask();
+  uint32_t alive_mask() const;
+  void set_alive_mask(uint32_t value);
+  private:
+  uint32_t _internal_alive_mask() const;
+  void _internal_set_alive_mask(uint32_t value);
+  public:
+
+  // uint32 current_seat = 3;
+  void clear_current_seat();
+  uint32_t current_seat() const;
+  void set_current_seat(uint32_t value);
+  private:
+  uint32_t _internal_current_seat() const;
+  void _internal_set_current_seat(uint32_t value);
+  public:
+
+  // uint64 turn_seq = 7;
+  void clear_turn_seq();
+  uint64_t turn_seq() const;
+  void set_turn_seq(uint64_t value);
+  private:
+  uint64_t _internal_turn_seq() const;
+  void _internal_set_turn_seq(uint64_t value);
+  public:
+
+  // uint32 rng_seed = 6;
+  void clear_rng_seed();
+  uint32_t rng_seed() const;
+  void set_rng_seed(uint32_t value);
+  private:
+  uint32_t _internal_rng_seed() const;
+  void _internal_set_rng_seed(uint32_t value);
+  public:
+
+  // uint32 next_prompt_id = 9;
+  void clear_next_prompt_id();
+  uint32_t next_prompt_id() const;
+  void set_next_prompt_id(uint32_t value);
+  private:
+  uint32_t _internal_next_prompt_id() const;
+  void _internal_set_next_prompt_id(uint32_t value);
+  public:
+
+  // uint32 pending_prompt_id = 10;
+  void clear_pending_prompt_id();
+  uint32_t pending_prompt_id() const;
+  void set_pending_prompt_id(uint32_t value);
+  private:
+  uint32_t _internal_pending_prompt_id() const;
+  void _internal_set_pending_prompt_id(uint32_t value);
+  public:
+
+  // uint32 pending_source_seat = 11;
+  void clear_pending_source_seat();
+  uint32_t pending_source_seat() const;
+  void set_pending_source_seat(uint32_t value);
+  private:
+  uint32_t _internal_pending_source_seat() const;
+  void _internal_set_pending_source_seat(uint32_t value);
+  public:
+
+  // uint32 pending_target_seat = 12;
+  void clear_pending_target_seat();
+  uint32_t pending_target_seat() const;
+  void set_pending_target_seat(uint32_t value);
+  private:
+  uint32_t _internal_pending_target_seat() const;
+  void _internal_set_pending_target_seat(uint32_t value);
+  public:
+
+  // .sanguosha.CardType pending_card_type = 13;
+  void clear_pending_card_type();
+  ::sanguosha::CardType pending_card_type() const;
+  void set_pending_card_type(::sanguosha::CardType value);
+  private:
+  ::sanguosha::CardType _internal_pending_card_type() const;
+  void _internal_set_pending_card_type(::sanguosha::CardType value);
+  public:
+
+  // uint64 rng_draws = 14;
+  void clear_rng_draws();
+  uint64_t rng_draws() const;
+  void set_rng_draws(uint64_t value);
+  private:
+  uint64_t _internal_rng_draws() const;
+  void _internal_set_rng_draws(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.GameSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState > seats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > deck_;
+    mutable std::atomic<int> _deck_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > discard_pile_;
+    mutable std::atomic<int> _discard_pile_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > consecutive_timeouts_;
+    mutable std::atomic<int> _consecutive_timeouts_cached_byte_size_;
+    uint32_t alive_mask_;
+    uint32_t current_seat_;
+    uint64_t turn_seq_;
+    uint32_t rng_seed_;
+    uint32_t next_prompt_id_;
+    uint32_t pending_prompt_id_;
+    uint32_t pending_source_seat_;
+    uint32_t pending_target_seat_;
+    int pending_card_type_;
+    uint64_t rng_draws_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomSnapshot) */ {
+ public:
+  inline RoomSnapshot() : RoomSnapshot(nullptr) {}
+  ~RoomSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR RoomSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomSnapshot(const RoomSnapshot& from);
+  RoomSnapshot(RoomSnapshot&& from) noexcept
+    : RoomSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomSnapshot& operator=(const RoomSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomSnapshot& operator=(RoomSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomSnapshot* internal_default_instance() {
+    return reinterpret_cast<const RoomSnapshot*>(
+               &_RoomSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(RoomSnapshot& a, RoomSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomSnapshot& from) {
+    RoomSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomSnapshot";
+  }
+  protected:
+  explicit RoomSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPlayersFieldNumber = 3,
+    kGameFieldNumber = 4,
+    kRoomIdFieldNumber = 1,
+    kCapacityFieldNumber = 2,
+  };
+  // repeated uint32 players = 3;
+  int players_size() const;
+  private:
+  int _internal_players_size() const;
+  public:
+  void clear_players();
+  private:
+  uint32_t _internal_players(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_players() const;
+  void _internal_add_players(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_players();
+  public:
+  uint32_t players(int index) const;
+  void set_players(int index, uint32_t value);
+  void add_players(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      players() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_players();
+
+  // .sanguosha.GameSnapshot game = 4;
+  bool has_game() const;
+  private:
+  bool _internal_has_game() const;
+  public:
+  void clear_game();
+  const ::sanguosha::GameSnapshot& game() const;
+  PROTOBUF_NODISCARD ::sanguosha::GameSnapshot* release_game();
+  ::sanguosha::GameSnapshot* mutable_game();
+  void set_allocated_game(::sanguosha::GameSnapshot* game);
+  private:
+  const ::sanguosha::GameSnapshot& _internal_game() const;
+  ::sanguosha::GameSnapshot* _internal_mutable_game();
+  public:
+  void unsafe_arena_set_allocated_game(
+      ::sanguosha::GameSnapshot* game);
+  ::sanguosha::GameSnapshot* unsafe_arena_release_game();
+
+  // uint32 room_id = 1;
+  void clear_room_id();
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
+
+  // uint32 capacity = 2;
+  void clear_capacity();
+  uint32_t capacity() const;
+  void set_capacity(uint32_t value);
+  private:
+  uint32_t _internal_capacity() const;
+  void _internal_set_capacity(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.RoomSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > players_;
+    mutable std::atomic<int> _players_cached_byte_size_;
+    ::sanguosha::GameSnapshot* game_;
+    uint32_t room_id_;
+    uint32_t capacity_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomManagerSnapshot final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomManagerSnapshot) */ {
+ public:
+  inline RoomManagerSnapshot() : RoomManagerSnapshot(nullptr) {}
+  ~RoomManagerSnapshot() override;
+  explicit PROTOBUF_CONSTEXPR RoomManagerSnapshot(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomManagerSnapshot(const RoomManagerSnapshot& from);
+  RoomManagerSnapshot(RoomManagerSnapshot&& from) noexcept
+    : RoomManagerSnapshot() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomManagerSnapshot& operator=(const RoomManagerSnapshot& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomManagerSnapshot& operator=(RoomManagerSnapshot&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomManagerSnapshot& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomManagerSnapshot* internal_default_instance() {
+    return reinterpret_cast<const RoomManagerSnapshot*>(
+               &_RoomManagerSnapshot_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(RoomManagerSnapshot& a, RoomManagerSnapshot& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomManagerSnapshot* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomManagerSnapshot* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomManagerSnapshot* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomManagerSnapshot>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomManagerSnapshot& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomManagerSnapshot& from) {
+    RoomManagerSnapshot::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomManagerSnapshot* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomManagerSnapshot";
+  }
+  protected:
+  explicit RoomManagerSnapshot(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomsFieldNumber = 4,
+    kGenerationFieldNumber = 1,
+    kNextRoomIdFieldNumber = 2,
+    kNextBotIdFieldNumber = 3,
+  };
+  // repeated .sanguosha.RoomSnapshot rooms = 4;
+  int rooms_size() const;
+  private:
+  int _internal_rooms_size() const;
+  public:
+  void clear_rooms();
+  ::sanguosha::RoomSnapshot* mutable_rooms(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomSnapshot >*
+      mutable_rooms();
+  private:
+  const ::sanguosha::RoomSnapshot& _internal_rooms(int index) const;
+  ::sanguosha::RoomSnapshot* _internal_add_rooms();
+  public:
+  const ::sanguosha::RoomSnapshot& rooms(int index) const;
+  ::sanguosha::RoomSnapshot* add_rooms();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomSnapshot >&
+      rooms() const;
+
+  // uint64 generation = 1;
+  void clear_generation();
+  uint64_t generation() const;
+  void set_generation(uint64_t value);
+  private:
+  uint64_t _internal_generation() const;
+  void _internal_set_generation(uint64_t value);
+  public:
+
+  // uint32 next_room_id = 2;
+  void clear_next_room_id();
+  uint32_t next_room_id() const;
+  void set_next_room_id(uint32_t value);
+  private:
+  uint32_t _internal_next_room_id() const;
+  void _internal_set_next_room_id(uint32_t value);
+  public:
+
+  // uint32 next_bot_id = 3;
+  void clear_next_bot_id();
+  uint32_t next_bot_id() const;
+  void set_next_bot_id(uint32_t value);
+  private:
+  uint32_t _internal_next_bot_id() const;
+  void _internal_set_next_bot_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.RoomManagerSnapshot)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomSnapshot > rooms_;
+    uint64_t generation_;
+    uint32_t next_room_id_;
+    uint32_t next_bot_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomJournalRecord final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:sanguosha.RoomJournalRecord) */ {
+ public:
+  inline RoomJournalRecord() : RoomJournalRecord(nullptr) {}
+  ~RoomJournalRecord() override;
+  explicit PROTOBUF_CONSTEXPR RoomJournalRecord(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomJournalRecord(const RoomJournalRecord& from);
+  RoomJournalRecord(RoomJournalRecord&& from) noexcept
+    : RoomJournalRecord() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomJournalRecord& operator=(const RoomJournalRecord& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomJournalRecord& operator=(RoomJournalRecord&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomJournalRecord& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomJournalRecord* internal_default_instance() {
+    return reinterpret_cast<const RoomJournalRecord*>(
+               &_RoomJournalRecord_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(RoomJournalRecord& a, RoomJournalRecord& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomJournalRecord* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomJournalRecord* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomJournalRecord* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomJournalRecord>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomJournalRecord& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomJournalRecord& from) {
+    RoomJournalRecord::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomJournalRecord* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "sanguosha.RoomJournalRecord";
+  }
+  protected:
+  explicit RoomJournalRecord(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef RoomJournalRecord_Kind Kind;
+  static constexpr Kind ROOM_STATE =
+    RoomJournalRecord_Kind_ROOM_STATE;
+  static constexpr Kind ROOM_CLOSED =
+    RoomJournalRecord_Kind_ROOM_CLOSED;
+  static constexpr Kind GAME_ACTION =
+    RoomJournalRecord_Kind_GAME_ACTION;
+  static constexpr Kind TURN_TIMEOUT =
+    RoomJournalRecord_Kind_TURN_TIMEOUT;
+  static constexpr Kind RESPONSE_TIMEOUT =
+    RoomJournalRecord_Kind_RESPONSE_TIMEOUT;
+  static constexpr Kind FORFEIT =
+    RoomJournalRecord_Kind_FORFEIT;
+  static inline bool Kind_IsValid(int value) {
+    return RoomJournalRecord_Kind_IsValid(value);
+  }
+  static constexpr Kind Kind_MIN =
+    RoomJournalRecord_Kind_Kind_MIN;
+  static constexpr Kind Kind_MAX =
+    RoomJournalRecord_Kind_Kind_MAX;
+  static constexpr int Kind_ARRAYSIZE =
+    RoomJournalRecord_Kind_Kind_ARRAYSIZE;
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
+  Kind_descriptor() {
+    return RoomJournalRecord_Kind_descriptor();
+  }
+  template<typename T>
+  static inline const std::string& Kind_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Kind>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Kind_Name.");
+    return RoomJournalRecord_Kind_Name(enum_t_value);
+  }
+  static inline bool Kind_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
+      Kind* value) {
+    return RoomJournalRecord_Kind_Parse(name, value);
+  }
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomFieldNumber = 3,
+    kActionFieldNumber = 5,
+    kKindFieldNumber = 1,
+    kRoomIdFieldNumber = 2,
+    kSequenceFieldNumber = 6,
+    kPlayerIdFieldNumber = 4,
+  };
+  // .sanguosha.RoomSnapshot room = 3;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const ::sanguosha::RoomSnapshot& room() const;
+  PROTOBUF_NODISCARD ::sanguosha::RoomSnapshot* release_room();
+  ::sanguosha::RoomSnapshot* mutable_room();
+  void set_allocated_room(::sanguosha::RoomSnapshot* room);
+  private:
+  const ::sanguosha::RoomSnapshot& _internal_room() const;
+  ::sanguosha::RoomSnapshot* _internal_mutable_room();
+  public:
+  void unsafe_arena_set_allocated_room(
+      ::sanguosha::RoomSnapshot* room);
+  ::sanguosha::RoomSnapshot* unsafe_arena_release_room();
+
+  // .sanguosha.GameAction action = 5;
+  bool has_action() const;
+  private:
+  bool _internal_has_action() const;
+  public:
+  void clear_action();
+  const ::sanguosha::GameAction& action() const;
+  PROTOBUF_NODISCARD ::sanguosha::GameAction* release_action();
+  ::sanguosha::GameAction* mutable_action();
+  void set_allocated_action(::sanguosha::GameAction* action);
+  private:
+  const ::sanguosha::GameAction& _internal_action() const;
+  ::sanguosha::GameAction* _internal_mutable_action();
+  public:
+  void unsafe_arena_set_allocated_action(
+      ::sanguosha::GameAction* action);
+  ::sanguosha::GameAction* unsafe_arena_release_action();
+
+  // .sanguosha.RoomJournalRecord.Kind kind = 1;
+  void clear_kind();
+  ::sanguosha::RoomJournalRecord_Kind kind() const;
+  void set_kind(::sanguosha::RoomJournalRecord_Kind value);
+  private:
+  ::sanguosha::RoomJournalRecord_Kind _internal_kind() const;
+  void _internal_set_kind(::sanguosha::RoomJournalRecord_Kind value);
+  public:
+
+  // uint32 room_id = 2;
+  void clear_room_id();
+  uint32_t room_id() const;
+  void set_room_id(uint32_t value);
+  private:
+  uint32_t _internal_room_id() const;
+  void _internal_set_room_id(uint32_t value);
+  public:
+
+  // uint64 sequence = 6;
+  void clear_sequence();
+  uint64_t sequence() const;
+  void set_sequence(uint64_t value);
+  private:
+  uint64_t _internal_sequence() const;
+  void _internal_set_sequence(uint64_t value);
+  public:
+
+  // uint32 player_id = 4;
+  void clear_player_id();
+  uint32_t player_id() const;
+  void set_player_id(uint32_t value);
+  private:
+  uint32_t _internal_player_id() const;
+  void _internal_set_player_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:sanguosha.RoomJournalRecord)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::sanguosha::RoomSnapshot* room_;
+    ::sanguosha::GameAction* action_;
+    int kind_;
+    uint32_t room_id_;
+    uint64_t sequence_;
+    uint32_t player_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_sanguosha_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// LoginRequest
+
+// string username = 1;
+inline void LoginRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& LoginRequest::username() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.username)
+}
+inline std::string* LoginRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.username)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void LoginRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginRequest::release_username() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.username)
+  return _impl_.username_.Release();
+}
+inline void LoginRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.username)
+}
+
+// string password = 2;
+inline void LoginRequest::clear_password() {
+  _impl_.password_.ClearToEmpty();
+}
+inline const std::string& LoginRequest::password() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.password)
+  return _internal_password();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_password(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.password_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.password)
+}
+inline std::string* LoginRequest::mutable_password() {
+  std::string* _s = _internal_mutable_password();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.password)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_password() const {
+  return _impl_.password_.Get();
+}
+inline void LoginRequest::_internal_set_password(const std::string& value) {
+  
+  _impl_.password_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginRequest::_internal_mutable_password() {
+  
+  return _impl_.password_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginRequest::release_password() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.password)
+  return _impl_.password_.Release();
+}
+inline void LoginRequest::set_allocated_password(std::string* password) {
+  if (password != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.password_.SetAllocated(password, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.password_.IsDefault()) {
+    _impl_.password_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.password)
+}
+
+// string resume_token = 3;
+inline void LoginRequest::clear_resume_token() {
+  _impl_.resume_token_.ClearToEmpty();
+}
+inline const std::string& LoginRequest::resume_token() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.resume_token)
+  return _internal_resume_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginRequest::set_resume_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.resume_token)
+}
+inline std::string* LoginRequest::mutable_resume_token() {
+  std::string* _s = _internal_mutable_resume_token();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginRequest.resume_token)
+  return _s;
+}
+inline const std::string& LoginRequest::_internal_resume_token() const {
+  return _impl_.resume_token_.Get();
+}
+inline void LoginRequest::_internal_set_resume_token(const std::string& value) {
+  
+  _impl_.resume_token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginRequest::_internal_mutable_resume_token() {
+  
+  return _impl_.resume_token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginRequest::release_resume_token() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginRequest.resume_token)
+  return _impl_.resume_token_.Release();
+}
+inline void LoginRequest::set_allocated_resume_token(std::string* resume_token) {
+  if (resume_token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.resume_token_.SetAllocated(resume_token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_token_.IsDefault()) {
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginRequest.resume_token)
+}
+
+// uint32 capabilities = 4;
+inline void LoginRequest::clear_capabilities() {
+  _impl_.capabilities_ = 0u;
+}
+inline uint32_t LoginRequest::_internal_capabilities() const {
+  return _impl_.capabilities_;
+}
+inline uint32_t LoginRequest::capabilities() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginRequest.capabilities)
+  return _internal_capabilities();
+}
+inline void LoginRequest::_internal_set_capabilities(uint32_t value) {
+  
+  _impl_.capabilities_ = value;
+}
+inline void LoginRequest::set_capabilities(uint32_t value) {
+  _internal_set_capabilities(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginRequest.capabilities)
+}
+
+// -------------------------------------------------------------------
+
+// LoginResponse
+
+// bool success = 1;
+inline void LoginResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool LoginResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool LoginResponse::success() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.success)
+  return _internal_success();
+}
+inline void LoginResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void LoginResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.success)
+}
+
+// string error_message = 2;
+inline void LoginResponse::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+}
+inline const std::string& LoginResponse::error_message() const {
   // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.error_message)
-  return error_message_.GetNoArena();
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.error_message)
+}
+inline std::string* LoginResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginResponse.error_message)
+  return _s;
+}
+inline const std::string& LoginResponse::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void LoginResponse::_internal_set_error_message(const std::string& value) {
+  
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginResponse::_internal_mutable_error_message() {
+  
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginResponse::release_error_message() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginResponse.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void LoginResponse::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginResponse.error_message)
+}
+
+// uint32 user_id = 3;
+inline void LoginResponse::clear_user_id() {
+  _impl_.user_id_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_user_id() const {
+  return _impl_.user_id_;
+}
+inline uint32_t LoginResponse::user_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.user_id)
+  return _internal_user_id();
+}
+inline void LoginResponse::_internal_set_user_id(uint32_t value) {
+  
+  _impl_.user_id_ = value;
+}
+inline void LoginResponse::set_user_id(uint32_t value) {
+  _internal_set_user_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.user_id)
+}
+
+// string resume_token = 4;
+inline void LoginResponse::clear_resume_token() {
+  _impl_.resume_token_.ClearToEmpty();
+}
+inline const std::string& LoginResponse::resume_token() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.resume_token)
+  return _internal_resume_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LoginResponse::set_resume_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.resume_token)
+}
+inline std::string* LoginResponse::mutable_resume_token() {
+  std::string* _s = _internal_mutable_resume_token();
+  // @@protoc_insertion_point(field_mutable:sanguosha.LoginResponse.resume_token)
+  return _s;
+}
+inline const std::string& LoginResponse::_internal_resume_token() const {
+  return _impl_.resume_token_.Get();
+}
+inline void LoginResponse::_internal_set_resume_token(const std::string& value) {
+  
+  _impl_.resume_token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LoginResponse::_internal_mutable_resume_token() {
+  
+  return _impl_.resume_token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LoginResponse::release_resume_token() {
+  // @@protoc_insertion_point(field_release:sanguosha.LoginResponse.resume_token)
+  return _impl_.resume_token_.Release();
+}
+inline void LoginResponse::set_allocated_resume_token(std::string* resume_token) {
+  if (resume_token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.resume_token_.SetAllocated(resume_token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_token_.IsDefault()) {
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginResponse.resume_token)
+}
+
+// bool resumed = 5;
+inline void LoginResponse::clear_resumed() {
+  _impl_.resumed_ = false;
+}
+inline bool LoginResponse::_internal_resumed() const {
+  return _impl_.resumed_;
+}
+inline bool LoginResponse::resumed() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.resumed)
+  return _internal_resumed();
+}
+inline void LoginResponse::_internal_set_resumed(bool value) {
+  
+  _impl_.resumed_ = value;
+}
+inline void LoginResponse::set_resumed(bool value) {
+  _internal_set_resumed(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.resumed)
+}
+
+// uint32 room_id = 6;
+inline void LoginResponse::clear_room_id() {
+  _impl_.room_id_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint32_t LoginResponse::room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.room_id)
+  return _internal_room_id();
+}
+inline void LoginResponse::_internal_set_room_id(uint32_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void LoginResponse::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.room_id)
+}
+
+// uint32 retry_after_ms = 7;
+inline void LoginResponse::clear_retry_after_ms() {
+  _impl_.retry_after_ms_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_retry_after_ms() const {
+  return _impl_.retry_after_ms_;
+}
+inline uint32_t LoginResponse::retry_after_ms() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.retry_after_ms)
+  return _internal_retry_after_ms();
+}
+inline void LoginResponse::_internal_set_retry_after_ms(uint32_t value) {
+  
+  _impl_.retry_after_ms_ = value;
+}
+inline void LoginResponse::set_retry_after_ms(uint32_t value) {
+  _internal_set_retry_after_ms(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.retry_after_ms)
+}
+
+// uint32 capabilities = 8;
+inline void LoginResponse::clear_capabilities() {
+  _impl_.capabilities_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_capabilities() const {
+  return _impl_.capabilities_;
+}
+inline uint32_t LoginResponse::capabilities() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.capabilities)
+  return _internal_capabilities();
+}
+inline void LoginResponse::_internal_set_capabilities(uint32_t value) {
+  
+  _impl_.capabilities_ = value;
+}
+inline void LoginResponse::set_capabilities(uint32_t value) {
+  _internal_set_capabilities(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.capabilities)
+}
+
+// uint32 dictionary_id = 9;
+inline void LoginResponse::clear_dictionary_id() {
+  _impl_.dictionary_id_ = 0u;
+}
+inline uint32_t LoginResponse::_internal_dictionary_id() const {
+  return _impl_.dictionary_id_;
+}
+inline uint32_t LoginResponse::dictionary_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.dictionary_id)
+  return _internal_dictionary_id();
+}
+inline void LoginResponse::_internal_set_dictionary_id(uint32_t value) {
+  
+  _impl_.dictionary_id_ = value;
+}
+inline void LoginResponse::set_dictionary_id(uint32_t value) {
+  _internal_set_dictionary_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.dictionary_id)
+}
+
+// -------------------------------------------------------------------
+
+// Heartbeat
+
+// uint64 timestamp = 1;
+inline void Heartbeat::clear_timestamp() {
+  _impl_.timestamp_ = uint64_t{0u};
+}
+inline uint64_t Heartbeat::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline uint64_t Heartbeat::timestamp() const {
+  // @@protoc_insertion_point(field_get:sanguosha.Heartbeat.timestamp)
+  return _internal_timestamp();
+}
+inline void Heartbeat::_internal_set_timestamp(uint64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void Heartbeat::set_timestamp(uint64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:sanguosha.Heartbeat.timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// RoomInfo
+
+// uint32 room_id = 1;
+inline void RoomInfo::clear_room_id() {
+  _impl_.room_id_ = 0u;
+}
+inline uint32_t RoomInfo::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint32_t RoomInfo::room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.room_id)
+  return _internal_room_id();
+}
+inline void RoomInfo::_internal_set_room_id(uint32_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void RoomInfo::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.room_id)
+}
+
+// repeated uint32 players = 2;
+inline int RoomInfo::_internal_players_size() const {
+  return _impl_.players_.size();
+}
+inline int RoomInfo::players_size() const {
+  return _internal_players_size();
+}
+inline void RoomInfo::clear_players() {
+  _impl_.players_.Clear();
+}
+inline uint32_t RoomInfo::_internal_players(int index) const {
+  return _impl_.players_.Get(index);
+}
+inline uint32_t RoomInfo::players(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.players)
+  return _internal_players(index);
+}
+inline void RoomInfo::set_players(int index, uint32_t value) {
+  _impl_.players_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.players)
+}
+inline void RoomInfo::_internal_add_players(uint32_t value) {
+  _impl_.players_.Add(value);
+}
+inline void RoomInfo::add_players(uint32_t value) {
+  _internal_add_players(value);
+  // @@protoc_insertion_point(field_add:sanguosha.RoomInfo.players)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoomInfo::_internal_players() const {
+  return _impl_.players_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoomInfo::players() const {
+  // @@protoc_insertion_point(field_list:sanguosha.RoomInfo.players)
+  return _internal_players();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoomInfo::_internal_mutable_players() {
+  return &_impl_.players_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoomInfo::mutable_players() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomInfo.players)
+  return _internal_mutable_players();
+}
+
+// uint32 current_players = 3;
+inline void RoomInfo::clear_current_players() {
+  _impl_.current_players_ = 0u;
+}
+inline uint32_t RoomInfo::_internal_current_players() const {
+  return _impl_.current_players_;
+}
+inline uint32_t RoomInfo::current_players() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.current_players)
+  return _internal_current_players();
+}
+inline void RoomInfo::_internal_set_current_players(uint32_t value) {
+  
+  _impl_.current_players_ = value;
+}
+inline void RoomInfo::set_current_players(uint32_t value) {
+  _internal_set_current_players(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.current_players)
+}
+
+// uint32 max_players = 4;
+inline void RoomInfo::clear_max_players() {
+  _impl_.max_players_ = 0u;
+}
+inline uint32_t RoomInfo::_internal_max_players() const {
+  return _impl_.max_players_;
+}
+inline uint32_t RoomInfo::max_players() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.max_players)
+  return _internal_max_players();
+}
+inline void RoomInfo::_internal_set_max_players(uint32_t value) {
+  
+  _impl_.max_players_ = value;
+}
+inline void RoomInfo::set_max_players(uint32_t value) {
+  _internal_set_max_players(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.max_players)
+}
+
+// .sanguosha.RoomStatus status = 5;
+inline void RoomInfo::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::sanguosha::RoomStatus RoomInfo::_internal_status() const {
+  return static_cast< ::sanguosha::RoomStatus >(_impl_.status_);
+}
+inline ::sanguosha::RoomStatus RoomInfo::status() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.status)
+  return _internal_status();
+}
+inline void RoomInfo::_internal_set_status(::sanguosha::RoomStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void RoomInfo::set_status(::sanguosha::RoomStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.status)
+}
+
+// -------------------------------------------------------------------
+
+// RoomRequest
+
+// .sanguosha.RoomAction action = 1;
+inline void RoomRequest::clear_action() {
+  _impl_.action_ = 0;
+}
+inline ::sanguosha::RoomAction RoomRequest::_internal_action() const {
+  return static_cast< ::sanguosha::RoomAction >(_impl_.action_);
+}
+inline ::sanguosha::RoomAction RoomRequest::action() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.action)
+  return _internal_action();
+}
+inline void RoomRequest::_internal_set_action(::sanguosha::RoomAction value) {
+  
+  _impl_.action_ = value;
+}
+inline void RoomRequest::set_action(::sanguosha::RoomAction value) {
+  _internal_set_action(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.action)
+}
+
+// uint32 room_id = 2;
+inline void RoomRequest::clear_room_id() {
+  _impl_.room_id_ = 0u;
+}
+inline uint32_t RoomRequest::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint32_t RoomRequest::room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.room_id)
+  return _internal_room_id();
+}
+inline void RoomRequest::_internal_set_room_id(uint32_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void RoomRequest::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.room_id)
+}
+
+// uint32 max_players = 3;
+inline void RoomRequest::clear_max_players() {
+  _impl_.max_players_ = 0u;
+}
+inline uint32_t RoomRequest::_internal_max_players() const {
+  return _impl_.max_players_;
+}
+inline uint32_t RoomRequest::max_players() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.max_players)
+  return _internal_max_players();
+}
+inline void RoomRequest::_internal_set_max_players(uint32_t value) {
+  
+  _impl_.max_players_ = value;
+}
+inline void RoomRequest::set_max_players(uint32_t value) {
+  _internal_set_max_players(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.max_players)
+}
+
+// -------------------------------------------------------------------
+
+// RoomResponse
+
+// bool success = 1;
+inline void RoomResponse::clear_success() {
+  _impl_.success_ = false;
+}
+inline bool RoomResponse::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool RoomResponse::success() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.success)
+  return _internal_success();
+}
+inline void RoomResponse::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
+}
+inline void RoomResponse::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomResponse.success)
+}
+
+// string error_message = 2;
+inline void RoomResponse::clear_error_message() {
+  _impl_.error_message_.ClearToEmpty();
+}
+inline const std::string& RoomResponse::error_message() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.error_message)
+  return _internal_error_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomResponse::set_error_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.RoomResponse.error_message)
+}
+inline std::string* RoomResponse::mutable_error_message() {
+  std::string* _s = _internal_mutable_error_message();
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.error_message)
+  return _s;
+}
+inline const std::string& RoomResponse::_internal_error_message() const {
+  return _impl_.error_message_.Get();
+}
+inline void RoomResponse::_internal_set_error_message(const std::string& value) {
+  
+  _impl_.error_message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomResponse::_internal_mutable_error_message() {
+  
+  return _impl_.error_message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomResponse::release_error_message() {
+  // @@protoc_insertion_point(field_release:sanguosha.RoomResponse.error_message)
+  return _impl_.error_message_.Release();
+}
+inline void RoomResponse::set_allocated_error_message(std::string* error_message) {
+  if (error_message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_message_.SetAllocated(error_message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_message_.IsDefault()) {
+    _impl_.error_message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomResponse.error_message)
+}
+
+// .sanguosha.RoomInfo room_info = 3;
+inline bool RoomResponse::_internal_has_room_info() const {
+  return this != internal_default_instance() && _impl_.room_info_ != nullptr;
+}
+inline bool RoomResponse::has_room_info() const {
+  return _internal_has_room_info();
+}
+inline void RoomResponse::clear_room_info() {
+  if (GetArenaForAllocation() == nullptr && _impl_.room_info_ != nullptr) {
+    delete _impl_.room_info_;
+  }
+  _impl_.room_info_ = nullptr;
+}
+inline const ::sanguosha::RoomInfo& RoomResponse::_internal_room_info() const {
+  const ::sanguosha::RoomInfo* p = _impl_.room_info_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sanguosha::RoomInfo&>(
+      ::sanguosha::_RoomInfo_default_instance_);
+}
+inline const ::sanguosha::RoomInfo& RoomResponse::room_info() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.room_info)
+  return _internal_room_info();
+}
+inline void RoomResponse::unsafe_arena_set_allocated_room_info(
+    ::sanguosha::RoomInfo* room_info) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.room_info_);
+  }
+  _impl_.room_info_ = room_info;
+  if (room_info) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.RoomResponse.room_info)
+}
+inline ::sanguosha::RoomInfo* RoomResponse::release_room_info() {
+  
+  ::sanguosha::RoomInfo* temp = _impl_.room_info_;
+  _impl_.room_info_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::sanguosha::RoomInfo* RoomResponse::unsafe_arena_release_room_info() {
+  // @@protoc_insertion_point(field_release:sanguosha.RoomResponse.room_info)
+  
+  ::sanguosha::RoomInfo* temp = _impl_.room_info_;
+  _impl_.room_info_ = nullptr;
+  return temp;
+}
+inline ::sanguosha::RoomInfo* RoomResponse::_internal_mutable_room_info() {
+  
+  if (_impl_.room_info_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sanguosha::RoomInfo>(GetArenaForAllocation());
+    _impl_.room_info_ = p;
+  }
+  return _impl_.room_info_;
+}
+inline ::sanguosha::RoomInfo* RoomResponse::mutable_room_info() {
+  ::sanguosha::RoomInfo* _msg = _internal_mutable_room_info();
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.room_info)
+  return _msg;
+}
+inline void RoomResponse::set_allocated_room_info(::sanguosha::RoomInfo* room_info) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.room_info_;
+  }
+  if (room_info) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room_info);
+    if (message_arena != submessage_arena) {
+      room_info = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room_info, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.room_info_ = room_info;
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomResponse.room_info)
+}
+
+// -------------------------------------------------------------------
+
+// RoomListResponse
+
+// repeated .sanguosha.RoomInfo rooms = 1;
+inline int RoomListResponse::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
+}
+inline int RoomListResponse::rooms_size() const {
+  return _internal_rooms_size();
+}
+inline void RoomListResponse::clear_rooms() {
+  _impl_.rooms_.Clear();
+}
+inline ::sanguosha::RoomInfo* RoomListResponse::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomListResponse.rooms)
+  return _impl_.rooms_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >*
+RoomListResponse::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomListResponse.rooms)
+  return &_impl_.rooms_;
+}
+inline const ::sanguosha::RoomInfo& RoomListResponse::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
+}
+inline const ::sanguosha::RoomInfo& RoomListResponse::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomListResponse.rooms)
+  return _internal_rooms(index);
+}
+inline ::sanguosha::RoomInfo* RoomListResponse::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
+}
+inline ::sanguosha::RoomInfo* RoomListResponse::add_rooms() {
+  ::sanguosha::RoomInfo* _add = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add:sanguosha.RoomListResponse.rooms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomInfo >&
+RoomListResponse::rooms() const {
+  // @@protoc_insertion_point(field_list:sanguosha.RoomListResponse.rooms)
+  return _impl_.rooms_;
+}
+
+// -------------------------------------------------------------------
+
+// GameAction
+
+// .sanguosha.ActionType type = 1;
+inline void GameAction::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::sanguosha::ActionType GameAction::_internal_type() const {
+  return static_cast< ::sanguosha::ActionType >(_impl_.type_);
+}
+inline ::sanguosha::ActionType GameAction::type() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameAction.type)
+  return _internal_type();
+}
+inline void GameAction::_internal_set_type(::sanguosha::ActionType value) {
+  
+  _impl_.type_ = value;
+}
+inline void GameAction::set_type(::sanguosha::ActionType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameAction.type)
+}
+
+// uint32 card_id = 2;
+inline void GameAction::clear_card_id() {
+  _impl_.card_id_ = 0u;
+}
+inline uint32_t GameAction::_internal_card_id() const {
+  return _impl_.card_id_;
+}
+inline uint32_t GameAction::card_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameAction.card_id)
+  return _internal_card_id();
+}
+inline void GameAction::_internal_set_card_id(uint32_t value) {
+  
+  _impl_.card_id_ = value;
+}
+inline void GameAction::set_card_id(uint32_t value) {
+  _internal_set_card_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameAction.card_id)
+}
+
+// uint32 target_player = 3;
+inline void GameAction::clear_target_player() {
+  _impl_.target_player_ = 0u;
+}
+inline uint32_t GameAction::_internal_target_player() const {
+  return _impl_.target_player_;
+}
+inline uint32_t GameAction::target_player() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameAction.target_player)
+  return _internal_target_player();
+}
+inline void GameAction::_internal_set_target_player(uint32_t value) {
+  
+  _impl_.target_player_ = value;
+}
+inline void GameAction::set_target_player(uint32_t value) {
+  _internal_set_target_player(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameAction.target_player)
+}
+
+// uint32 prompt_id = 4;
+inline void GameAction::clear_prompt_id() {
+  _impl_.prompt_id_ = 0u;
+}
+inline uint32_t GameAction::_internal_prompt_id() const {
+  return _impl_.prompt_id_;
+}
+inline uint32_t GameAction::prompt_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameAction.prompt_id)
+  return _internal_prompt_id();
+}
+inline void GameAction::_internal_set_prompt_id(uint32_t value) {
+  
+  _impl_.prompt_id_ = value;
+}
+inline void GameAction::set_prompt_id(uint32_t value) {
+  _internal_set_prompt_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameAction.prompt_id)
+}
+
+// -------------------------------------------------------------------
+
+// ResponsePrompt
+
+// uint32 prompt_id = 1;
+inline void ResponsePrompt::clear_prompt_id() {
+  _impl_.prompt_id_ = 0u;
+}
+inline uint32_t ResponsePrompt::_internal_prompt_id() const {
+  return _impl_.prompt_id_;
+}
+inline uint32_t ResponsePrompt::prompt_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.ResponsePrompt.prompt_id)
+  return _internal_prompt_id();
+}
+inline void ResponsePrompt::_internal_set_prompt_id(uint32_t value) {
+  
+  _impl_.prompt_id_ = value;
+}
+inline void ResponsePrompt::set_prompt_id(uint32_t value) {
+  _internal_set_prompt_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.ResponsePrompt.prompt_id)
+}
+
+// .sanguosha.CardType card_type = 2;
+inline void ResponsePrompt::clear_card_type() {
+  _impl_.card_type_ = 0;
+}
+inline ::sanguosha::CardType ResponsePrompt::_internal_card_type() const {
+  return static_cast< ::sanguosha::CardType >(_impl_.card_type_);
+}
+inline ::sanguosha::CardType ResponsePrompt::card_type() const {
+  // @@protoc_insertion_point(field_get:sanguosha.ResponsePrompt.card_type)
+  return _internal_card_type();
+}
+inline void ResponsePrompt::_internal_set_card_type(::sanguosha::CardType value) {
+  
+  _impl_.card_type_ = value;
+}
+inline void ResponsePrompt::set_card_type(::sanguosha::CardType value) {
+  _internal_set_card_type(value);
+  // @@protoc_insertion_point(field_set:sanguosha.ResponsePrompt.card_type)
+}
+
+// uint32 source_player = 3;
+inline void ResponsePrompt::clear_source_player() {
+  _impl_.source_player_ = 0u;
+}
+inline uint32_t ResponsePrompt::_internal_source_player() const {
+  return _impl_.source_player_;
+}
+inline uint32_t ResponsePrompt::source_player() const {
+  // @@protoc_insertion_point(field_get:sanguosha.ResponsePrompt.source_player)
+  return _internal_source_player();
+}
+inline void ResponsePrompt::_internal_set_source_player(uint32_t value) {
+  
+  _impl_.source_player_ = value;
+}
+inline void ResponsePrompt::set_source_player(uint32_t value) {
+  _internal_set_source_player(value);
+  // @@protoc_insertion_point(field_set:sanguosha.ResponsePrompt.source_player)
+}
+
+// uint32 timeout_ms = 4;
+inline void ResponsePrompt::clear_timeout_ms() {
+  _impl_.timeout_ms_ = 0u;
+}
+inline uint32_t ResponsePrompt::_internal_timeout_ms() const {
+  return _impl_.timeout_ms_;
+}
+inline uint32_t ResponsePrompt::timeout_ms() const {
+  // @@protoc_insertion_point(field_get:sanguosha.ResponsePrompt.timeout_ms)
+  return _internal_timeout_ms();
+}
+inline void ResponsePrompt::_internal_set_timeout_ms(uint32_t value) {
+  
+  _impl_.timeout_ms_ = value;
+}
+inline void ResponsePrompt::set_timeout_ms(uint32_t value) {
+  _internal_set_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:sanguosha.ResponsePrompt.timeout_ms)
+}
+
+// -------------------------------------------------------------------
+
+// PlayerState
+
+// uint32 player_id = 1;
+inline void PlayerState::clear_player_id() {
+  _impl_.player_id_ = 0u;
+}
+inline uint32_t PlayerState::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint32_t PlayerState::player_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.player_id)
+  return _internal_player_id();
+}
+inline void PlayerState::_internal_set_player_id(uint32_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void PlayerState::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.player_id)
+}
+
+// string username = 2;
+inline void PlayerState::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& PlayerState::username() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PlayerState::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.username)
+}
+inline std::string* PlayerState::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:sanguosha.PlayerState.username)
+  return _s;
+}
+inline const std::string& PlayerState::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PlayerState::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PlayerState::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PlayerState::release_username() {
+  // @@protoc_insertion_point(field_release:sanguosha.PlayerState.username)
+  return _impl_.username_.Release();
+}
+inline void PlayerState::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.PlayerState.username)
+}
+
+// uint32 hp = 3;
+inline void PlayerState::clear_hp() {
+  _impl_.hp_ = 0u;
+}
+inline uint32_t PlayerState::_internal_hp() const {
+  return _impl_.hp_;
+}
+inline uint32_t PlayerState::hp() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.hp)
+  return _internal_hp();
+}
+inline void PlayerState::_internal_set_hp(uint32_t value) {
+  
+  _impl_.hp_ = value;
+}
+inline void PlayerState::set_hp(uint32_t value) {
+  _internal_set_hp(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.hp)
+}
+
+// uint32 max_hp = 4;
+inline void PlayerState::clear_max_hp() {
+  _impl_.max_hp_ = 0u;
+}
+inline uint32_t PlayerState::_internal_max_hp() const {
+  return _impl_.max_hp_;
+}
+inline uint32_t PlayerState::max_hp() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.max_hp)
+  return _internal_max_hp();
+}
+inline void PlayerState::_internal_set_max_hp(uint32_t value) {
+  
+  _impl_.max_hp_ = value;
+}
+inline void PlayerState::set_max_hp(uint32_t value) {
+  _internal_set_max_hp(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.max_hp)
+}
+
+// repeated uint32 hand_cards = 5;
+inline int PlayerState::_internal_hand_cards_size() const {
+  return _impl_.hand_cards_.size();
+}
+inline int PlayerState::hand_cards_size() const {
+  return _internal_hand_cards_size();
+}
+inline void PlayerState::clear_hand_cards() {
+  _impl_.hand_cards_.Clear();
+}
+inline uint32_t PlayerState::_internal_hand_cards(int index) const {
+  return _impl_.hand_cards_.Get(index);
+}
+inline uint32_t PlayerState::hand_cards(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.hand_cards)
+  return _internal_hand_cards(index);
+}
+inline void PlayerState::set_hand_cards(int index, uint32_t value) {
+  _impl_.hand_cards_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.hand_cards)
+}
+inline void PlayerState::_internal_add_hand_cards(uint32_t value) {
+  _impl_.hand_cards_.Add(value);
+}
+inline void PlayerState::add_hand_cards(uint32_t value) {
+  _internal_add_hand_cards(value);
+  // @@protoc_insertion_point(field_add:sanguosha.PlayerState.hand_cards)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PlayerState::_internal_hand_cards() const {
+  return _impl_.hand_cards_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+PlayerState::hand_cards() const {
+  // @@protoc_insertion_point(field_list:sanguosha.PlayerState.hand_cards)
+  return _internal_hand_cards();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PlayerState::_internal_mutable_hand_cards() {
+  return &_impl_.hand_cards_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+PlayerState::mutable_hand_cards() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.PlayerState.hand_cards)
+  return _internal_mutable_hand_cards();
+}
+
+// .sanguosha.Role role = 6;
+inline void PlayerState::clear_role() {
+  _impl_.role_ = 0;
+}
+inline ::sanguosha::Role PlayerState::_internal_role() const {
+  return static_cast< ::sanguosha::Role >(_impl_.role_);
+}
+inline ::sanguosha::Role PlayerState::role() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.role)
+  return _internal_role();
+}
+inline void PlayerState::_internal_set_role(::sanguosha::Role value) {
+  
+  _impl_.role_ = value;
+}
+inline void PlayerState::set_role(::sanguosha::Role value) {
+  _internal_set_role(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.role)
+}
+
+// uint32 seat = 7;
+inline void PlayerState::clear_seat() {
+  _impl_.seat_ = 0u;
+}
+inline uint32_t PlayerState::_internal_seat() const {
+  return _impl_.seat_;
+}
+inline uint32_t PlayerState::seat() const {
+  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.seat)
+  return _internal_seat();
+}
+inline void PlayerState::_internal_set_seat(uint32_t value) {
+  
+  _impl_.seat_ = value;
+}
+inline void PlayerState::set_seat(uint32_t value) {
+  _internal_set_seat(value);
+  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.seat)
+}
+
+// -------------------------------------------------------------------
+
+// GameState
+
+// uint32 current_player = 1;
+inline void GameState::clear_current_player() {
+  _impl_.current_player_ = 0u;
+}
+inline uint32_t GameState::_internal_current_player() const {
+  return _impl_.current_player_;
+}
+inline uint32_t GameState::current_player() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.current_player)
+  return _internal_current_player();
+}
+inline void GameState::_internal_set_current_player(uint32_t value) {
+  
+  _impl_.current_player_ = value;
+}
+inline void GameState::set_current_player(uint32_t value) {
+  _internal_set_current_player(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameState.current_player)
+}
+
+// repeated .sanguosha.PlayerState players = 2;
+inline int GameState::_internal_players_size() const {
+  return _impl_.players_.size();
+}
+inline int GameState::players_size() const {
+  return _internal_players_size();
+}
+inline void GameState::clear_players() {
+  _impl_.players_.Clear();
+}
+inline ::sanguosha::PlayerState* GameState::mutable_players(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameState.players)
+  return _impl_.players_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >*
+GameState::mutable_players() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameState.players)
+  return &_impl_.players_;
+}
+inline const ::sanguosha::PlayerState& GameState::_internal_players(int index) const {
+  return _impl_.players_.Get(index);
+}
+inline const ::sanguosha::PlayerState& GameState::players(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.players)
+  return _internal_players(index);
+}
+inline ::sanguosha::PlayerState* GameState::_internal_add_players() {
+  return _impl_.players_.Add();
+}
+inline ::sanguosha::PlayerState* GameState::add_players() {
+  ::sanguosha::PlayerState* _add = _internal_add_players();
+  // @@protoc_insertion_point(field_add:sanguosha.GameState.players)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >&
+GameState::players() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameState.players)
+  return _impl_.players_;
+}
+
+// .sanguosha.GamePhase phase = 3;
+inline void GameState::clear_phase() {
+  _impl_.phase_ = 0;
+}
+inline ::sanguosha::GamePhase GameState::_internal_phase() const {
+  return static_cast< ::sanguosha::GamePhase >(_impl_.phase_);
+}
+inline ::sanguosha::GamePhase GameState::phase() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.phase)
+  return _internal_phase();
+}
+inline void GameState::_internal_set_phase(::sanguosha::GamePhase value) {
+  
+  _impl_.phase_ = value;
+}
+inline void GameState::set_phase(::sanguosha::GamePhase value) {
+  _internal_set_phase(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameState.phase)
+}
+
+// string game_log = 4;
+inline void GameState::clear_game_log() {
+  _impl_.game_log_.ClearToEmpty();
+}
+inline const std::string& GameState::game_log() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.game_log)
+  return _internal_game_log();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GameState::set_game_log(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.game_log_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:sanguosha.GameState.game_log)
+}
+inline std::string* GameState::mutable_game_log() {
+  std::string* _s = _internal_mutable_game_log();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameState.game_log)
+  return _s;
+}
+inline const std::string& GameState::_internal_game_log() const {
+  return _impl_.game_log_.Get();
+}
+inline void GameState::_internal_set_game_log(const std::string& value) {
+  
+  _impl_.game_log_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GameState::_internal_mutable_game_log() {
+  
+  return _impl_.game_log_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GameState::release_game_log() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameState.game_log)
+  return _impl_.game_log_.Release();
+}
+inline void GameState::set_allocated_game_log(std::string* game_log) {
+  if (game_log != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.game_log_.SetAllocated(game_log, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.game_log_.IsDefault()) {
+    _impl_.game_log_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameState.game_log)
+}
+
+// uint32 turn_timeout_ms = 5;
+inline void GameState::clear_turn_timeout_ms() {
+  _impl_.turn_timeout_ms_ = 0u;
+}
+inline uint32_t GameState::_internal_turn_timeout_ms() const {
+  return _impl_.turn_timeout_ms_;
+}
+inline uint32_t GameState::turn_timeout_ms() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameState.turn_timeout_ms)
+  return _internal_turn_timeout_ms();
+}
+inline void GameState::_internal_set_turn_timeout_ms(uint32_t value) {
+  
+  _impl_.turn_timeout_ms_ = value;
+}
+inline void GameState::set_turn_timeout_ms(uint32_t value) {
+  _internal_set_turn_timeout_ms(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameState.turn_timeout_ms)
+}
+
+// -------------------------------------------------------------------
+
+// GameStart
+
+// uint32 room_id = 1;
+inline void GameStart::clear_room_id() {
+  _impl_.room_id_ = 0u;
+}
+inline uint32_t GameStart::_internal_room_id() const {
+  return _impl_.room_id_;
+}
+inline uint32_t GameStart::room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStart.room_id)
+  return _internal_room_id();
+}
+inline void GameStart::_internal_set_room_id(uint32_t value) {
+  
+  _impl_.room_id_ = value;
+}
+inline void GameStart::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStart.room_id)
+}
+
+// repeated uint32 player_ids = 2;
+inline int GameStart::_internal_player_ids_size() const {
+  return _impl_.player_ids_.size();
+}
+inline int GameStart::player_ids_size() const {
+  return _internal_player_ids_size();
+}
+inline void GameStart::clear_player_ids() {
+  _impl_.player_ids_.Clear();
+}
+inline uint32_t GameStart::_internal_player_ids(int index) const {
+  return _impl_.player_ids_.Get(index);
+}
+inline uint32_t GameStart::player_ids(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameStart.player_ids)
+  return _internal_player_ids(index);
+}
+inline void GameStart::set_player_ids(int index, uint32_t value) {
+  _impl_.player_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameStart.player_ids)
+}
+inline void GameStart::_internal_add_player_ids(uint32_t value) {
+  _impl_.player_ids_.Add(value);
+}
+inline void GameStart::add_player_ids(uint32_t value) {
+  _internal_add_player_ids(value);
+  // @@protoc_insertion_point(field_add:sanguosha.GameStart.player_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameStart::_internal_player_ids() const {
+  return _impl_.player_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameStart::player_ids() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameStart.player_ids)
+  return _internal_player_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameStart::_internal_mutable_player_ids() {
+  return &_impl_.player_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameStart::mutable_player_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameStart.player_ids)
+  return _internal_mutable_player_ids();
+}
+
+// -------------------------------------------------------------------
+
+// GameMessage
+
+// .sanguosha.MessageType type = 1;
+inline void GameMessage::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::sanguosha::MessageType GameMessage::_internal_type() const {
+  return static_cast< ::sanguosha::MessageType >(_impl_.type_);
+}
+inline ::sanguosha::MessageType GameMessage::type() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.type)
+  return _internal_type();
+}
+inline void GameMessage::_internal_set_type(::sanguosha::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void GameMessage::set_type(::sanguosha::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameMessage.type)
+}
+
+// uint32 request_id = 12;
+inline void GameMessage::clear_request_id() {
+  _impl_.request_id_ = 0u;
+}
+inline uint32_t GameMessage::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint32_t GameMessage::request_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.request_id)
+  return _internal_request_id();
+}
+inline void GameMessage::_internal_set_request_id(uint32_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void GameMessage::set_request_id(uint32_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameMessage.request_id)
+}
+
+// .sanguosha.LoginRequest login_request = 2;
+inline bool GameMessage::_internal_has_login_request() const {
+  return content_case() == kLoginRequest;
+}
+inline bool GameMessage::has_login_request() const {
+  return _internal_has_login_request();
+}
+inline void GameMessage::set_has_login_request() {
+  _impl_._oneof_case_[0] = kLoginRequest;
+}
+inline void GameMessage::clear_login_request() {
+  if (_internal_has_login_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.login_request_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::LoginRequest* GameMessage::release_login_request() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.login_request)
+  if (_internal_has_login_request()) {
+    clear_has_content();
+    ::sanguosha::LoginRequest* temp = _impl_.content_.login_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.login_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::LoginRequest& GameMessage::_internal_login_request() const {
+  return _internal_has_login_request()
+      ? *_impl_.content_.login_request_
+      : reinterpret_cast< ::sanguosha::LoginRequest&>(::sanguosha::_LoginRequest_default_instance_);
+}
+inline const ::sanguosha::LoginRequest& GameMessage::login_request() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.login_request)
+  return _internal_login_request();
+}
+inline ::sanguosha::LoginRequest* GameMessage::unsafe_arena_release_login_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.login_request)
+  if (_internal_has_login_request()) {
+    clear_has_content();
+    ::sanguosha::LoginRequest* temp = _impl_.content_.login_request_;
+    _impl_.content_.login_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_login_request(::sanguosha::LoginRequest* login_request) {
+  clear_content();
+  if (login_request) {
+    set_has_login_request();
+    _impl_.content_.login_request_ = login_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.login_request)
+}
+inline ::sanguosha::LoginRequest* GameMessage::_internal_mutable_login_request() {
+  if (!_internal_has_login_request()) {
+    clear_content();
+    set_has_login_request();
+    _impl_.content_.login_request_ = CreateMaybeMessage< ::sanguosha::LoginRequest >(GetArenaForAllocation());
+  }
+  return _impl_.content_.login_request_;
+}
+inline ::sanguosha::LoginRequest* GameMessage::mutable_login_request() {
+  ::sanguosha::LoginRequest* _msg = _internal_mutable_login_request();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.login_request)
+  return _msg;
+}
+
+// .sanguosha.LoginResponse login_response = 3;
+inline bool GameMessage::_internal_has_login_response() const {
+  return content_case() == kLoginResponse;
+}
+inline bool GameMessage::has_login_response() const {
+  return _internal_has_login_response();
+}
+inline void GameMessage::set_has_login_response() {
+  _impl_._oneof_case_[0] = kLoginResponse;
+}
+inline void GameMessage::clear_login_response() {
+  if (_internal_has_login_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.login_response_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::LoginResponse* GameMessage::release_login_response() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.login_response)
+  if (_internal_has_login_response()) {
+    clear_has_content();
+    ::sanguosha::LoginResponse* temp = _impl_.content_.login_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.login_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::LoginResponse& GameMessage::_internal_login_response() const {
+  return _internal_has_login_response()
+      ? *_impl_.content_.login_response_
+      : reinterpret_cast< ::sanguosha::LoginResponse&>(::sanguosha::_LoginResponse_default_instance_);
+}
+inline const ::sanguosha::LoginResponse& GameMessage::login_response() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.login_response)
+  return _internal_login_response();
+}
+inline ::sanguosha::LoginResponse* GameMessage::unsafe_arena_release_login_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.login_response)
+  if (_internal_has_login_response()) {
+    clear_has_content();
+    ::sanguosha::LoginResponse* temp = _impl_.content_.login_response_;
+    _impl_.content_.login_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_login_response(::sanguosha::LoginResponse* login_response) {
+  clear_content();
+  if (login_response) {
+    set_has_login_response();
+    _impl_.content_.login_response_ = login_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.login_response)
+}
+inline ::sanguosha::LoginResponse* GameMessage::_internal_mutable_login_response() {
+  if (!_internal_has_login_response()) {
+    clear_content();
+    set_has_login_response();
+    _impl_.content_.login_response_ = CreateMaybeMessage< ::sanguosha::LoginResponse >(GetArenaForAllocation());
+  }
+  return _impl_.content_.login_response_;
+}
+inline ::sanguosha::LoginResponse* GameMessage::mutable_login_response() {
+  ::sanguosha::LoginResponse* _msg = _internal_mutable_login_response();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.login_response)
+  return _msg;
+}
+
+// .sanguosha.Heartbeat heartbeat = 4;
+inline bool GameMessage::_internal_has_heartbeat() const {
+  return content_case() == kHeartbeat;
+}
+inline bool GameMessage::has_heartbeat() const {
+  return _internal_has_heartbeat();
+}
+inline void GameMessage::set_has_heartbeat() {
+  _impl_._oneof_case_[0] = kHeartbeat;
+}
+inline void GameMessage::clear_heartbeat() {
+  if (_internal_has_heartbeat()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.heartbeat_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::Heartbeat* GameMessage::release_heartbeat() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_content();
+    ::sanguosha::Heartbeat* temp = _impl_.content_.heartbeat_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::Heartbeat& GameMessage::_internal_heartbeat() const {
+  return _internal_has_heartbeat()
+      ? *_impl_.content_.heartbeat_
+      : reinterpret_cast< ::sanguosha::Heartbeat&>(::sanguosha::_Heartbeat_default_instance_);
+}
+inline const ::sanguosha::Heartbeat& GameMessage::heartbeat() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.heartbeat)
+  return _internal_heartbeat();
+}
+inline ::sanguosha::Heartbeat* GameMessage::unsafe_arena_release_heartbeat() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.heartbeat)
+  if (_internal_has_heartbeat()) {
+    clear_has_content();
+    ::sanguosha::Heartbeat* temp = _impl_.content_.heartbeat_;
+    _impl_.content_.heartbeat_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_heartbeat(::sanguosha::Heartbeat* heartbeat) {
+  clear_content();
+  if (heartbeat) {
+    set_has_heartbeat();
+    _impl_.content_.heartbeat_ = heartbeat;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.heartbeat)
+}
+inline ::sanguosha::Heartbeat* GameMessage::_internal_mutable_heartbeat() {
+  if (!_internal_has_heartbeat()) {
+    clear_content();
+    set_has_heartbeat();
+    _impl_.content_.heartbeat_ = CreateMaybeMessage< ::sanguosha::Heartbeat >(GetArenaForAllocation());
+  }
+  return _impl_.content_.heartbeat_;
+}
+inline ::sanguosha::Heartbeat* GameMessage::mutable_heartbeat() {
+  ::sanguosha::Heartbeat* _msg = _internal_mutable_heartbeat();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.heartbeat)
+  return _msg;
+}
+
+// .sanguosha.RoomRequest room_request = 5;
+inline bool GameMessage::_internal_has_room_request() const {
+  return content_case() == kRoomRequest;
+}
+inline bool GameMessage::has_room_request() const {
+  return _internal_has_room_request();
+}
+inline void GameMessage::set_has_room_request() {
+  _impl_._oneof_case_[0] = kRoomRequest;
+}
+inline void GameMessage::clear_room_request() {
+  if (_internal_has_room_request()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.room_request_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::RoomRequest* GameMessage::release_room_request() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_request)
+  if (_internal_has_room_request()) {
+    clear_has_content();
+    ::sanguosha::RoomRequest* temp = _impl_.content_.room_request_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.room_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::RoomRequest& GameMessage::_internal_room_request() const {
+  return _internal_has_room_request()
+      ? *_impl_.content_.room_request_
+      : reinterpret_cast< ::sanguosha::RoomRequest&>(::sanguosha::_RoomRequest_default_instance_);
+}
+inline const ::sanguosha::RoomRequest& GameMessage::room_request() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_request)
+  return _internal_room_request();
+}
+inline ::sanguosha::RoomRequest* GameMessage::unsafe_arena_release_room_request() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.room_request)
+  if (_internal_has_room_request()) {
+    clear_has_content();
+    ::sanguosha::RoomRequest* temp = _impl_.content_.room_request_;
+    _impl_.content_.room_request_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_room_request(::sanguosha::RoomRequest* room_request) {
+  clear_content();
+  if (room_request) {
+    set_has_room_request();
+    _impl_.content_.room_request_ = room_request;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.room_request)
+}
+inline ::sanguosha::RoomRequest* GameMessage::_internal_mutable_room_request() {
+  if (!_internal_has_room_request()) {
+    clear_content();
+    set_has_room_request();
+    _impl_.content_.room_request_ = CreateMaybeMessage< ::sanguosha::RoomRequest >(GetArenaForAllocation());
+  }
+  return _impl_.content_.room_request_;
+}
+inline ::sanguosha::RoomRequest* GameMessage::mutable_room_request() {
+  ::sanguosha::RoomRequest* _msg = _internal_mutable_room_request();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_request)
+  return _msg;
+}
+
+// .sanguosha.RoomResponse room_response = 6;
+inline bool GameMessage::_internal_has_room_response() const {
+  return content_case() == kRoomResponse;
+}
+inline bool GameMessage::has_room_response() const {
+  return _internal_has_room_response();
+}
+inline void GameMessage::set_has_room_response() {
+  _impl_._oneof_case_[0] = kRoomResponse;
+}
+inline void GameMessage::clear_room_response() {
+  if (_internal_has_room_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.room_response_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::RoomResponse* GameMessage::release_room_response() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_response)
+  if (_internal_has_room_response()) {
+    clear_has_content();
+    ::sanguosha::RoomResponse* temp = _impl_.content_.room_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.room_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::RoomResponse& GameMessage::_internal_room_response() const {
+  return _internal_has_room_response()
+      ? *_impl_.content_.room_response_
+      : reinterpret_cast< ::sanguosha::RoomResponse&>(::sanguosha::_RoomResponse_default_instance_);
+}
+inline const ::sanguosha::RoomResponse& GameMessage::room_response() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_response)
+  return _internal_room_response();
+}
+inline ::sanguosha::RoomResponse* GameMessage::unsafe_arena_release_room_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.room_response)
+  if (_internal_has_room_response()) {
+    clear_has_content();
+    ::sanguosha::RoomResponse* temp = _impl_.content_.room_response_;
+    _impl_.content_.room_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_room_response(::sanguosha::RoomResponse* room_response) {
+  clear_content();
+  if (room_response) {
+    set_has_room_response();
+    _impl_.content_.room_response_ = room_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.room_response)
+}
+inline ::sanguosha::RoomResponse* GameMessage::_internal_mutable_room_response() {
+  if (!_internal_has_room_response()) {
+    clear_content();
+    set_has_room_response();
+    _impl_.content_.room_response_ = CreateMaybeMessage< ::sanguosha::RoomResponse >(GetArenaForAllocation());
+  }
+  return _impl_.content_.room_response_;
+}
+inline ::sanguosha::RoomResponse* GameMessage::mutable_room_response() {
+  ::sanguosha::RoomResponse* _msg = _internal_mutable_room_response();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_response)
+  return _msg;
+}
+
+// .sanguosha.GameAction game_action = 7;
+inline bool GameMessage::_internal_has_game_action() const {
+  return content_case() == kGameAction;
+}
+inline bool GameMessage::has_game_action() const {
+  return _internal_has_game_action();
+}
+inline void GameMessage::set_has_game_action() {
+  _impl_._oneof_case_[0] = kGameAction;
+}
+inline void GameMessage::clear_game_action() {
+  if (_internal_has_game_action()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_action_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::GameAction* GameMessage::release_game_action() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_action)
+  if (_internal_has_game_action()) {
+    clear_has_content();
+    ::sanguosha::GameAction* temp = _impl_.content_.game_action_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_action_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::GameAction& GameMessage::_internal_game_action() const {
+  return _internal_has_game_action()
+      ? *_impl_.content_.game_action_
+      : reinterpret_cast< ::sanguosha::GameAction&>(::sanguosha::_GameAction_default_instance_);
+}
+inline const ::sanguosha::GameAction& GameMessage::game_action() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_action)
+  return _internal_game_action();
+}
+inline ::sanguosha::GameAction* GameMessage::unsafe_arena_release_game_action() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_action)
+  if (_internal_has_game_action()) {
+    clear_has_content();
+    ::sanguosha::GameAction* temp = _impl_.content_.game_action_;
+    _impl_.content_.game_action_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_action(::sanguosha::GameAction* game_action) {
+  clear_content();
+  if (game_action) {
+    set_has_game_action();
+    _impl_.content_.game_action_ = game_action;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_action)
+}
+inline ::sanguosha::GameAction* GameMessage::_internal_mutable_game_action() {
+  if (!_internal_has_game_action()) {
+    clear_content();
+    set_has_game_action();
+    _impl_.content_.game_action_ = CreateMaybeMessage< ::sanguosha::GameAction >(GetArenaForAllocation());
+  }
+  return _impl_.content_.game_action_;
+}
+inline ::sanguosha::GameAction* GameMessage::mutable_game_action() {
+  ::sanguosha::GameAction* _msg = _internal_mutable_game_action();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_action)
+  return _msg;
+}
+
+// .sanguosha.GameState game_state = 8;
+inline bool GameMessage::_internal_has_game_state() const {
+  return content_case() == kGameState;
+}
+inline bool GameMessage::has_game_state() const {
+  return _internal_has_game_state();
+}
+inline void GameMessage::set_has_game_state() {
+  _impl_._oneof_case_[0] = kGameState;
+}
+inline void GameMessage::clear_game_state() {
+  if (_internal_has_game_state()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_state_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::GameState* GameMessage::release_game_state() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_state)
+  if (_internal_has_game_state()) {
+    clear_has_content();
+    ::sanguosha::GameState* temp = _impl_.content_.game_state_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::GameState& GameMessage::_internal_game_state() const {
+  return _internal_has_game_state()
+      ? *_impl_.content_.game_state_
+      : reinterpret_cast< ::sanguosha::GameState&>(::sanguosha::_GameState_default_instance_);
+}
+inline const ::sanguosha::GameState& GameMessage::game_state() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_state)
+  return _internal_game_state();
+}
+inline ::sanguosha::GameState* GameMessage::unsafe_arena_release_game_state() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_state)
+  if (_internal_has_game_state()) {
+    clear_has_content();
+    ::sanguosha::GameState* temp = _impl_.content_.game_state_;
+    _impl_.content_.game_state_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_state(::sanguosha::GameState* game_state) {
+  clear_content();
+  if (game_state) {
+    set_has_game_state();
+    _impl_.content_.game_state_ = game_state;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_state)
+}
+inline ::sanguosha::GameState* GameMessage::_internal_mutable_game_state() {
+  if (!_internal_has_game_state()) {
+    clear_content();
+    set_has_game_state();
+    _impl_.content_.game_state_ = CreateMaybeMessage< ::sanguosha::GameState >(GetArenaForAllocation());
+  }
+  return _impl_.content_.game_state_;
+}
+inline ::sanguosha::GameState* GameMessage::mutable_game_state() {
+  ::sanguosha::GameState* _msg = _internal_mutable_game_state();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_state)
+  return _msg;
+}
+
+// .sanguosha.GameStart game_start = 9;
+inline bool GameMessage::_internal_has_game_start() const {
+  return content_case() == kGameStart;
+}
+inline bool GameMessage::has_game_start() const {
+  return _internal_has_game_start();
+}
+inline void GameMessage::set_has_game_start() {
+  _impl_._oneof_case_[0] = kGameStart;
+}
+inline void GameMessage::clear_game_start() {
+  if (_internal_has_game_start()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_start_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::GameStart* GameMessage::release_game_start() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_start)
+  if (_internal_has_game_start()) {
+    clear_has_content();
+    ::sanguosha::GameStart* temp = _impl_.content_.game_start_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::GameStart& GameMessage::_internal_game_start() const {
+  return _internal_has_game_start()
+      ? *_impl_.content_.game_start_
+      : reinterpret_cast< ::sanguosha::GameStart&>(::sanguosha::_GameStart_default_instance_);
+}
+inline const ::sanguosha::GameStart& GameMessage::game_start() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_start)
+  return _internal_game_start();
+}
+inline ::sanguosha::GameStart* GameMessage::unsafe_arena_release_game_start() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_start)
+  if (_internal_has_game_start()) {
+    clear_has_content();
+    ::sanguosha::GameStart* temp = _impl_.content_.game_start_;
+    _impl_.content_.game_start_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void GameMessage::unsafe_arena_set_allocated_game_start(::sanguosha::GameStart* game_start) {
+  clear_content();
+  if (game_start) {
+    set_has_game_start();
+    _impl_.content_.game_start_ = game_start;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_start)
+}
+inline ::sanguosha::GameStart* GameMessage::_internal_mutable_game_start() {
+  if (!_internal_has_game_start()) {
+    clear_content();
+    set_has_game_start();
+    _impl_.content_.game_start_ = CreateMaybeMessage< ::sanguosha::GameStart >(GetArenaForAllocation());
+  }
+  return _impl_.content_.game_start_;
+}
+inline ::sanguosha::GameStart* GameMessage::mutable_game_start() {
+  ::sanguosha::GameStart* _msg = _internal_mutable_game_start();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_start)
+  return _msg;
+}
+
+// .sanguosha.GameOver game_over = 10;
+inline bool GameMessage::_internal_has_game_over() const {
+  return content_case() == kGameOver;
+}
+inline bool GameMessage::has_game_over() const {
+  return _internal_has_game_over();
+}
+inline void GameMessage::set_has_game_over() {
+  _impl_._oneof_case_[0] = kGameOver;
+}
+inline void GameMessage::clear_game_over() {
+  if (_internal_has_game_over()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.game_over_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::GameOver* GameMessage::release_game_over() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_over)
+  if (_internal_has_game_over()) {
+    clear_has_content();
+    ::sanguosha::GameOver* temp = _impl_.content_.game_over_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.game_over_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::sanguosha::GameOver& GameMessage::_internal_game_over() const {
+  return _internal_has_game_over()
+      ? *_impl_.content_.game_over_
+      : reinterpret_cast< ::sanguosha::GameOver&>(::sanguosha::_GameOver_default_instance_);
+}
+inline const ::sanguosha::GameOver& GameMessage::game_over() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_over)
+  return _internal_game_over();
+}
+inline ::sanguosha::GameOver* GameMessage::unsafe_arena_release_game_over() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.game_over)
+  if (_internal_has_game_over()) {
+    clear_has_content();
+    ::sanguosha::GameOver* temp = _impl_.content_.game_over_;
+    _impl_.content_.game_over_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline void LoginResponse::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.error_message)
+inline void GameMessage::unsafe_arena_set_allocated_game_over(::sanguosha::GameOver* game_over) {
+  clear_content();
+  if (game_over) {
+    set_has_game_over();
+    _impl_.content_.game_over_ = game_over;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.game_over)
 }
-#if LANG_CXX11
-inline void LoginResponse::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.LoginResponse.error_message)
+inline ::sanguosha::GameOver* GameMessage::_internal_mutable_game_over() {
+  if (!_internal_has_game_over()) {
+    clear_content();
+    set_has_game_over();
+    _impl_.content_.game_over_ = CreateMaybeMessage< ::sanguosha::GameOver >(GetArenaForAllocation());
+  }
+  return _impl_.content_.game_over_;
 }
-#endif
-inline void LoginResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.LoginResponse.error_message)
+inline ::sanguosha::GameOver* GameMessage::mutable_game_over() {
+  ::sanguosha::GameOver* _msg = _internal_mutable_game_over();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_over)
+  return _msg;
 }
-inline void LoginResponse::set_error_message(const char* value, size_t size) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.LoginResponse.error_message)
+
+// .sanguosha.ResponsePrompt response_prompt = 11;
+inline bool GameMessage::_internal_has_response_prompt() const {
+  return content_case() == kResponsePrompt;
 }
-inline ::std::string* LoginResponse::mutable_error_message() {
-  
-  // @@protoc_insertion_point(field_mutable:sanguosha.LoginResponse.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline bool GameMessage::has_response_prompt() const {
+  return _internal_has_response_prompt();
 }
-inline ::std::string* LoginResponse::release_error_message() {
-  // @@protoc_insertion_point(field_release:sanguosha.LoginResponse.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GameMessage::set_has_response_prompt() {
+  _impl_._oneof_case_[0] = kResponsePrompt;
 }
-inline void LoginResponse::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
-    
+inline void GameMessage::clear_response_prompt() {
+  if (_internal_has_response_prompt()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.response_prompt_;
+    }
+    clear_has_content();
+  }
+}
+inline ::sanguosha::ResponsePrompt* GameMessage::release_response_prompt() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.response_prompt)
+  if (_internal_has_response_prompt()) {
+    clear_has_content();
+    ::sanguosha::ResponsePrompt* temp = _impl_.content_.response_prompt_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.response_prompt_ = nullptr;
+    return temp;
   } else {
-    
+    return nullptr;
   }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.LoginResponse.error_message)
 }
-
-// uint32 user_id = 3;
-inline void LoginResponse::clear_user_id() {
-  user_id_ = 0u;
+inline const ::sanguosha::ResponsePrompt& GameMessage::_internal_response_prompt() const {
+  return _internal_has_response_prompt()
+      ? *_impl_.content_.response_prompt_
+      : reinterpret_cast< ::sanguosha::ResponsePrompt&>(::sanguosha::_ResponsePrompt_default_instance_);
 }
-inline ::google::protobuf::uint32 LoginResponse::user_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.LoginResponse.user_id)
-  return user_id_;
+inline const ::sanguosha::ResponsePrompt& GameMessage::response_prompt() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.response_prompt)
+  return _internal_response_prompt();
 }
-inline void LoginResponse::set_user_id(::google::protobuf::uint32 value) {
-  
-  user_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.LoginResponse.user_id)
+inline ::sanguosha::ResponsePrompt* GameMessage::unsafe_arena_release_response_prompt() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.response_prompt)
+  if (_internal_has_response_prompt()) {
+    clear_has_content();
+    ::sanguosha::ResponsePrompt* temp = _impl_.content_.response_prompt_;
+    _impl_.content_.response_prompt_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// -------------------------------------------------------------------
-
-// Heartbeat
-
-// uint64 timestamp = 1;
-inline void Heartbeat::clear_timestamp() {
-  timestamp_ = GOOGLE_ULONGLONG(0);
+inline void GameMessage::unsafe_arena_set_allocated_response_prompt(::sanguosha::ResponsePrompt* response_prompt) {
+  clear_content();
+  if (response_prompt) {
+    set_has_response_prompt();
+    _impl_.content_.response_prompt_ = response_prompt;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.response_prompt)
 }
-inline ::google::protobuf::uint64 Heartbeat::timestamp() const {
-  // @@protoc_insertion_point(field_get:sanguosha.Heartbeat.timestamp)
-  return timestamp_;
+inline ::sanguosha::ResponsePrompt* GameMessage::_internal_mutable_response_prompt() {
+  if (!_internal_has_response_prompt()) {
+    clear_content();
+    set_has_response_prompt();
+    _impl_.content_.response_prompt_ = CreateMaybeMessage< ::sanguosha::ResponsePrompt >(GetArenaForAllocation());
+  }
+  return _impl_.content_.response_prompt_;
 }
-inline void Heartbeat::set_timestamp(::google::protobuf::uint64 value) {
-  
-  timestamp_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.Heartbeat.timestamp)
+inline ::sanguosha::ResponsePrompt* GameMessage::mutable_response_prompt() {
+  ::sanguosha::ResponsePrompt* _msg = _internal_mutable_response_prompt();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.response_prompt)
+  return _msg;
 }
 
-// -------------------------------------------------------------------
-
-// RoomInfo
-
-// uint32 room_id = 1;
-inline void RoomInfo::clear_room_id() {
-  room_id_ = 0u;
+// .sanguosha.RoomListResponse room_list_response = 14;
+inline bool GameMessage::_internal_has_room_list_response() const {
+  return content_case() == kRoomListResponse;
 }
-inline ::google::protobuf::uint32 RoomInfo::room_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.room_id)
-  return room_id_;
+inline bool GameMessage::has_room_list_response() const {
+  return _internal_has_room_list_response();
 }
-inline void RoomInfo::set_room_id(::google::protobuf::uint32 value) {
-  
-  room_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.room_id)
+inline void GameMessage::set_has_room_list_response() {
+  _impl_._oneof_case_[0] = kRoomListResponse;
 }
-
-// repeated uint32 players = 2;
-inline int RoomInfo::players_size() const {
-  return players_.size();
+inline void GameMessage::clear_room_list_response() {
+  if (_internal_has_room_list_response()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.room_list_response_;
+    }
+    clear_has_content();
+  }
 }
-inline void RoomInfo::clear_players() {
-  players_.Clear();
+inline ::sanguosha::RoomListResponse* GameMessage::release_room_list_response() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_list_response)
+  if (_internal_has_room_list_response()) {
+    clear_has_content();
+    ::sanguosha::RoomListResponse* temp = _impl_.content_.room_list_response_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.room_list_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline ::google::protobuf::uint32 RoomInfo::players(int index) const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.players)
-  return players_.Get(index);
+inline const ::sanguosha::RoomListResponse& GameMessage::_internal_room_list_response() const {
+  return _internal_has_room_list_response()
+      ? *_impl_.content_.room_list_response_
+      : reinterpret_cast< ::sanguosha::RoomListResponse&>(::sanguosha::_RoomListResponse_default_instance_);
 }
-inline void RoomInfo::set_players(int index, ::google::protobuf::uint32 value) {
-  players_.Set(index, value);
-  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.players)
+inline const ::sanguosha::RoomListResponse& GameMessage::room_list_response() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_list_response)
+  return _internal_room_list_response();
 }
-inline void RoomInfo::add_players(::google::protobuf::uint32 value) {
-  players_.Add(value);
-  // @@protoc_insertion_point(field_add:sanguosha.RoomInfo.players)
+inline ::sanguosha::RoomListResponse* GameMessage::unsafe_arena_release_room_list_response() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.room_list_response)
+  if (_internal_has_room_list_response()) {
+    clear_has_content();
+    ::sanguosha::RoomListResponse* temp = _impl_.content_.room_list_response_;
+    _impl_.content_.room_list_response_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-RoomInfo::players() const {
-  // @@protoc_insertion_point(field_list:sanguosha.RoomInfo.players)
-  return players_;
+inline void GameMessage::unsafe_arena_set_allocated_room_list_response(::sanguosha::RoomListResponse* room_list_response) {
+  clear_content();
+  if (room_list_response) {
+    set_has_room_list_response();
+    _impl_.content_.room_list_response_ = room_list_response;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.room_list_response)
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-RoomInfo::mutable_players() {
-  // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomInfo.players)
-  return &players_;
+inline ::sanguosha::RoomListResponse* GameMessage::_internal_mutable_room_list_response() {
+  if (!_internal_has_room_list_response()) {
+    clear_content();
+    set_has_room_list_response();
+    _impl_.content_.room_list_response_ = CreateMaybeMessage< ::sanguosha::RoomListResponse >(GetArenaForAllocation());
+  }
+  return _impl_.content_.room_list_response_;
 }
-
-// uint32 current_players = 3;
-inline void RoomInfo::clear_current_players() {
-  current_players_ = 0u;
+inline ::sanguosha::RoomListResponse* GameMessage::mutable_room_list_response() {
+  ::sanguosha::RoomListResponse* _msg = _internal_mutable_room_list_response();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_list_response)
+  return _msg;
 }
-inline ::google::protobuf::uint32 RoomInfo::current_players() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.current_players)
-  return current_players_;
+
+// .sanguosha.GameMessageBatch batch = 13;
+inline bool GameMessage::_internal_has_batch() const {
+  return content_case() == kBatch;
 }
-inline void RoomInfo::set_current_players(::google::protobuf::uint32 value) {
-  
-  current_players_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.current_players)
+inline bool GameMessage::has_batch() const {
+  return _internal_has_batch();
 }
-
-// uint32 max_players = 4;
-inline void RoomInfo::clear_max_players() {
-  max_players_ = 0u;
+inline void GameMessage::set_has_batch() {
+  _impl_._oneof_case_[0] = kBatch;
 }
-inline ::google::protobuf::uint32 RoomInfo::max_players() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.max_players)
-  return max_players_;
+inline void GameMessage::clear_batch() {
+  if (_internal_has_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.batch_;
+    }
+    clear_has_content();
+  }
 }
-inline void RoomInfo::set_max_players(::google::protobuf::uint32 value) {
-  
-  max_players_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.max_players)
+inline ::sanguosha::GameMessageBatch* GameMessage::release_batch() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.batch)
+  if (_internal_has_batch()) {
+    clear_has_content();
+    ::sanguosha::GameMessageBatch* temp = _impl_.content_.batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// .sanguosha.RoomStatus status = 5;
-inline void RoomInfo::clear_status() {
-  status_ = 0;
+inline const ::sanguosha::GameMessageBatch& GameMessage::_internal_batch() const {
+  return _internal_has_batch()
+      ? *_impl_.content_.batch_
+      : reinterpret_cast< ::sanguosha::GameMessageBatch&>(::sanguosha::_GameMessageBatch_default_instance_);
 }
-inline ::sanguosha::RoomStatus RoomInfo::status() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomInfo.status)
-  return static_cast< ::sanguosha::RoomStatus >(status_);
+inline const ::sanguosha::GameMessageBatch& GameMessage::batch() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.batch)
+  return _internal_batch();
 }
-inline void RoomInfo::set_status(::sanguosha::RoomStatus value) {
-  
-  status_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomInfo.status)
+inline ::sanguosha::GameMessageBatch* GameMessage::unsafe_arena_release_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.batch)
+  if (_internal_has_batch()) {
+    clear_has_content();
+    ::sanguosha::GameMessageBatch* temp = _impl_.content_.batch_;
+    _impl_.content_.batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// -------------------------------------------------------------------
-
-// RoomRequest
-
-// .sanguosha.RoomAction action = 1;
-inline void RoomRequest::clear_action() {
-  action_ = 0;
+inline void GameMessage::unsafe_arena_set_allocated_batch(::sanguosha::GameMessageBatch* batch) {
+  clear_content();
+  if (batch) {
+    set_has_batch();
+    _impl_.content_.batch_ = batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.batch)
 }
-inline ::sanguosha::RoomAction RoomRequest::action() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.action)
-  return static_cast< ::sanguosha::RoomAction >(action_);
+inline ::sanguosha::GameMessageBatch* GameMessage::_internal_mutable_batch() {
+  if (!_internal_has_batch()) {
+    clear_content();
+    set_has_batch();
+    _impl_.content_.batch_ = CreateMaybeMessage< ::sanguosha::GameMessageBatch >(GetArenaForAllocation());
+  }
+  return _impl_.content_.batch_;
 }
-inline void RoomRequest::set_action(::sanguosha::RoomAction value) {
-  
-  action_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.action)
+inline ::sanguosha::GameMessageBatch* GameMessage::mutable_batch() {
+  ::sanguosha::GameMessageBatch* _msg = _internal_mutable_batch();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.batch)
+  return _msg;
 }
 
-// uint32 room_id = 2;
-inline void RoomRequest::clear_room_id() {
-  room_id_ = 0u;
-}
-inline ::google::protobuf::uint32 RoomRequest::room_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomRequest.room_id)
-  return room_id_;
+// .sanguosha.ActionResult action_result = 15;
+inline bool GameMessage::_internal_has_action_result() const {
+  return content_case() == kActionResult;
 }
-inline void RoomRequest::set_room_id(::google::protobuf::uint32 value) {
-  
-  room_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomRequest.room_id)
+inline bool GameMessage::has_action_result() const {
+  return _internal_has_action_result();
 }
-
-// -------------------------------------------------------------------
-
-// RoomResponse
-
-// bool success = 1;
-inline void RoomResponse::clear_success() {
-  success_ = false;
+inline void GameMessage::set_has_action_result() {
+  _impl_._oneof_case_[0] = kActionResult;
 }
-inline bool RoomResponse::success() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.success)
-  return success_;
+inline void GameMessage::clear_action_result() {
+  if (_internal_has_action_result()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.content_.action_result_;
+    }
+    clear_has_content();
+  }
 }
-inline void RoomResponse::set_success(bool value) {
-  
-  success_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.RoomResponse.success)
+inline ::sanguosha::ActionResult* GameMessage::release_action_result() {
+  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.action_result)
+  if (_internal_has_action_result()) {
+    clear_has_content();
+    ::sanguosha::ActionResult* temp = _impl_.content_.action_result_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.content_.action_result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-
-// string error_message = 2;
-inline void RoomResponse::clear_error_message() {
-  error_message_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::sanguosha::ActionResult& GameMessage::_internal_action_result() const {
+  return _internal_has_action_result()
+      ? *_impl_.content_.action_result_
+      : reinterpret_cast< ::sanguosha::ActionResult&>(::sanguosha::_ActionResult_default_instance_);
 }
-inline const ::std::string& RoomResponse::error_message() const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.error_message)
-  return error_message_.GetNoArena();
+inline const ::sanguosha::ActionResult& GameMessage::action_result() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.action_result)
+  return _internal_action_result();
 }
-inline void RoomResponse::set_error_message(const ::std::string& value) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:sanguosha.RoomResponse.error_message)
+inline ::sanguosha::ActionResult* GameMessage::unsafe_arena_release_action_result() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:sanguosha.GameMessage.action_result)
+  if (_internal_has_action_result()) {
+    clear_has_content();
+    ::sanguosha::ActionResult* temp = _impl_.content_.action_result_;
+    _impl_.content_.action_result_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
 }
-#if LANG_CXX11
-inline void RoomResponse::set_error_message(::std::string&& value) {
-  
-  error_message_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.RoomResponse.error_message)
+inline void GameMessage::unsafe_arena_set_allocated_action_result(::sanguosha::ActionResult* action_result) {
+  clear_content();
+  if (action_result) {
+    set_has_action_result();
+    _impl_.content_.action_result_ = action_result;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.GameMessage.action_result)
 }
-#endif
-inline void RoomResponse::set_error_message(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.RoomResponse.error_message)
+inline ::sanguosha::ActionResult* GameMessage::_internal_mutable_action_result() {
+  if (!_internal_has_action_result()) {
+    clear_content();
+    set_has_action_result();
+    _impl_.content_.action_result_ = CreateMaybeMessage< ::sanguosha::ActionResult >(GetArenaForAllocation());
+  }
+  return _impl_.content_.action_result_;
 }
-inline void RoomResponse::set_error_message(const char* value, size_t size) {
-  
-  error_message_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.RoomResponse.error_message)
+inline ::sanguosha::ActionResult* GameMessage::mutable_action_result() {
+  ::sanguosha::ActionResult* _msg = _internal_mutable_action_result();
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.action_result)
+  return _msg;
 }
-inline ::std::string* RoomResponse::mutable_error_message() {
-  
-  // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.error_message)
-  return error_message_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+
+inline bool GameMessage::has_content() const {
+  return content_case() != CONTENT_NOT_SET;
 }
-inline ::std::string* RoomResponse::release_error_message() {
-  // @@protoc_insertion_point(field_release:sanguosha.RoomResponse.error_message)
-  
-  return error_message_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline void GameMessage::clear_has_content() {
+  _impl_._oneof_case_[0] = CONTENT_NOT_SET;
 }
-inline void RoomResponse::set_allocated_error_message(::std::string* error_message) {
-  if (error_message != NULL) {
-    
-  } else {
-    
-  }
-  error_message_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), error_message);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomResponse.error_message)
+inline GameMessage::ContentCase GameMessage::content_case() const {
+  return GameMessage::ContentCase(_impl_._oneof_case_[0]);
 }
+// -------------------------------------------------------------------
 
-// .sanguosha.RoomInfo room_info = 3;
-inline bool RoomResponse::has_room_info() const {
-  return this != internal_default_instance() && room_info_ != NULL;
+// GameMessageBatch
+
+// repeated .sanguosha.GameMessage messages = 1;
+inline int GameMessageBatch::_internal_messages_size() const {
+  return _impl_.messages_.size();
 }
-inline void RoomResponse::clear_room_info() {
-  if (GetArenaNoVirtual() == NULL && room_info_ != NULL) {
-    delete room_info_;
-  }
-  room_info_ = NULL;
+inline int GameMessageBatch::messages_size() const {
+  return _internal_messages_size();
 }
-inline const ::sanguosha::RoomInfo& RoomResponse::_internal_room_info() const {
-  return *room_info_;
+inline void GameMessageBatch::clear_messages() {
+  _impl_.messages_.Clear();
 }
-inline const ::sanguosha::RoomInfo& RoomResponse::room_info() const {
-  const ::sanguosha::RoomInfo* p = room_info_;
-  // @@protoc_insertion_point(field_get:sanguosha.RoomResponse.room_info)
-  return p != NULL ? *p : *reinterpret_cast<const ::sanguosha::RoomInfo*>(
-      &::sanguosha::_RoomInfo_default_instance_);
+inline ::sanguosha::GameMessage* GameMessageBatch::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessageBatch.messages)
+  return _impl_.messages_.Mutable(index);
 }
-inline ::sanguosha::RoomInfo* RoomResponse::release_room_info() {
-  // @@protoc_insertion_point(field_release:sanguosha.RoomResponse.room_info)
-  
-  ::sanguosha::RoomInfo* temp = room_info_;
-  room_info_ = NULL;
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >*
+GameMessageBatch::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameMessageBatch.messages)
+  return &_impl_.messages_;
 }
-inline ::sanguosha::RoomInfo* RoomResponse::mutable_room_info() {
-  
-  if (room_info_ == NULL) {
-    auto* p = CreateMaybeMessage<::sanguosha::RoomInfo>(GetArenaNoVirtual());
-    room_info_ = p;
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.RoomResponse.room_info)
-  return room_info_;
+inline const ::sanguosha::GameMessage& GameMessageBatch::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
 }
-inline void RoomResponse::set_allocated_room_info(::sanguosha::RoomInfo* room_info) {
-  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
-  if (message_arena == NULL) {
-    delete room_info_;
-  }
-  if (room_info) {
-    ::google::protobuf::Arena* submessage_arena = NULL;
-    if (message_arena != submessage_arena) {
-      room_info = ::google::protobuf::internal::GetOwnedMessage(
-          message_arena, room_info, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  room_info_ = room_info;
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomResponse.room_info)
+inline const ::sanguosha::GameMessage& GameMessageBatch::messages(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameMessageBatch.messages)
+  return _internal_messages(index);
+}
+inline ::sanguosha::GameMessage* GameMessageBatch::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::sanguosha::GameMessage* GameMessageBatch::add_messages() {
+  ::sanguosha::GameMessage* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:sanguosha.GameMessageBatch.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::GameMessage >&
+GameMessageBatch::messages() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameMessageBatch.messages)
+  return _impl_.messages_;
 }
 
 // -------------------------------------------------------------------
 
-// RoomListResponse
+// ActionResult
 
-// repeated .sanguosha.RoomInfo rooms = 1;
-inline int RoomListResponse::rooms_size() const {
-  return rooms_.size();
-}
-inline void RoomListResponse::clear_rooms() {
-  rooms_.Clear();
-}
-inline ::sanguosha::RoomInfo* RoomListResponse::mutable_rooms(int index) {
-  // @@protoc_insertion_point(field_mutable:sanguosha.RoomListResponse.rooms)
-  return rooms_.Mutable(index);
+// bool success = 1;
+inline void ActionResult::clear_success() {
+  _impl_.success_ = false;
 }
-inline ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >*
-RoomListResponse::mutable_rooms() {
-  // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomListResponse.rooms)
-  return &rooms_;
+inline bool ActionResult::_internal_success() const {
+  return _impl_.success_;
 }
-inline const ::sanguosha::RoomInfo& RoomListResponse::rooms(int index) const {
-  // @@protoc_insertion_point(field_get:sanguosha.RoomListResponse.rooms)
-  return rooms_.Get(index);
+inline bool ActionResult::success() const {
+  // @@protoc_insertion_point(field_get:sanguosha.ActionResult.success)
+  return _internal_success();
 }
-inline ::sanguosha::RoomInfo* RoomListResponse::add_rooms() {
-  // @@protoc_insertion_point(field_add:sanguosha.RoomListResponse.rooms)
-  return rooms_.Add();
+inline void ActionResult::_internal_set_success(bool value) {
+  
+  _impl_.success_ = value;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::sanguosha::RoomInfo >&
-RoomListResponse::rooms() const {
-  // @@protoc_insertion_point(field_list:sanguosha.RoomListResponse.rooms)
-  return rooms_;
+inline void ActionResult::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:sanguosha.ActionResult.success)
 }
 
 // -------------------------------------------------------------------
 
-// GameAction
+// GameOver
 
-// .sanguosha.ActionType type = 1;
-inline void GameAction::clear_type() {
-  type_ = 0;
+// uint32 winner_id = 1;
+inline void GameOver::clear_winner_id() {
+  _impl_.winner_id_ = 0u;
 }
-inline ::sanguosha::ActionType GameAction::type() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameAction.type)
-  return static_cast< ::sanguosha::ActionType >(type_);
+inline uint32_t GameOver::_internal_winner_id() const {
+  return _impl_.winner_id_;
 }
-inline void GameAction::set_type(::sanguosha::ActionType value) {
+inline uint32_t GameOver::winner_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameOver.winner_id)
+  return _internal_winner_id();
+}
+inline void GameOver::_internal_set_winner_id(uint32_t value) {
   
-  type_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameAction.type)
+  _impl_.winner_id_ = value;
+}
+inline void GameOver::set_winner_id(uint32_t value) {
+  _internal_set_winner_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameOver.winner_id)
 }
 
-// uint32 card_id = 2;
-inline void GameAction::clear_card_id() {
-  card_id_ = 0u;
+// repeated uint32 winner_ids = 2;
+inline int GameOver::_internal_winner_ids_size() const {
+  return _impl_.winner_ids_.size();
 }
-inline ::google::protobuf::uint32 GameAction::card_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameAction.card_id)
-  return card_id_;
+inline int GameOver::winner_ids_size() const {
+  return _internal_winner_ids_size();
 }
-inline void GameAction::set_card_id(::google::protobuf::uint32 value) {
-  
-  card_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameAction.card_id)
+inline void GameOver::clear_winner_ids() {
+  _impl_.winner_ids_.Clear();
+}
+inline uint32_t GameOver::_internal_winner_ids(int index) const {
+  return _impl_.winner_ids_.Get(index);
+}
+inline uint32_t GameOver::winner_ids(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameOver.winner_ids)
+  return _internal_winner_ids(index);
+}
+inline void GameOver::set_winner_ids(int index, uint32_t value) {
+  _impl_.winner_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameOver.winner_ids)
+}
+inline void GameOver::_internal_add_winner_ids(uint32_t value) {
+  _impl_.winner_ids_.Add(value);
+}
+inline void GameOver::add_winner_ids(uint32_t value) {
+  _internal_add_winner_ids(value);
+  // @@protoc_insertion_point(field_add:sanguosha.GameOver.winner_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameOver::_internal_winner_ids() const {
+  return _impl_.winner_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameOver::winner_ids() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameOver.winner_ids)
+  return _internal_winner_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameOver::_internal_mutable_winner_ids() {
+  return &_impl_.winner_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameOver::mutable_winner_ids() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameOver.winner_ids)
+  return _internal_mutable_winner_ids();
 }
 
-// uint32 target_player = 3;
-inline void GameAction::clear_target_player() {
-  target_player_ = 0u;
+// .sanguosha.Role winner_role = 3;
+inline void GameOver::clear_winner_role() {
+  _impl_.winner_role_ = 0;
 }
-inline ::google::protobuf::uint32 GameAction::target_player() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameAction.target_player)
-  return target_player_;
+inline ::sanguosha::Role GameOver::_internal_winner_role() const {
+  return static_cast< ::sanguosha::Role >(_impl_.winner_role_);
+}
+inline ::sanguosha::Role GameOver::winner_role() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameOver.winner_role)
+  return _internal_winner_role();
 }
-inline void GameAction::set_target_player(::google::protobuf::uint32 value) {
+inline void GameOver::_internal_set_winner_role(::sanguosha::Role value) {
   
-  target_player_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameAction.target_player)
+  _impl_.winner_role_ = value;
+}
+inline void GameOver::set_winner_role(::sanguosha::Role value) {
+  _internal_set_winner_role(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameOver.winner_role)
 }
 
 // -------------------------------------------------------------------
 
-// PlayerState
+// GameSnapshot
 
-// uint32 player_id = 1;
-inline void PlayerState::clear_player_id() {
-  player_id_ = 0u;
+// repeated .sanguosha.PlayerState seats = 1;
+inline int GameSnapshot::_internal_seats_size() const {
+  return _impl_.seats_.size();
 }
-inline ::google::protobuf::uint32 PlayerState::player_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.player_id)
-  return player_id_;
+inline int GameSnapshot::seats_size() const {
+  return _internal_seats_size();
 }
-inline void PlayerState::set_player_id(::google::protobuf::uint32 value) {
-  
-  player_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.player_id)
+inline void GameSnapshot::clear_seats() {
+  _impl_.seats_.Clear();
 }
-
-// string username = 2;
-inline void PlayerState::clear_username() {
-  username_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline ::sanguosha::PlayerState* GameSnapshot::mutable_seats(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.GameSnapshot.seats)
+  return _impl_.seats_.Mutable(index);
 }
-inline const ::std::string& PlayerState::username() const {
-  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.username)
-  return username_.GetNoArena();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >*
+GameSnapshot::mutable_seats() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameSnapshot.seats)
+  return &_impl_.seats_;
 }
-inline void PlayerState::set_username(const ::std::string& value) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.username)
+inline const ::sanguosha::PlayerState& GameSnapshot::_internal_seats(int index) const {
+  return _impl_.seats_.Get(index);
 }
-#if LANG_CXX11
-inline void PlayerState::set_username(::std::string&& value) {
-  
-  username_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.PlayerState.username)
+inline const ::sanguosha::PlayerState& GameSnapshot::seats(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.seats)
+  return _internal_seats(index);
 }
-#endif
-inline void PlayerState::set_username(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.PlayerState.username)
+inline ::sanguosha::PlayerState* GameSnapshot::_internal_add_seats() {
+  return _impl_.seats_.Add();
 }
-inline void PlayerState::set_username(const char* value, size_t size) {
-  
-  username_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.PlayerState.username)
+inline ::sanguosha::PlayerState* GameSnapshot::add_seats() {
+  ::sanguosha::PlayerState* _add = _internal_add_seats();
+  // @@protoc_insertion_point(field_add:sanguosha.GameSnapshot.seats)
+  return _add;
 }
-inline ::std::string* PlayerState::mutable_username() {
-  
-  // @@protoc_insertion_point(field_mutable:sanguosha.PlayerState.username)
-  return username_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::PlayerState >&
+GameSnapshot::seats() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameSnapshot.seats)
+  return _impl_.seats_;
 }
-inline ::std::string* PlayerState::release_username() {
-  // @@protoc_insertion_point(field_release:sanguosha.PlayerState.username)
+
+// uint32 alive_mask = 2;
+inline void GameSnapshot::clear_alive_mask() {
+  _impl_.alive_mask_ = 0u;
+}
+inline uint32_t GameSnapshot::_internal_alive_mask() const {
+  return _impl_.alive_mask_;
+}
+inline uint32_t GameSnapshot::alive_mask() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.alive_mask)
+  return _internal_alive_mask();
+}
+inline void GameSnapshot::_internal_set_alive_mask(uint32_t value) {
   
-  return username_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.alive_mask_ = value;
 }
-inline void PlayerState::set_allocated_username(::std::string* username) {
-  if (username != NULL) {
-    
-  } else {
-    
-  }
-  username_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), username);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.PlayerState.username)
+inline void GameSnapshot::set_alive_mask(uint32_t value) {
+  _internal_set_alive_mask(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.alive_mask)
 }
 
-// uint32 hp = 3;
-inline void PlayerState::clear_hp() {
-  hp_ = 0u;
+// uint32 current_seat = 3;
+inline void GameSnapshot::clear_current_seat() {
+  _impl_.current_seat_ = 0u;
 }
-inline ::google::protobuf::uint32 PlayerState::hp() const {
-  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.hp)
-  return hp_;
+inline uint32_t GameSnapshot::_internal_current_seat() const {
+  return _impl_.current_seat_;
+}
+inline uint32_t GameSnapshot::current_seat() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.current_seat)
+  return _internal_current_seat();
 }
-inline void PlayerState::set_hp(::google::protobuf::uint32 value) {
+inline void GameSnapshot::_internal_set_current_seat(uint32_t value) {
   
-  hp_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.hp)
+  _impl_.current_seat_ = value;
+}
+inline void GameSnapshot::set_current_seat(uint32_t value) {
+  _internal_set_current_seat(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.current_seat)
 }
 
-// uint32 max_hp = 4;
-inline void PlayerState::clear_max_hp() {
-  max_hp_ = 0u;
+// repeated uint32 deck = 4;
+inline int GameSnapshot::_internal_deck_size() const {
+  return _impl_.deck_.size();
 }
-inline ::google::protobuf::uint32 PlayerState::max_hp() const {
-  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.max_hp)
-  return max_hp_;
+inline int GameSnapshot::deck_size() const {
+  return _internal_deck_size();
 }
-inline void PlayerState::set_max_hp(::google::protobuf::uint32 value) {
-  
-  max_hp_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.max_hp)
+inline void GameSnapshot::clear_deck() {
+  _impl_.deck_.Clear();
+}
+inline uint32_t GameSnapshot::_internal_deck(int index) const {
+  return _impl_.deck_.Get(index);
+}
+inline uint32_t GameSnapshot::deck(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.deck)
+  return _internal_deck(index);
+}
+inline void GameSnapshot::set_deck(int index, uint32_t value) {
+  _impl_.deck_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.deck)
+}
+inline void GameSnapshot::_internal_add_deck(uint32_t value) {
+  _impl_.deck_.Add(value);
+}
+inline void GameSnapshot::add_deck(uint32_t value) {
+  _internal_add_deck(value);
+  // @@protoc_insertion_point(field_add:sanguosha.GameSnapshot.deck)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameSnapshot::_internal_deck() const {
+  return _impl_.deck_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameSnapshot::deck() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameSnapshot.deck)
+  return _internal_deck();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameSnapshot::_internal_mutable_deck() {
+  return &_impl_.deck_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameSnapshot::mutable_deck() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameSnapshot.deck)
+  return _internal_mutable_deck();
 }
 
-// repeated uint32 hand_cards = 5;
-inline int PlayerState::hand_cards_size() const {
-  return hand_cards_.size();
+// repeated uint32 discard_pile = 5;
+inline int GameSnapshot::_internal_discard_pile_size() const {
+  return _impl_.discard_pile_.size();
 }
-inline void PlayerState::clear_hand_cards() {
-  hand_cards_.Clear();
+inline int GameSnapshot::discard_pile_size() const {
+  return _internal_discard_pile_size();
 }
-inline ::google::protobuf::uint32 PlayerState::hand_cards(int index) const {
-  // @@protoc_insertion_point(field_get:sanguosha.PlayerState.hand_cards)
-  return hand_cards_.Get(index);
+inline void GameSnapshot::clear_discard_pile() {
+  _impl_.discard_pile_.Clear();
 }
-inline void PlayerState::set_hand_cards(int index, ::google::protobuf::uint32 value) {
-  hand_cards_.Set(index, value);
-  // @@protoc_insertion_point(field_set:sanguosha.PlayerState.hand_cards)
+inline uint32_t GameSnapshot::_internal_discard_pile(int index) const {
+  return _impl_.discard_pile_.Get(index);
 }
-inline void PlayerState::add_hand_cards(::google::protobuf::uint32 value) {
-  hand_cards_.Add(value);
-  // @@protoc_insertion_point(field_add:sanguosha.PlayerState.hand_cards)
+inline uint32_t GameSnapshot::discard_pile(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.discard_pile)
+  return _internal_discard_pile(index);
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-PlayerState::hand_cards() const {
-  // @@protoc_insertion_point(field_list:sanguosha.PlayerState.hand_cards)
-  return hand_cards_;
+inline void GameSnapshot::set_discard_pile(int index, uint32_t value) {
+  _impl_.discard_pile_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.discard_pile)
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-PlayerState::mutable_hand_cards() {
-  // @@protoc_insertion_point(field_mutable_list:sanguosha.PlayerState.hand_cards)
-  return &hand_cards_;
+inline void GameSnapshot::_internal_add_discard_pile(uint32_t value) {
+  _impl_.discard_pile_.Add(value);
+}
+inline void GameSnapshot::add_discard_pile(uint32_t value) {
+  _internal_add_discard_pile(value);
+  // @@protoc_insertion_point(field_add:sanguosha.GameSnapshot.discard_pile)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameSnapshot::_internal_discard_pile() const {
+  return _impl_.discard_pile_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameSnapshot::discard_pile() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameSnapshot.discard_pile)
+  return _internal_discard_pile();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameSnapshot::_internal_mutable_discard_pile() {
+  return &_impl_.discard_pile_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameSnapshot::mutable_discard_pile() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameSnapshot.discard_pile)
+  return _internal_mutable_discard_pile();
 }
 
-// -------------------------------------------------------------------
+// uint32 rng_seed = 6;
+inline void GameSnapshot::clear_rng_seed() {
+  _impl_.rng_seed_ = 0u;
+}
+inline uint32_t GameSnapshot::_internal_rng_seed() const {
+  return _impl_.rng_seed_;
+}
+inline uint32_t GameSnapshot::rng_seed() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.rng_seed)
+  return _internal_rng_seed();
+}
+inline void GameSnapshot::_internal_set_rng_seed(uint32_t value) {
+  
+  _impl_.rng_seed_ = value;
+}
+inline void GameSnapshot::set_rng_seed(uint32_t value) {
+  _internal_set_rng_seed(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.rng_seed)
+}
 
-// GameState
+// uint64 rng_draws = 14;
+inline void GameSnapshot::clear_rng_draws() {
+  _impl_.rng_draws_ = uint64_t{0u};
+}
+inline uint64_t GameSnapshot::_internal_rng_draws() const {
+  return _impl_.rng_draws_;
+}
+inline uint64_t GameSnapshot::rng_draws() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.rng_draws)
+  return _internal_rng_draws();
+}
+inline void GameSnapshot::_internal_set_rng_draws(uint64_t value) {
+  
+  _impl_.rng_draws_ = value;
+}
+inline void GameSnapshot::set_rng_draws(uint64_t value) {
+  _internal_set_rng_draws(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.rng_draws)
+}
 
-// uint32 current_player = 1;
-inline void GameState::clear_current_player() {
-  current_player_ = 0u;
+// uint64 turn_seq = 7;
+inline void GameSnapshot::clear_turn_seq() {
+  _impl_.turn_seq_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint32 GameState::current_player() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameState.current_player)
-  return current_player_;
+inline uint64_t GameSnapshot::_internal_turn_seq() const {
+  return _impl_.turn_seq_;
 }
-inline void GameState::set_current_player(::google::protobuf::uint32 value) {
+inline uint64_t GameSnapshot::turn_seq() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.turn_seq)
+  return _internal_turn_seq();
+}
+inline void GameSnapshot::_internal_set_turn_seq(uint64_t value) {
   
-  current_player_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameState.current_player)
+  _impl_.turn_seq_ = value;
+}
+inline void GameSnapshot::set_turn_seq(uint64_t value) {
+  _internal_set_turn_seq(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.turn_seq)
 }
 
-// repeated .sanguosha.PlayerState players = 2;
-inline int GameState::players_size() const {
-  return players_.size();
+// repeated uint32 consecutive_timeouts = 8;
+inline int GameSnapshot::_internal_consecutive_timeouts_size() const {
+  return _impl_.consecutive_timeouts_.size();
 }
-inline void GameState::clear_players() {
-  players_.Clear();
+inline int GameSnapshot::consecutive_timeouts_size() const {
+  return _internal_consecutive_timeouts_size();
 }
-inline ::sanguosha::PlayerState* GameState::mutable_players(int index) {
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameState.players)
-  return players_.Mutable(index);
+inline void GameSnapshot::clear_consecutive_timeouts() {
+  _impl_.consecutive_timeouts_.Clear();
 }
-inline ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >*
-GameState::mutable_players() {
-  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameState.players)
-  return &players_;
+inline uint32_t GameSnapshot::_internal_consecutive_timeouts(int index) const {
+  return _impl_.consecutive_timeouts_.Get(index);
 }
-inline const ::sanguosha::PlayerState& GameState::players(int index) const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameState.players)
-  return players_.Get(index);
+inline uint32_t GameSnapshot::consecutive_timeouts(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.consecutive_timeouts)
+  return _internal_consecutive_timeouts(index);
 }
-inline ::sanguosha::PlayerState* GameState::add_players() {
-  // @@protoc_insertion_point(field_add:sanguosha.GameState.players)
-  return players_.Add();
+inline void GameSnapshot::set_consecutive_timeouts(int index, uint32_t value) {
+  _impl_.consecutive_timeouts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.consecutive_timeouts)
 }
-inline const ::google::protobuf::RepeatedPtrField< ::sanguosha::PlayerState >&
-GameState::players() const {
-  // @@protoc_insertion_point(field_list:sanguosha.GameState.players)
-  return players_;
+inline void GameSnapshot::_internal_add_consecutive_timeouts(uint32_t value) {
+  _impl_.consecutive_timeouts_.Add(value);
+}
+inline void GameSnapshot::add_consecutive_timeouts(uint32_t value) {
+  _internal_add_consecutive_timeouts(value);
+  // @@protoc_insertion_point(field_add:sanguosha.GameSnapshot.consecutive_timeouts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameSnapshot::_internal_consecutive_timeouts() const {
+  return _impl_.consecutive_timeouts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+GameSnapshot::consecutive_timeouts() const {
+  // @@protoc_insertion_point(field_list:sanguosha.GameSnapshot.consecutive_timeouts)
+  return _internal_consecutive_timeouts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameSnapshot::_internal_mutable_consecutive_timeouts() {
+  return &_impl_.consecutive_timeouts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+GameSnapshot::mutable_consecutive_timeouts() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameSnapshot.consecutive_timeouts)
+  return _internal_mutable_consecutive_timeouts();
 }
 
-// .sanguosha.GamePhase phase = 3;
-inline void GameState::clear_phase() {
-  phase_ = 0;
+// uint32 next_prompt_id = 9;
+inline void GameSnapshot::clear_next_prompt_id() {
+  _impl_.next_prompt_id_ = 0u;
 }
-inline ::sanguosha::GamePhase GameState::phase() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameState.phase)
-  return static_cast< ::sanguosha::GamePhase >(phase_);
+inline uint32_t GameSnapshot::_internal_next_prompt_id() const {
+  return _impl_.next_prompt_id_;
 }
-inline void GameState::set_phase(::sanguosha::GamePhase value) {
+inline uint32_t GameSnapshot::next_prompt_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.next_prompt_id)
+  return _internal_next_prompt_id();
+}
+inline void GameSnapshot::_internal_set_next_prompt_id(uint32_t value) {
   
-  phase_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameState.phase)
+  _impl_.next_prompt_id_ = value;
+}
+inline void GameSnapshot::set_next_prompt_id(uint32_t value) {
+  _internal_set_next_prompt_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.next_prompt_id)
 }
 
-// string game_log = 4;
-inline void GameState::clear_game_log() {
-  game_log_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+// uint32 pending_prompt_id = 10;
+inline void GameSnapshot::clear_pending_prompt_id() {
+  _impl_.pending_prompt_id_ = 0u;
 }
-inline const ::std::string& GameState::game_log() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameState.game_log)
-  return game_log_.GetNoArena();
+inline uint32_t GameSnapshot::_internal_pending_prompt_id() const {
+  return _impl_.pending_prompt_id_;
 }
-inline void GameState::set_game_log(const ::std::string& value) {
-  
-  game_log_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
-  // @@protoc_insertion_point(field_set:sanguosha.GameState.game_log)
+inline uint32_t GameSnapshot::pending_prompt_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.pending_prompt_id)
+  return _internal_pending_prompt_id();
 }
-#if LANG_CXX11
-inline void GameState::set_game_log(::std::string&& value) {
+inline void GameSnapshot::_internal_set_pending_prompt_id(uint32_t value) {
   
-  game_log_.SetNoArena(
-    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
-  // @@protoc_insertion_point(field_set_rvalue:sanguosha.GameState.game_log)
+  _impl_.pending_prompt_id_ = value;
 }
-#endif
-inline void GameState::set_game_log(const char* value) {
-  GOOGLE_DCHECK(value != NULL);
-  
-  game_log_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
-  // @@protoc_insertion_point(field_set_char:sanguosha.GameState.game_log)
+inline void GameSnapshot::set_pending_prompt_id(uint32_t value) {
+  _internal_set_pending_prompt_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.pending_prompt_id)
 }
-inline void GameState::set_game_log(const char* value, size_t size) {
+
+// uint32 pending_source_seat = 11;
+inline void GameSnapshot::clear_pending_source_seat() {
+  _impl_.pending_source_seat_ = 0u;
+}
+inline uint32_t GameSnapshot::_internal_pending_source_seat() const {
+  return _impl_.pending_source_seat_;
+}
+inline uint32_t GameSnapshot::pending_source_seat() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.pending_source_seat)
+  return _internal_pending_source_seat();
+}
+inline void GameSnapshot::_internal_set_pending_source_seat(uint32_t value) {
   
-  game_log_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
-      ::std::string(reinterpret_cast<const char*>(value), size));
-  // @@protoc_insertion_point(field_set_pointer:sanguosha.GameState.game_log)
+  _impl_.pending_source_seat_ = value;
+}
+inline void GameSnapshot::set_pending_source_seat(uint32_t value) {
+  _internal_set_pending_source_seat(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.pending_source_seat)
+}
+
+// uint32 pending_target_seat = 12;
+inline void GameSnapshot::clear_pending_target_seat() {
+  _impl_.pending_target_seat_ = 0u;
+}
+inline uint32_t GameSnapshot::_internal_pending_target_seat() const {
+  return _impl_.pending_target_seat_;
 }
-inline ::std::string* GameState::mutable_game_log() {
+inline uint32_t GameSnapshot::pending_target_seat() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.pending_target_seat)
+  return _internal_pending_target_seat();
+}
+inline void GameSnapshot::_internal_set_pending_target_seat(uint32_t value) {
   
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameState.game_log)
-  return game_log_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pending_target_seat_ = value;
 }
-inline ::std::string* GameState::release_game_log() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameState.game_log)
+inline void GameSnapshot::set_pending_target_seat(uint32_t value) {
+  _internal_set_pending_target_seat(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.pending_target_seat)
+}
+
+// .sanguosha.CardType pending_card_type = 13;
+inline void GameSnapshot::clear_pending_card_type() {
+  _impl_.pending_card_type_ = 0;
+}
+inline ::sanguosha::CardType GameSnapshot::_internal_pending_card_type() const {
+  return static_cast< ::sanguosha::CardType >(_impl_.pending_card_type_);
+}
+inline ::sanguosha::CardType GameSnapshot::pending_card_type() const {
+  // @@protoc_insertion_point(field_get:sanguosha.GameSnapshot.pending_card_type)
+  return _internal_pending_card_type();
+}
+inline void GameSnapshot::_internal_set_pending_card_type(::sanguosha::CardType value) {
   
-  return game_log_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  _impl_.pending_card_type_ = value;
 }
-inline void GameState::set_allocated_game_log(::std::string* game_log) {
-  if (game_log != NULL) {
-    
-  } else {
-    
-  }
-  game_log_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), game_log);
-  // @@protoc_insertion_point(field_set_allocated:sanguosha.GameState.game_log)
+inline void GameSnapshot::set_pending_card_type(::sanguosha::CardType value) {
+  _internal_set_pending_card_type(value);
+  // @@protoc_insertion_point(field_set:sanguosha.GameSnapshot.pending_card_type)
 }
 
 // -------------------------------------------------------------------
 
-// GameStart
+// RoomSnapshot
 
 // uint32 room_id = 1;
-inline void GameStart::clear_room_id() {
-  room_id_ = 0u;
+inline void RoomSnapshot::clear_room_id() {
+  _impl_.room_id_ = 0u;
 }
-inline ::google::protobuf::uint32 GameStart::room_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameStart.room_id)
-  return room_id_;
+inline uint32_t RoomSnapshot::_internal_room_id() const {
+  return _impl_.room_id_;
 }
-inline void GameStart::set_room_id(::google::protobuf::uint32 value) {
+inline uint32_t RoomSnapshot::room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomSnapshot.room_id)
+  return _internal_room_id();
+}
+inline void RoomSnapshot::_internal_set_room_id(uint32_t value) {
   
-  room_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameStart.room_id)
+  _impl_.room_id_ = value;
+}
+inline void RoomSnapshot::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomSnapshot.room_id)
 }
 
-// repeated uint32 player_ids = 2;
-inline int GameStart::player_ids_size() const {
-  return player_ids_.size();
+// uint32 capacity = 2;
+inline void RoomSnapshot::clear_capacity() {
+  _impl_.capacity_ = 0u;
 }
-inline void GameStart::clear_player_ids() {
-  player_ids_.Clear();
+inline uint32_t RoomSnapshot::_internal_capacity() const {
+  return _impl_.capacity_;
 }
-inline ::google::protobuf::uint32 GameStart::player_ids(int index) const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameStart.player_ids)
-  return player_ids_.Get(index);
+inline uint32_t RoomSnapshot::capacity() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomSnapshot.capacity)
+  return _internal_capacity();
 }
-inline void GameStart::set_player_ids(int index, ::google::protobuf::uint32 value) {
-  player_ids_.Set(index, value);
-  // @@protoc_insertion_point(field_set:sanguosha.GameStart.player_ids)
+inline void RoomSnapshot::_internal_set_capacity(uint32_t value) {
+  
+  _impl_.capacity_ = value;
 }
-inline void GameStart::add_player_ids(::google::protobuf::uint32 value) {
-  player_ids_.Add(value);
-  // @@protoc_insertion_point(field_add:sanguosha.GameStart.player_ids)
+inline void RoomSnapshot::set_capacity(uint32_t value) {
+  _internal_set_capacity(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomSnapshot.capacity)
 }
-inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
-GameStart::player_ids() const {
-  // @@protoc_insertion_point(field_list:sanguosha.GameStart.player_ids)
-  return player_ids_;
+
+// repeated uint32 players = 3;
+inline int RoomSnapshot::_internal_players_size() const {
+  return _impl_.players_.size();
 }
-inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
-GameStart::mutable_player_ids() {
-  // @@protoc_insertion_point(field_mutable_list:sanguosha.GameStart.player_ids)
-  return &player_ids_;
+inline int RoomSnapshot::players_size() const {
+  return _internal_players_size();
 }
-
-// -------------------------------------------------------------------
-
-// GameMessage
-
-// .sanguosha.MessageType type = 1;
-inline void GameMessage::clear_type() {
-  type_ = 0;
+inline void RoomSnapshot::clear_players() {
+  _impl_.players_.Clear();
 }
-inline ::sanguosha::MessageType GameMessage::type() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.type)
-  return static_cast< ::sanguosha::MessageType >(type_);
+inline uint32_t RoomSnapshot::_internal_players(int index) const {
+  return _impl_.players_.Get(index);
 }
-inline void GameMessage::set_type(::sanguosha::MessageType value) {
-  
-  type_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameMessage.type)
+inline uint32_t RoomSnapshot::players(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomSnapshot.players)
+  return _internal_players(index);
 }
-
-// .sanguosha.LoginRequest login_request = 2;
-inline bool GameMessage::has_login_request() const {
-  return content_case() == kLoginRequest;
+inline void RoomSnapshot::set_players(int index, uint32_t value) {
+  _impl_.players_.Set(index, value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomSnapshot.players)
 }
-inline void GameMessage::set_has_login_request() {
-  _oneof_case_[0] = kLoginRequest;
+inline void RoomSnapshot::_internal_add_players(uint32_t value) {
+  _impl_.players_.Add(value);
 }
-inline void GameMessage::clear_login_request() {
-  if (has_login_request()) {
-    delete content_.login_request_;
-    clear_has_content();
-  }
+inline void RoomSnapshot::add_players(uint32_t value) {
+  _internal_add_players(value);
+  // @@protoc_insertion_point(field_add:sanguosha.RoomSnapshot.players)
 }
-inline const ::sanguosha::LoginRequest& GameMessage::_internal_login_request() const {
-  return *content_.login_request_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoomSnapshot::_internal_players() const {
+  return _impl_.players_;
 }
-inline ::sanguosha::LoginRequest* GameMessage::release_login_request() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.login_request)
-  if (has_login_request()) {
-    clear_has_content();
-      ::sanguosha::LoginRequest* temp = content_.login_request_;
-    content_.login_request_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoomSnapshot::players() const {
+  // @@protoc_insertion_point(field_list:sanguosha.RoomSnapshot.players)
+  return _internal_players();
 }
-inline const ::sanguosha::LoginRequest& GameMessage::login_request() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.login_request)
-  return has_login_request()
-      ? *content_.login_request_
-      : *reinterpret_cast< ::sanguosha::LoginRequest*>(&::sanguosha::_LoginRequest_default_instance_);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoomSnapshot::_internal_mutable_players() {
+  return &_impl_.players_;
 }
-inline ::sanguosha::LoginRequest* GameMessage::mutable_login_request() {
-  if (!has_login_request()) {
-    clear_content();
-    set_has_login_request();
-    content_.login_request_ = CreateMaybeMessage< ::sanguosha::LoginRequest >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.login_request)
-  return content_.login_request_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoomSnapshot::mutable_players() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomSnapshot.players)
+  return _internal_mutable_players();
 }
 
-// .sanguosha.LoginResponse login_response = 3;
-inline bool GameMessage::has_login_response() const {
-  return content_case() == kLoginResponse;
+// .sanguosha.GameSnapshot game = 4;
+inline bool RoomSnapshot::_internal_has_game() const {
+  return this != internal_default_instance() && _impl_.game_ != nullptr;
 }
-inline void GameMessage::set_has_login_response() {
-  _oneof_case_[0] = kLoginResponse;
+inline bool RoomSnapshot::has_game() const {
+  return _internal_has_game();
 }
-inline void GameMessage::clear_login_response() {
-  if (has_login_response()) {
-    delete content_.login_response_;
-    clear_has_content();
+inline void RoomSnapshot::clear_game() {
+  if (GetArenaForAllocation() == nullptr && _impl_.game_ != nullptr) {
+    delete _impl_.game_;
   }
+  _impl_.game_ = nullptr;
 }
-inline const ::sanguosha::LoginResponse& GameMessage::_internal_login_response() const {
-  return *content_.login_response_;
-}
-inline ::sanguosha::LoginResponse* GameMessage::release_login_response() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.login_response)
-  if (has_login_response()) {
-    clear_has_content();
-      ::sanguosha::LoginResponse* temp = content_.login_response_;
-    content_.login_response_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
+inline const ::sanguosha::GameSnapshot& RoomSnapshot::_internal_game() const {
+  const ::sanguosha::GameSnapshot* p = _impl_.game_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sanguosha::GameSnapshot&>(
+      ::sanguosha::_GameSnapshot_default_instance_);
 }
-inline const ::sanguosha::LoginResponse& GameMessage::login_response() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.login_response)
-  return has_login_response()
-      ? *content_.login_response_
-      : *reinterpret_cast< ::sanguosha::LoginResponse*>(&::sanguosha::_LoginResponse_default_instance_);
+inline const ::sanguosha::GameSnapshot& RoomSnapshot::game() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomSnapshot.game)
+  return _internal_game();
 }
-inline ::sanguosha::LoginResponse* GameMessage::mutable_login_response() {
-  if (!has_login_response()) {
-    clear_content();
-    set_has_login_response();
-    content_.login_response_ = CreateMaybeMessage< ::sanguosha::LoginResponse >(
-        GetArenaNoVirtual());
+inline void RoomSnapshot::unsafe_arena_set_allocated_game(
+    ::sanguosha::GameSnapshot* game) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.game_);
   }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.login_response)
-  return content_.login_response_;
+  _impl_.game_ = game;
+  if (game) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.RoomSnapshot.game)
 }
-
-// .sanguosha.Heartbeat heartbeat = 4;
-inline bool GameMessage::has_heartbeat() const {
-  return content_case() == kHeartbeat;
+inline ::sanguosha::GameSnapshot* RoomSnapshot::release_game() {
+  
+  ::sanguosha::GameSnapshot* temp = _impl_.game_;
+  _impl_.game_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void GameMessage::set_has_heartbeat() {
-  _oneof_case_[0] = kHeartbeat;
+inline ::sanguosha::GameSnapshot* RoomSnapshot::unsafe_arena_release_game() {
+  // @@protoc_insertion_point(field_release:sanguosha.RoomSnapshot.game)
+  
+  ::sanguosha::GameSnapshot* temp = _impl_.game_;
+  _impl_.game_ = nullptr;
+  return temp;
 }
-inline void GameMessage::clear_heartbeat() {
-  if (has_heartbeat()) {
-    delete content_.heartbeat_;
-    clear_has_content();
+inline ::sanguosha::GameSnapshot* RoomSnapshot::_internal_mutable_game() {
+  
+  if (_impl_.game_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sanguosha::GameSnapshot>(GetArenaForAllocation());
+    _impl_.game_ = p;
   }
+  return _impl_.game_;
 }
-inline const ::sanguosha::Heartbeat& GameMessage::_internal_heartbeat() const {
-  return *content_.heartbeat_;
+inline ::sanguosha::GameSnapshot* RoomSnapshot::mutable_game() {
+  ::sanguosha::GameSnapshot* _msg = _internal_mutable_game();
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomSnapshot.game)
+  return _msg;
 }
-inline ::sanguosha::Heartbeat* GameMessage::release_heartbeat() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.heartbeat)
-  if (has_heartbeat()) {
-    clear_has_content();
-      ::sanguosha::Heartbeat* temp = content_.heartbeat_;
-    content_.heartbeat_ = NULL;
-    return temp;
+inline void RoomSnapshot::set_allocated_game(::sanguosha::GameSnapshot* game) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.game_;
+  }
+  if (game) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(game);
+    if (message_arena != submessage_arena) {
+      game = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, game, submessage_arena);
+    }
+    
   } else {
-    return NULL;
+    
   }
+  _impl_.game_ = game;
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomSnapshot.game)
 }
-inline const ::sanguosha::Heartbeat& GameMessage::heartbeat() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.heartbeat)
-  return has_heartbeat()
-      ? *content_.heartbeat_
-      : *reinterpret_cast< ::sanguosha::Heartbeat*>(&::sanguosha::_Heartbeat_default_instance_);
+
+// -------------------------------------------------------------------
+
+// RoomManagerSnapshot
+
+// uint64 generation = 1;
+inline void RoomManagerSnapshot::clear_generation() {
+  _impl_.generation_ = uint64_t{0u};
 }
-inline ::sanguosha::Heartbeat* GameMessage::mutable_heartbeat() {
-  if (!has_heartbeat()) {
-    clear_content();
-    set_has_heartbeat();
-    content_.heartbeat_ = CreateMaybeMessage< ::sanguosha::Heartbeat >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.heartbeat)
-  return content_.heartbeat_;
+inline uint64_t RoomManagerSnapshot::_internal_generation() const {
+  return _impl_.generation_;
 }
-
-// .sanguosha.RoomRequest room_request = 5;
-inline bool GameMessage::has_room_request() const {
-  return content_case() == kRoomRequest;
+inline uint64_t RoomManagerSnapshot::generation() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomManagerSnapshot.generation)
+  return _internal_generation();
 }
-inline void GameMessage::set_has_room_request() {
-  _oneof_case_[0] = kRoomRequest;
+inline void RoomManagerSnapshot::_internal_set_generation(uint64_t value) {
+  
+  _impl_.generation_ = value;
 }
-inline void GameMessage::clear_room_request() {
-  if (has_room_request()) {
-    delete content_.room_request_;
-    clear_has_content();
-  }
+inline void RoomManagerSnapshot::set_generation(uint64_t value) {
+  _internal_set_generation(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomManagerSnapshot.generation)
 }
-inline const ::sanguosha::RoomRequest& GameMessage::_internal_room_request() const {
-  return *content_.room_request_;
+
+// uint32 next_room_id = 2;
+inline void RoomManagerSnapshot::clear_next_room_id() {
+  _impl_.next_room_id_ = 0u;
 }
-inline ::sanguosha::RoomRequest* GameMessage::release_room_request() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_request)
-  if (has_room_request()) {
-    clear_has_content();
-      ::sanguosha::RoomRequest* temp = content_.room_request_;
-    content_.room_request_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
+inline uint32_t RoomManagerSnapshot::_internal_next_room_id() const {
+  return _impl_.next_room_id_;
 }
-inline const ::sanguosha::RoomRequest& GameMessage::room_request() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_request)
-  return has_room_request()
-      ? *content_.room_request_
-      : *reinterpret_cast< ::sanguosha::RoomRequest*>(&::sanguosha::_RoomRequest_default_instance_);
+inline uint32_t RoomManagerSnapshot::next_room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomManagerSnapshot.next_room_id)
+  return _internal_next_room_id();
 }
-inline ::sanguosha::RoomRequest* GameMessage::mutable_room_request() {
-  if (!has_room_request()) {
-    clear_content();
-    set_has_room_request();
-    content_.room_request_ = CreateMaybeMessage< ::sanguosha::RoomRequest >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_request)
-  return content_.room_request_;
+inline void RoomManagerSnapshot::_internal_set_next_room_id(uint32_t value) {
+  
+  _impl_.next_room_id_ = value;
+}
+inline void RoomManagerSnapshot::set_next_room_id(uint32_t value) {
+  _internal_set_next_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomManagerSnapshot.next_room_id)
 }
 
-// .sanguosha.RoomResponse room_response = 6;
-inline bool GameMessage::has_room_response() const {
-  return content_case() == kRoomResponse;
+// uint32 next_bot_id = 3;
+inline void RoomManagerSnapshot::clear_next_bot_id() {
+  _impl_.next_bot_id_ = 0u;
 }
-inline void GameMessage::set_has_room_response() {
-  _oneof_case_[0] = kRoomResponse;
+inline uint32_t RoomManagerSnapshot::_internal_next_bot_id() const {
+  return _impl_.next_bot_id_;
 }
-inline void GameMessage::clear_room_response() {
-  if (has_room_response()) {
-    delete content_.room_response_;
-    clear_has_content();
-  }
+inline uint32_t RoomManagerSnapshot::next_bot_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomManagerSnapshot.next_bot_id)
+  return _internal_next_bot_id();
 }
-inline const ::sanguosha::RoomResponse& GameMessage::_internal_room_response() const {
-  return *content_.room_response_;
+inline void RoomManagerSnapshot::_internal_set_next_bot_id(uint32_t value) {
+  
+  _impl_.next_bot_id_ = value;
 }
-inline ::sanguosha::RoomResponse* GameMessage::release_room_response() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_response)
-  if (has_room_response()) {
-    clear_has_content();
-      ::sanguosha::RoomResponse* temp = content_.room_response_;
-    content_.room_response_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
+inline void RoomManagerSnapshot::set_next_bot_id(uint32_t value) {
+  _internal_set_next_bot_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomManagerSnapshot.next_bot_id)
 }
-inline const ::sanguosha::RoomResponse& GameMessage::room_response() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_response)
-  return has_room_response()
-      ? *content_.room_response_
-      : *reinterpret_cast< ::sanguosha::RoomResponse*>(&::sanguosha::_RoomResponse_default_instance_);
+
+// repeated .sanguosha.RoomSnapshot rooms = 4;
+inline int RoomManagerSnapshot::_internal_rooms_size() const {
+  return _impl_.rooms_.size();
 }
-inline ::sanguosha::RoomResponse* GameMessage::mutable_room_response() {
-  if (!has_room_response()) {
-    clear_content();
-    set_has_room_response();
-    content_.room_response_ = CreateMaybeMessage< ::sanguosha::RoomResponse >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_response)
-  return content_.room_response_;
+inline int RoomManagerSnapshot::rooms_size() const {
+  return _internal_rooms_size();
 }
-
-// .sanguosha.GameAction game_action = 7;
-inline bool GameMessage::has_game_action() const {
-  return content_case() == kGameAction;
+inline void RoomManagerSnapshot::clear_rooms() {
+  _impl_.rooms_.Clear();
 }
-inline void GameMessage::set_has_game_action() {
-  _oneof_case_[0] = kGameAction;
+inline ::sanguosha::RoomSnapshot* RoomManagerSnapshot::mutable_rooms(int index) {
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomManagerSnapshot.rooms)
+  return _impl_.rooms_.Mutable(index);
 }
-inline void GameMessage::clear_game_action() {
-  if (has_game_action()) {
-    delete content_.game_action_;
-    clear_has_content();
-  }
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomSnapshot >*
+RoomManagerSnapshot::mutable_rooms() {
+  // @@protoc_insertion_point(field_mutable_list:sanguosha.RoomManagerSnapshot.rooms)
+  return &_impl_.rooms_;
 }
-inline const ::sanguosha::GameAction& GameMessage::_internal_game_action() const {
-  return *content_.game_action_;
+inline const ::sanguosha::RoomSnapshot& RoomManagerSnapshot::_internal_rooms(int index) const {
+  return _impl_.rooms_.Get(index);
 }
-inline ::sanguosha::GameAction* GameMessage::release_game_action() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_action)
-  if (has_game_action()) {
-    clear_has_content();
-      ::sanguosha::GameAction* temp = content_.game_action_;
-    content_.game_action_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
+inline const ::sanguosha::RoomSnapshot& RoomManagerSnapshot::rooms(int index) const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomManagerSnapshot.rooms)
+  return _internal_rooms(index);
 }
-inline const ::sanguosha::GameAction& GameMessage::game_action() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_action)
-  return has_game_action()
-      ? *content_.game_action_
-      : *reinterpret_cast< ::sanguosha::GameAction*>(&::sanguosha::_GameAction_default_instance_);
+inline ::sanguosha::RoomSnapshot* RoomManagerSnapshot::_internal_add_rooms() {
+  return _impl_.rooms_.Add();
 }
-inline ::sanguosha::GameAction* GameMessage::mutable_game_action() {
-  if (!has_game_action()) {
-    clear_content();
-    set_has_game_action();
-    content_.game_action_ = CreateMaybeMessage< ::sanguosha::GameAction >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_action)
-  return content_.game_action_;
+inline ::sanguosha::RoomSnapshot* RoomManagerSnapshot::add_rooms() {
+  ::sanguosha::RoomSnapshot* _add = _internal_add_rooms();
+  // @@protoc_insertion_point(field_add:sanguosha.RoomManagerSnapshot.rooms)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::sanguosha::RoomSnapshot >&
+RoomManagerSnapshot::rooms() const {
+  // @@protoc_insertion_point(field_list:sanguosha.RoomManagerSnapshot.rooms)
+  return _impl_.rooms_;
 }
 
-// .sanguosha.GameState game_state = 8;
-inline bool GameMessage::has_game_state() const {
-  return content_case() == kGameState;
+// -------------------------------------------------------------------
+
+// RoomJournalRecord
+
+// .sanguosha.RoomJournalRecord.Kind kind = 1;
+inline void RoomJournalRecord::clear_kind() {
+  _impl_.kind_ = 0;
 }
-inline void GameMessage::set_has_game_state() {
-  _oneof_case_[0] = kGameState;
+inline ::sanguosha::RoomJournalRecord_Kind RoomJournalRecord::_internal_kind() const {
+  return static_cast< ::sanguosha::RoomJournalRecord_Kind >(_impl_.kind_);
 }
-inline void GameMessage::clear_game_state() {
-  if (has_game_state()) {
-    delete content_.game_state_;
-    clear_has_content();
-  }
+inline ::sanguosha::RoomJournalRecord_Kind RoomJournalRecord::kind() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomJournalRecord.kind)
+  return _internal_kind();
 }
-inline const ::sanguosha::GameState& GameMessage::_internal_game_state() const {
-  return *content_.game_state_;
+inline void RoomJournalRecord::_internal_set_kind(::sanguosha::RoomJournalRecord_Kind value) {
+  
+  _impl_.kind_ = value;
 }
-inline ::sanguosha::GameState* GameMessage::release_game_state() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_state)
-  if (has_game_state()) {
-    clear_has_content();
-      ::sanguosha::GameState* temp = content_.game_state_;
-    content_.game_state_ = NULL;
-    return temp;
-  } else {
-    return NULL;
-  }
+inline void RoomJournalRecord::set_kind(::sanguosha::RoomJournalRecord_Kind value) {
+  _internal_set_kind(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomJournalRecord.kind)
 }
-inline const ::sanguosha::GameState& GameMessage::game_state() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_state)
-  return has_game_state()
-      ? *content_.game_state_
-      : *reinterpret_cast< ::sanguosha::GameState*>(&::sanguosha::_GameState_default_instance_);
+
+// uint32 room_id = 2;
+inline void RoomJournalRecord::clear_room_id() {
+  _impl_.room_id_ = 0u;
 }
-inline ::sanguosha::GameState* GameMessage::mutable_game_state() {
-  if (!has_game_state()) {
-    clear_content();
-    set_has_game_state();
-    content_.game_state_ = CreateMaybeMessage< ::sanguosha::GameState >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_state)
-  return content_.game_state_;
+inline uint32_t RoomJournalRecord::_internal_room_id() const {
+  return _impl_.room_id_;
 }
-
-// .sanguosha.GameStart game_start = 9;
-inline bool GameMessage::has_game_start() const {
-  return content_case() == kGameStart;
+inline uint32_t RoomJournalRecord::room_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomJournalRecord.room_id)
+  return _internal_room_id();
 }
-inline void GameMessage::set_has_game_start() {
-  _oneof_case_[0] = kGameStart;
+inline void RoomJournalRecord::_internal_set_room_id(uint32_t value) {
+  
+  _impl_.room_id_ = value;
 }
-inline void GameMessage::clear_game_start() {
-  if (has_game_start()) {
-    delete content_.game_start_;
-    clear_has_content();
-  }
+inline void RoomJournalRecord::set_room_id(uint32_t value) {
+  _internal_set_room_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomJournalRecord.room_id)
 }
-inline const ::sanguosha::GameStart& GameMessage::_internal_game_start() const {
-  return *content_.game_start_;
+
+// .sanguosha.RoomSnapshot room = 3;
+inline bool RoomJournalRecord::_internal_has_room() const {
+  return this != internal_default_instance() && _impl_.room_ != nullptr;
 }
-inline ::sanguosha::GameStart* GameMessage::release_game_start() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_start)
-  if (has_game_start()) {
-    clear_has_content();
-      ::sanguosha::GameStart* temp = content_.game_start_;
-    content_.game_start_ = NULL;
-    return temp;
-  } else {
-    return NULL;
+inline bool RoomJournalRecord::has_room() const {
+  return _internal_has_room();
+}
+inline void RoomJournalRecord::clear_room() {
+  if (GetArenaForAllocation() == nullptr && _impl_.room_ != nullptr) {
+    delete _impl_.room_;
   }
+  _impl_.room_ = nullptr;
 }
-inline const ::sanguosha::GameStart& GameMessage::game_start() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_start)
-  return has_game_start()
-      ? *content_.game_start_
-      : *reinterpret_cast< ::sanguosha::GameStart*>(&::sanguosha::_GameStart_default_instance_);
+inline const ::sanguosha::RoomSnapshot& RoomJournalRecord::_internal_room() const {
+  const ::sanguosha::RoomSnapshot* p = _impl_.room_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sanguosha::RoomSnapshot&>(
+      ::sanguosha::_RoomSnapshot_default_instance_);
 }
-inline ::sanguosha::GameStart* GameMessage::mutable_game_start() {
-  if (!has_game_start()) {
-    clear_content();
-    set_has_game_start();
-    content_.game_start_ = CreateMaybeMessage< ::sanguosha::GameStart >(
-        GetArenaNoVirtual());
+inline const ::sanguosha::RoomSnapshot& RoomJournalRecord::room() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomJournalRecord.room)
+  return _internal_room();
+}
+inline void RoomJournalRecord::unsafe_arena_set_allocated_room(
+    ::sanguosha::RoomSnapshot* room) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.room_);
   }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_start)
-  return content_.game_start_;
+  _impl_.room_ = room;
+  if (room) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.RoomJournalRecord.room)
 }
-
-// .sanguosha.GameOver game_over = 10;
-inline bool GameMessage::has_game_over() const {
-  return content_case() == kGameOver;
+inline ::sanguosha::RoomSnapshot* RoomJournalRecord::release_room() {
+  
+  ::sanguosha::RoomSnapshot* temp = _impl_.room_;
+  _impl_.room_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void GameMessage::set_has_game_over() {
-  _oneof_case_[0] = kGameOver;
+inline ::sanguosha::RoomSnapshot* RoomJournalRecord::unsafe_arena_release_room() {
+  // @@protoc_insertion_point(field_release:sanguosha.RoomJournalRecord.room)
+  
+  ::sanguosha::RoomSnapshot* temp = _impl_.room_;
+  _impl_.room_ = nullptr;
+  return temp;
 }
-inline void GameMessage::clear_game_over() {
-  if (has_game_over()) {
-    delete content_.game_over_;
-    clear_has_content();
+inline ::sanguosha::RoomSnapshot* RoomJournalRecord::_internal_mutable_room() {
+  
+  if (_impl_.room_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sanguosha::RoomSnapshot>(GetArenaForAllocation());
+    _impl_.room_ = p;
   }
+  return _impl_.room_;
 }
-inline const ::sanguosha::GameOver& GameMessage::_internal_game_over() const {
-  return *content_.game_over_;
+inline ::sanguosha::RoomSnapshot* RoomJournalRecord::mutable_room() {
+  ::sanguosha::RoomSnapshot* _msg = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomJournalRecord.room)
+  return _msg;
 }
-inline ::sanguosha::GameOver* GameMessage::release_game_over() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.game_over)
-  if (has_game_over()) {
-    clear_has_content();
-      ::sanguosha::GameOver* temp = content_.game_over_;
-    content_.game_over_ = NULL;
-    return temp;
+inline void RoomJournalRecord::set_allocated_room(::sanguosha::RoomSnapshot* room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.room_;
+  }
+  if (room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room);
+    if (message_arena != submessage_arena) {
+      room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room, submessage_arena);
+    }
+    
   } else {
-    return NULL;
+    
   }
+  _impl_.room_ = room;
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomJournalRecord.room)
 }
-inline const ::sanguosha::GameOver& GameMessage::game_over() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.game_over)
-  return has_game_over()
-      ? *content_.game_over_
-      : *reinterpret_cast< ::sanguosha::GameOver*>(&::sanguosha::_GameOver_default_instance_);
+
+// uint32 player_id = 4;
+inline void RoomJournalRecord::clear_player_id() {
+  _impl_.player_id_ = 0u;
 }
-inline ::sanguosha::GameOver* GameMessage::mutable_game_over() {
-  if (!has_game_over()) {
-    clear_content();
-    set_has_game_over();
-    content_.game_over_ = CreateMaybeMessage< ::sanguosha::GameOver >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.game_over)
-  return content_.game_over_;
+inline uint32_t RoomJournalRecord::_internal_player_id() const {
+  return _impl_.player_id_;
+}
+inline uint32_t RoomJournalRecord::player_id() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomJournalRecord.player_id)
+  return _internal_player_id();
+}
+inline void RoomJournalRecord::_internal_set_player_id(uint32_t value) {
+  
+  _impl_.player_id_ = value;
+}
+inline void RoomJournalRecord::set_player_id(uint32_t value) {
+  _internal_set_player_id(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomJournalRecord.player_id)
 }
 
-// .sanguosha.RoomListResponse room_list_response = 14;
-inline bool GameMessage::has_room_list_response() const {
-  return content_case() == kRoomListResponse;
+// .sanguosha.GameAction action = 5;
+inline bool RoomJournalRecord::_internal_has_action() const {
+  return this != internal_default_instance() && _impl_.action_ != nullptr;
 }
-inline void GameMessage::set_has_room_list_response() {
-  _oneof_case_[0] = kRoomListResponse;
+inline bool RoomJournalRecord::has_action() const {
+  return _internal_has_action();
 }
-inline void GameMessage::clear_room_list_response() {
-  if (has_room_list_response()) {
-    delete content_.room_list_response_;
-    clear_has_content();
+inline void RoomJournalRecord::clear_action() {
+  if (GetArenaForAllocation() == nullptr && _impl_.action_ != nullptr) {
+    delete _impl_.action_;
   }
+  _impl_.action_ = nullptr;
 }
-inline const ::sanguosha::RoomListResponse& GameMessage::_internal_room_list_response() const {
-  return *content_.room_list_response_;
+inline const ::sanguosha::GameAction& RoomJournalRecord::_internal_action() const {
+  const ::sanguosha::GameAction* p = _impl_.action_;
+  return p != nullptr ? *p : reinterpret_cast<const ::sanguosha::GameAction&>(
+      ::sanguosha::_GameAction_default_instance_);
 }
-inline ::sanguosha::RoomListResponse* GameMessage::release_room_list_response() {
-  // @@protoc_insertion_point(field_release:sanguosha.GameMessage.room_list_response)
-  if (has_room_list_response()) {
-    clear_has_content();
-      ::sanguosha::RoomListResponse* temp = content_.room_list_response_;
-    content_.room_list_response_ = NULL;
-    return temp;
+inline const ::sanguosha::GameAction& RoomJournalRecord::action() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomJournalRecord.action)
+  return _internal_action();
+}
+inline void RoomJournalRecord::unsafe_arena_set_allocated_action(
+    ::sanguosha::GameAction* action) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.action_);
+  }
+  _impl_.action_ = action;
+  if (action) {
+    
   } else {
-    return NULL;
+    
   }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:sanguosha.RoomJournalRecord.action)
 }
-inline const ::sanguosha::RoomListResponse& GameMessage::room_list_response() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameMessage.room_list_response)
-  return has_room_list_response()
-      ? *content_.room_list_response_
-      : *reinterpret_cast< ::sanguosha::RoomListResponse*>(&::sanguosha::_RoomListResponse_default_instance_);
+inline ::sanguosha::GameAction* RoomJournalRecord::release_action() {
+  
+  ::sanguosha::GameAction* temp = _impl_.action_;
+  _impl_.action_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline ::sanguosha::RoomListResponse* GameMessage::mutable_room_list_response() {
-  if (!has_room_list_response()) {
-    clear_content();
-    set_has_room_list_response();
-    content_.room_list_response_ = CreateMaybeMessage< ::sanguosha::RoomListResponse >(
-        GetArenaNoVirtual());
-  }
-  // @@protoc_insertion_point(field_mutable:sanguosha.GameMessage.room_list_response)
-  return content_.room_list_response_;
+inline ::sanguosha::GameAction* RoomJournalRecord::unsafe_arena_release_action() {
+  // @@protoc_insertion_point(field_release:sanguosha.RoomJournalRecord.action)
+  
+  ::sanguosha::GameAction* temp = _impl_.action_;
+  _impl_.action_ = nullptr;
+  return temp;
 }
-
-inline bool GameMessage::has_content() const {
-  return content_case() != CONTENT_NOT_SET;
+inline ::sanguosha::GameAction* RoomJournalRecord::_internal_mutable_action() {
+  
+  if (_impl_.action_ == nullptr) {
+    auto* p = CreateMaybeMessage<::sanguosha::GameAction>(GetArenaForAllocation());
+    _impl_.action_ = p;
+  }
+  return _impl_.action_;
 }
-inline void GameMessage::clear_has_content() {
-  _oneof_case_[0] = CONTENT_NOT_SET;
+inline ::sanguosha::GameAction* RoomJournalRecord::mutable_action() {
+  ::sanguosha::GameAction* _msg = _internal_mutable_action();
+  // @@protoc_insertion_point(field_mutable:sanguosha.RoomJournalRecord.action)
+  return _msg;
 }
-inline GameMessage::ContentCase GameMessage::content_case() const {
-  return GameMessage::ContentCase(_oneof_case_[0]);
+inline void RoomJournalRecord::set_allocated_action(::sanguosha::GameAction* action) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.action_;
+  }
+  if (action) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(action);
+    if (message_arena != submessage_arena) {
+      action = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, action, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.action_ = action;
+  // @@protoc_insertion_point(field_set_allocated:sanguosha.RoomJournalRecord.action)
 }
-// -------------------------------------------------------------------
 
-// GameOver
-
-// uint32 winner_id = 1;
-inline void GameOver::clear_winner_id() {
-  winner_id_ = 0u;
+// uint64 sequence = 6;
+inline void RoomJournalRecord::clear_sequence() {
+  _impl_.sequence_ = uint64_t{0u};
 }
-inline ::google::protobuf::uint32 GameOver::winner_id() const {
-  // @@protoc_insertion_point(field_get:sanguosha.GameOver.winner_id)
-  return winner_id_;
+inline uint64_t RoomJournalRecord::_internal_sequence() const {
+  return _impl_.sequence_;
+}
+inline uint64_t RoomJournalRecord::sequence() const {
+  // @@protoc_insertion_point(field_get:sanguosha.RoomJournalRecord.sequence)
+  return _internal_sequence();
 }
-inline void GameOver::set_winner_id(::google::protobuf::uint32 value) {
+inline void RoomJournalRecord::_internal_set_sequence(uint64_t value) {
   
-  winner_id_ = value;
-  // @@protoc_insertion_point(field_set:sanguosha.GameOver.winner_id)
+  _impl_.sequence_ = value;
+}
+inline void RoomJournalRecord::set_sequence(uint64_t value) {
+  _internal_set_sequence(value);
+  // @@protoc_insertion_point(field_set:sanguosha.RoomJournalRecord.sequence)
 }
 
 #ifdef __GNUC__
@@ -3330,19 +8193,42 @@ inline void GameOver::set_winner_id(::google::protobuf::uint32 value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace sanguosha
 
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::sanguosha::RoomJournalRecord_Kind> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::RoomJournalRecord_Kind>() {
+  return ::sanguosha::RoomJournalRecord_Kind_descriptor();
+}
 template <> struct is_proto_enum< ::sanguosha::MessageType> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::MessageType>() {
   return ::sanguosha::MessageType_descriptor();
 }
+template <> struct is_proto_enum< ::sanguosha::Capability> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::Capability>() {
+  return ::sanguosha::Capability_descriptor();
+}
 template <> struct is_proto_enum< ::sanguosha::RoomAction> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::RoomAction>() {
@@ -3368,10 +8254,15 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::ActionType>() {
   return ::sanguosha::ActionType_descriptor();
 }
+template <> struct is_proto_enum< ::sanguosha::Role> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::sanguosha::Role>() {
+  return ::sanguosha::Role_descriptor();
+}
 
-}  // namespace protobuf
-}  // namespace google
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_INCLUDED_sanguosha_2eproto
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_sanguosha_2eproto
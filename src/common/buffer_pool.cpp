@@ -0,0 +1,117 @@
+#include "common/buffer_pool.h"
+#include <utility>
+
+namespace Sanguosha {
+namespace Common {
+
+BufferPool::Buffer::Buffer(Buffer&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)),
+      data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      capacity_(std::exchange(other.capacity_, 0)) {
+}
+
+BufferPool::Buffer& BufferPool::Buffer::operator=(Buffer&& other) noexcept {
+    if (this != &other) {
+        reset();
+        pool_ = std::exchange(other.pool_, nullptr);
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+}
+
+void BufferPool::Buffer::reset() {
+    if (data_) {
+        pool_->release(data_, capacity_);
+    }
+    pool_ = nullptr;
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+}
+
+BufferPool::BufferPool(size_t maxCachedBytesPerClass) {
+    size_t size = MIN_CLASS_SIZE;
+    for (auto& sizeClass : classes_) {
+        sizeClass.size = size;
+        sizeClass.maxCached = maxCachedBytesPerClass / size;
+        size *= 4;
+    }
+}
+
+BufferPool::~BufferPool() {
+    for (auto& sizeClass : classes_) {
+        for (char* data : sizeClass.free) {
+            delete[] data;
+        }
+    }
+}
+
+int BufferPool::classFor(size_t size) {
+    size_t classSize = MIN_CLASS_SIZE;
+    for (size_t i = 0; i < CLASS_COUNT; ++i, classSize *= 4) {
+        if (size <= classSize) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+BufferPool::Buffer BufferPool::acquire(size_t size) {
+    Buffer buffer;
+    if (size == 0) {
+        return buffer;
+    }
+
+    int index = classFor(size);
+    char* data = nullptr;
+    size_t capacity = size;
+    if (index >= 0) {
+        auto& sizeClass = classes_[index];
+        capacity = sizeClass.size;
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        if (!sizeClass.free.empty()) {
+            data = sizeClass.free.back();
+            sizeClass.free.pop_back();
+        }
+    }
+    if (data) {
+        hits_.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        data = new char[capacity];
+    }
+
+    buffer.pool_ = this;
+    buffer.data_ = data;
+    buffer.size_ = size;
+    buffer.capacity_ = capacity;
+    return buffer;
+}
+
+void BufferPool::release(char* data, size_t capacity) {
+    int index = classFor(capacity);
+    if (index >= 0 && classes_[index].size == capacity) {
+        auto& sizeClass = classes_[index];
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        if (sizeClass.free.size() < sizeClass.maxCached) {
+            sizeClass.free.push_back(data);
+            return;
+        }
+    }
+    delete[] data; // 超出缓存上限或不属于任何分级
+}
+
+size_t BufferPool::cachedBytes() const {
+    size_t total = 0;
+    for (const auto& sizeClass : classes_) {
+        std::lock_guard<std::mutex> lock(sizeClass.mutex);
+        total += sizeClass.free.size() * sizeClass.size;
+    }
+    return total;
+}
+
+} // namespace Common
+} // namespace Sanguosha
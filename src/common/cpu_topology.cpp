@@ -0,0 +1,153 @@
+#include "common/cpu_topology.h"
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <system_error>
+#include <pthread.h>
+#include <sched.h>
+
+namespace Sanguosha {
+namespace Common {
+
+namespace {
+
+const char* const NODE_ROOT = "/sys/devices/system/node/node";
+
+int parseCpuNumber(const std::string& text, const std::string& whole) {
+    if (text.empty() || text.find_first_not_of("0123456789") != std::string::npos || text.size() > 6) {
+        throw std::invalid_argument("invalid cpu list: " + whole);
+    }
+    return std::stoi(text);
+}
+
+void setAffinity(pthread_t thread, int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        throw std::system_error(EINVAL, std::generic_category(), "cpu " + std::to_string(cpu) + " out of range");
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    int rc = ::pthread_setaffinity_np(thread, sizeof(set), &set);
+    if (rc != 0) {
+        throw std::system_error(rc, std::generic_category(), "bind thread to cpu " + std::to_string(cpu));
+    }
+}
+
+} // namespace
+
+std::vector<int> parseCpuList(const std::string& text) {
+    std::vector<int> cpus;
+    std::stringstream stream(text);
+    std::string part;
+    while (std::getline(stream, part, ',')) {
+        auto dash = part.find('-');
+        if (dash == std::string::npos) {
+            cpus.push_back(parseCpuNumber(part, text));
+            continue;
+        }
+        int first = parseCpuNumber(part.substr(0, dash), text);
+        int last = parseCpuNumber(part.substr(dash + 1), text);
+        if (last < first) {
+            throw std::invalid_argument("invalid cpu list: " + text);
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    if (cpus.empty()) {
+        throw std::invalid_argument("invalid cpu list: " + text);
+    }
+    return cpus;
+}
+
+std::string formatCpuList(const std::vector<int>& cpus) {
+    std::string out;
+    for (size_t i = 0; i < cpus.size();) {
+        size_t j = i;
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1) {
+            ++j;
+        }
+        if (!out.empty()) {
+            out += ',';
+        }
+        out += std::to_string(cpus[i]);
+        if (j > i) {
+            out += '-' + std::to_string(cpus[j]);
+        }
+        i = j + 1;
+    }
+    return out;
+}
+
+CpuTopology CpuTopology::detect() {
+    CpuTopology topology;
+    // 节点编号通常连续，遇到第一个不存在的节点即停止
+    for (int node = 0;; ++node) {
+        std::ifstream file(NODE_ROOT + std::to_string(node) + "/cpulist");
+        std::string line;
+        if (!file || !std::getline(file, line)) {
+            break;
+        }
+        try {
+            topology.nodes_.push_back(line.empty() ? std::vector<int>{} : parseCpuList(line));
+        } catch (const std::invalid_argument&) {
+            topology.nodes_.push_back({});
+        }
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                topology.allowedCpus_.push_back(cpu);
+            }
+        }
+    }
+    if (topology.allowedCpus_.empty()) {
+        for (int cpu = 0; cpu < static_cast<int>(std::max(1u, std::thread::hardware_concurrency())); ++cpu) {
+            topology.allowedCpus_.push_back(cpu);
+        }
+    }
+    return topology;
+}
+
+int CpuTopology::nodeOf(int cpu) const {
+    for (size_t node = 0; node < nodes_.size(); ++node) {
+        const auto& cpus = nodes_[node];
+        if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end()) {
+            return static_cast<int>(node);
+        }
+    }
+    return 0;
+}
+
+bool CpuTopology::isAllowed(int cpu) const {
+    return std::find(allowedCpus_.begin(), allowedCpus_.end(), cpu) != allowedCpus_.end();
+}
+
+std::string CpuTopology::describe() const {
+    std::ostringstream out;
+    out << nodeCount() << " NUMA node" << (nodeCount() > 1 ? "s" : "");
+    if (!nodes_.empty()) {
+        out << ":";
+        for (size_t node = 0; node < nodes_.size(); ++node) {
+            out << " node" << node << "=" << formatCpuList(nodes_[node]);
+        }
+    }
+    out << "; " << allowedCpus_.size() << " cpus allowed (" << formatCpuList(allowedCpus_) << ")";
+    return out.str();
+}
+
+void pinCurrentThread(int cpu) {
+    setAffinity(::pthread_self(), cpu);
+}
+
+void pinThread(std::thread& thread, int cpu) {
+    setAffinity(thread.native_handle(), cpu);
+}
+
+} // namespace Common
+} // namespace Sanguosha
@@ -0,0 +1,127 @@
+#include "common/timer_wheel.h"
+#include <algorithm>
+#include <boost/asio/post.hpp>
+
+namespace Sanguosha {
+namespace Common {
+
+TimerWheel::TimerWheel(boost::asio::io_context& io, std::chrono::milliseconds tick, size_t slotCount)
+    : io_(io),
+      timer_(io),
+      tick_(tick.count() > 0 ? tick : std::chrono::milliseconds(1)),
+      origin_(std::chrono::steady_clock::now()),
+      slots_(slotCount > 0 ? slotCount : 1) {
+}
+
+TimerWheel::~TimerWheel() {
+    boost::system::error_code ec;
+    timer_.cancel(ec);
+}
+
+uint64_t TimerWheel::ticksSinceOrigin(std::chrono::steady_clock::time_point now) const {
+    return static_cast<uint64_t>((now - origin_) / tick_);
+}
+
+TimerWheel::TimerId TimerWheel::schedule(std::chrono::milliseconds delay, Callback callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+        return INVALID_TIMER;
+    }
+
+    uint64_t now = ticksSinceOrigin(std::chrono::steady_clock::now());
+    if (entries_.empty()) {
+        // 时间轮空闲期间没有推进，直接对齐到当前时刻
+        currentTick_ = std::max(currentTick_, now);
+    }
+
+    // 向上取整，至少等待一个刻度，保证不会早于截止时间触发
+    uint64_t ticks = static_cast<uint64_t>((delay + tick_ - std::chrono::milliseconds(1)) / tick_);
+    uint64_t expireTick = now + std::max<uint64_t>(ticks, 1);
+
+    TimerId id = nextId_++;
+    entries_.emplace(id, Entry{expireTick, std::move(callback)});
+    slots_[expireTick % slots_.size()].push_back(id);
+
+    if (!armed_) {
+        armed_ = true;
+        // steady_timer不是线程安全的，统一在io线程上设置
+        boost::asio::post(io_, [this]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            arm();
+        });
+    }
+    return id;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // 槽位中的id会在下次扫描到时被惰性丢弃
+    return entries_.erase(id) > 0;
+}
+
+void TimerWheel::stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+    entries_.clear();
+    for (auto& slot : slots_) {
+        slot.clear();
+    }
+}
+
+size_t TimerWheel::pending() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+void TimerWheel::arm() {
+    if (stopped_ || entries_.empty()) {
+        armed_ = false;
+        return;
+    }
+    timer_.expires_at(origin_ + tick_ * (currentTick_ + 1));
+    timer_.async_wait([this](const boost::system::error_code& ec) {
+        onTick(ec);
+    });
+}
+
+void TimerWheel::onTick(const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    std::vector<Callback> expired;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        uint64_t target = ticksSinceOrigin(std::chrono::steady_clock::now());
+        // 落后超过一圈时每个槽位只需扫描一次
+        uint64_t steps = std::min<uint64_t>(target > currentTick_ ? target - currentTick_ : 0,
+                                            slots_.size());
+        for (uint64_t i = 1; i <= steps; ++i) {
+            auto& slot = slots_[(currentTick_ + i) % slots_.size()];
+            auto keep = slot.begin();
+            for (TimerId id : slot) {
+                auto it = entries_.find(id);
+                if (it == entries_.end()) {
+                    continue; // 已取消
+                }
+                if (it->second.expireTick <= target) {
+                    expired.push_back(std::move(it->second.callback));
+                    entries_.erase(it);
+                } else {
+                    *keep++ = id; // 还要再转若干圈
+                }
+            }
+            slot.erase(keep, slot.end());
+        }
+        currentTick_ = std::max(currentTick_, target);
+        arm();
+    }
+
+    // 在锁外执行回调，回调中可以安全地再次调度或取消定时器
+    for (auto& callback : expired) {
+        callback();
+    }
+}
+
+} // namespace Common
+} // namespace Sanguosha
@@ -0,0 +1,49 @@
+#include "common/token_bucket.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Sanguosha {
+namespace Common {
+
+TokenBucket::TokenBucket(double ratePerSecond, double burst)
+    : rate_(ratePerSecond),
+      burst_(std::max(burst, 1.0)),
+      tokens_(burst_),
+      last_(Clock::now()) {
+}
+
+void TokenBucket::refill(Clock::time_point now) {
+    if (now <= last_) {
+        return;
+    }
+    double elapsed = std::chrono::duration<double>(now - last_).count();
+    tokens_ = std::min(burst_, tokens_ + elapsed * rate_);
+    last_ = now;
+}
+
+bool TokenBucket::tryAcquire(double tokens, Clock::time_point now) {
+    if (unlimited()) {
+        return true;
+    }
+    refill(now);
+    if (tokens_ < tokens) {
+        return false;
+    }
+    tokens_ -= tokens;
+    return true;
+}
+
+std::chrono::milliseconds TokenBucket::timeUntilAvailable(double tokens, Clock::time_point now) {
+    if (unlimited()) {
+        return std::chrono::milliseconds(0);
+    }
+    refill(now);
+    if (tokens_ >= tokens) {
+        return std::chrono::milliseconds(0);
+    }
+    double seconds = (tokens - tokens_) / rate_;
+    return std::chrono::milliseconds(static_cast<int64_t>(std::ceil(seconds * 1000.0)));
+}
+
+} // namespace Common
+} // namespace Sanguosha
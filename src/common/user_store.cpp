@@ -0,0 +1,305 @@
+#include "common/user_store.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <system_error>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Sanguosha {
+namespace Common {
+
+namespace {
+
+constexpr uint64_t STORE_MAGIC = 0x5352455355534753ULL; // "SGSUSERS"
+constexpr uint32_t STORE_VERSION = 1;
+
+// FNV-1a，低位用来定位槽位，完整值存一部分用于快速比较
+uint64_t hashName(const std::string& name) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (unsigned char c : name) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint32_t roundUpPowerOfTwo(uint32_t n) {
+    uint32_t capacity = 16;
+    while (capacity < n) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+[[noreturn]] void throwErrno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+} // namespace
+
+struct UserStore::Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t capacity; // 槽位数，2的幂
+    uint64_t count;
+    uint64_t nextId;   // 下一个可分配的ID，原子递增
+    char reserved[32];
+};
+
+struct UserStore::Slot {
+    uint64_t userId; // 0表示空槽
+    uint32_t hash;
+    uint8_t length;
+    char name[MAX_USERNAME_LENGTH];
+};
+
+size_t UserStore::fileBytes(uint32_t capacity) {
+    static_assert(sizeof(Header) == 64, "header must stay 64 bytes");
+    static_assert(sizeof(Slot) == 64, "slot must stay one cache line");
+    return sizeof(Header) + static_cast<size_t>(capacity) * sizeof(Slot);
+}
+
+UserStore::UserStore(const std::string& path, uint32_t initialCapacity)
+    : path_(path) {
+    int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throwErrno("open " + path);
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throwErrno("stat " + path);
+    }
+
+    if (st.st_size == 0) {
+        // 新文件：写入空表
+        uint32_t capacity = roundUpPowerOfTwo(initialCapacity);
+        if (::ftruncate(fd, fileBytes(capacity)) != 0) {
+            ::close(fd);
+            throwErrno("truncate " + path);
+        }
+        mapFile(fd, fileBytes(capacity));
+        header_->magic = STORE_MAGIC;
+        header_->version = STORE_VERSION;
+        header_->capacity = capacity;
+        header_->count = 0;
+        header_->nextId = FIRST_USER_ID;
+        return;
+    }
+
+    if (static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        throw std::system_error(EINVAL, std::generic_category(), "corrupt user store " + path);
+    }
+    mapFile(fd, static_cast<size_t>(st.st_size));
+    if (header_->magic != STORE_MAGIC || header_->version != STORE_VERSION ||
+        fileBytes(header_->capacity) != mappedBytes_) {
+        unmapFile();
+        throw std::system_error(EINVAL, std::generic_category(), "corrupt user store " + path);
+    }
+}
+
+UserStore::~UserStore() {
+    unmapFile();
+}
+
+void UserStore::mapFile(int fd, size_t bytes) {
+    void* base = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        ::close(fd);
+        throwErrno("mmap " + path_);
+    }
+    fd_ = fd;
+    base_ = base;
+    mappedBytes_ = bytes;
+    header_ = static_cast<Header*>(base);
+}
+
+void UserStore::unmapFile() {
+    if (base_) {
+        ::msync(base_, mappedBytes_, MS_ASYNC);
+        ::munmap(base_, mappedBytes_);
+        base_ = nullptr;
+        header_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+UserStore::Slot* UserStore::slots() const {
+    return reinterpret_cast<Slot*>(static_cast<char*>(base_) + sizeof(Header));
+}
+
+const UserStore::Slot* UserStore::lookup(const std::string& username, uint64_t hash) const {
+    uint32_t mask = header_->capacity - 1;
+    uint32_t shortHash = static_cast<uint32_t>(hash >> 32);
+    const Slot* table = slots();
+    for (uint32_t i = static_cast<uint32_t>(hash) & mask;; i = (i + 1) & mask) {
+        const Slot& slot = table[i];
+        if (slot.userId == INVALID_USER) {
+            return nullptr; // 线性探测遇到空槽即不存在
+        }
+        if (slot.hash == shortHash && slot.length == username.size() &&
+            std::memcmp(slot.name, username.data(), username.size()) == 0) {
+            return &slot;
+        }
+    }
+}
+
+void UserStore::insert(const std::string& username, uint64_t hash, UserId id) {
+    uint32_t mask = header_->capacity - 1;
+    Slot* table = slots();
+    uint32_t i = static_cast<uint32_t>(hash) & mask;
+    while (table[i].userId != INVALID_USER) {
+        i = (i + 1) & mask;
+    }
+    Slot& slot = table[i];
+    slot.hash = static_cast<uint32_t>(hash >> 32);
+    slot.length = static_cast<uint8_t>(username.size());
+    std::memcpy(slot.name, username.data(), username.size());
+    slot.userId = id; // 最后写ID，槽位才算占用
+    ++header_->count;
+}
+
+void UserStore::grow() {
+    // 写到临时文件后rename替换，扩容中途崩溃不会破坏原文件
+    uint32_t newCapacity = header_->capacity * 2;
+    std::string tmpPath = path_ + ".tmp";
+    int fd = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throwErrno("open " + tmpPath);
+    }
+    if (::ftruncate(fd, fileBytes(newCapacity)) != 0) {
+        ::close(fd);
+        throwErrno("truncate " + tmpPath);
+    }
+
+    int oldFd = fd_;
+    void* oldBase = base_;
+    size_t oldBytes = mappedBytes_;
+    Header oldHeader = *header_;
+    const Slot* oldSlots = slots();
+
+    mapFile(fd, fileBytes(newCapacity));
+    *header_ = oldHeader;
+    header_->capacity = newCapacity;
+    header_->count = 0;
+    for (uint32_t i = 0; i < oldHeader.capacity; ++i) {
+        const Slot& slot = oldSlots[i];
+        if (slot.userId != INVALID_USER) {
+            insert(std::string(slot.name, slot.length), hashName(std::string(slot.name, slot.length)), slot.userId);
+        }
+    }
+    ::msync(base_, mappedBytes_, MS_SYNC);
+
+    if (::rename(tmpPath.c_str(), path_.c_str()) != 0) {
+        int err = errno;
+        // 回退到旧表，新文件丢弃
+        ::munmap(base_, mappedBytes_);
+        ::close(fd_);
+        ::unlink(tmpPath.c_str());
+        fd_ = oldFd;
+        base_ = oldBase;
+        mappedBytes_ = oldBytes;
+        header_ = static_cast<Header*>(oldBase);
+        throw std::system_error(err, std::generic_category(), "rename " + tmpPath);
+    }
+    ::munmap(oldBase, oldBytes);
+    ::close(oldFd);
+}
+
+UserStore::UserId UserStore::cacheGet(const std::string& username, uint64_t hash) {
+    auto& shard = shardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.entries.find(username);
+    return it != shard.entries.end() ? it->second : INVALID_USER;
+}
+
+void UserStore::cachePut(const std::string& username, uint64_t hash, UserId id) {
+    auto& shard = shardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.entries.size() >= MAX_CACHE_ENTRIES_PER_SHARD) {
+        shard.entries.clear(); // 缓存只是加速，超出上限直接清空，未命中时回表查询
+    }
+    shard.entries.emplace(username, id);
+}
+
+UserStore::UserId UserStore::find(const std::string& username) {
+    if (username.empty() || username.size() > MAX_USERNAME_LENGTH) {
+        return INVALID_USER;
+    }
+    uint64_t hash = hashName(username);
+    if (UserId id = cacheGet(username, hash)) {
+        return id;
+    }
+
+    UserId id = INVALID_USER;
+    {
+        std::shared_lock<std::shared_mutex> lock(tableMutex_);
+        if (const Slot* slot = lookup(username, hash)) {
+            id = slot->userId;
+        }
+    }
+    if (id != INVALID_USER) {
+        cachePut(username, hash, id);
+    }
+    return id;
+}
+
+UserStore::UserId UserStore::findOrCreate(const std::string& username) {
+    if (UserId id = find(username)) {
+        return id;
+    }
+    if (username.empty() || username.size() > MAX_USERNAME_LENGTH) {
+        return INVALID_USER;
+    }
+
+    uint64_t hash = hashName(username);
+    UserId id;
+    {
+        std::unique_lock<std::shared_mutex> lock(tableMutex_);
+        // 双重检查：可能已被其他线程注册
+        if (const Slot* slot = lookup(username, hash)) {
+            id = slot->userId;
+        } else {
+            if ((header_->count + 1) * 10 > static_cast<uint64_t>(header_->capacity) * 7) {
+                grow();
+            }
+            id = __atomic_fetch_add(&header_->nextId, 1, __ATOMIC_RELAXED);
+            insert(username, hash, id);
+        }
+    }
+    cachePut(username, hash, id);
+    return id;
+}
+
+UserStore::UserId UserStore::allocateId() {
+    // 共享锁只是防止扩容时重新映射，分配本身是无锁的原子递增
+    std::shared_lock<std::shared_mutex> lock(tableMutex_);
+    return __atomic_fetch_add(&header_->nextId, 1, __ATOMIC_RELAXED);
+}
+
+uint64_t UserStore::size() const {
+    std::shared_lock<std::shared_mutex> lock(tableMutex_);
+    return header_->count;
+}
+
+uint32_t UserStore::capacity() const {
+    std::shared_lock<std::shared_mutex> lock(tableMutex_);
+    return header_->capacity;
+}
+
+void UserStore::flush() {
+    std::shared_lock<std::shared_mutex> lock(tableMutex_);
+    ::msync(base_, mappedBytes_, MS_SYNC);
+}
+
+} // namespace Common
+} // namespace Sanguosha
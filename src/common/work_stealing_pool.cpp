@@ -0,0 +1,110 @@
+#include "common/work_stealing_pool.h"
+#include "common/cpu_topology.h"
+
+namespace Sanguosha {
+namespace Common {
+
+namespace {
+// 当前线程所属的线程池及队列下标，用于把子任务放回本线程队列
+thread_local const WorkStealingPool* currentPool = nullptr;
+thread_local size_t currentIndex = 0;
+} // namespace
+
+WorkStealingPool::WorkStealingPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = 1;
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads_.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_all();
+    for (auto& thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void WorkStealingPool::submit(Task task) {
+    size_t index = currentPool == this ? currentIndex
+                                       : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+    {
+        // 与工作线程的等待条件同步，避免丢失唤醒
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        pending_.fetch_add(1, std::memory_order_release);
+    }
+    wakeup_.notify_one();
+}
+
+void WorkStealingPool::pinThreads(const std::vector<int>& cpus) {
+    if (cpus.empty()) {
+        return;
+    }
+    for (size_t i = 0; i < threads_.size(); ++i) {
+        pinThread(threads_[i], cpus[i % cpus.size()]);
+    }
+}
+
+bool WorkStealingPool::popLocal(size_t index, Task& task) {
+    auto& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool WorkStealingPool::steal(size_t index, Task& task) {
+    for (size_t offset = 1; offset < queues_.size(); ++offset) {
+        auto& victim = *queues_[(index + offset) % queues_.size()];
+        std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+        if (!lock.owns_lock() || victim.tasks.empty()) {
+            continue;
+        }
+        task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    currentPool = this;
+    currentIndex = index;
+
+    while (true) {
+        Task task;
+        if (popLocal(index, task) || steal(index, task)) {
+            pending_.fetch_sub(1, std::memory_order_acq_rel);
+            task();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wakeup_.wait(lock, [this]() {
+            return stopping_ || pending_.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping_ && pending_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+} // namespace Common
+} // namespace Sanguosha
@@ -4,42 +4,112 @@
 #include <random>
 #include <algorithm>
 #include "network/server.h" // 添加server.h包含
+#include "game/mcts_bot.h"
 
 namespace sanguosha {
 
+namespace {
+
+const char* roleName(Role role) {
+    switch (role) {
+        case ROLE_LORD: return "主公";
+        case ROLE_LOYALIST: return "忠臣";
+        case ROLE_REBEL: return "反贼";
+        case ROLE_RENEGADE: return "内奸";
+        default: return "无";
+    }
+}
+
+} // namespace
+
 // 修改构造函数初始化列表 - 使用正确的前向声明
 GameInstance::GameInstance(uint32_t roomId, Sanguosha::Room::RoomManager& roomManager, Sanguosha::Network::Server& server)
-    : roomId_(roomId), roomManager_(roomManager), server_(server), currentPlayer_(0), gameOver_(false) {
+    : roomId_(roomId), roomManager_(roomManager), server_(server), currentSeat_(0), gameOver_(false), winnerId_(0) {
     // 初始化随机数生成器
     std::random_device rd;
     rng_.seed(rd());
 }
 
 void GameInstance::startGame(const std::vector<uint32_t>& playerIds) {
-    // 1. 初始化玩家状态
+    // 1. 按座位初始化玩家状态
+    seats_.clear();
+    aliveMask_.reset();
     for (auto playerId : playerIds) {
+        if (seats_.size() >= MAX_SEATS) {
+            break;
+        }
         PlayerState state;
         state.set_player_id(playerId);
         state.set_hp(4);
         state.set_max_hp(4);
-        playerStates_[playerId] = state;
+        aliveMask_.set(seats_.size());
+        seats_.push_back(state);
     }
     
-    // 2. 初始化牌堆
+    // 2. 分配身份（主公先手）
+    assignRoles();
+
+    // 3. 初始化牌堆
     initDeck();
     
-    // 3. 分发起始手牌
+    // 4. 分发起始手牌
     dealInitialCards();
     
-    // 4. 决定先手玩家
-    currentPlayer_ = playerIds[0];
-    
     // 5. 开始第一个回合
-    processTurn(currentPlayer_);
+    processTurn(currentSeat_);
+    maybeScheduleBot();
+}
+
+void GameInstance::assignRoles() {
+    roles_.fill(ROLE_NONE);
+    currentSeat_ = 0;
+    if (seats_.size() < 3) {
+        return; // 1v1没有身份，座位0先手
+    }
+
+    // 身份局配置：主公1名，其余按人数分配忠臣/反贼/内奸
+    static const uint32_t kLoyalists[MAX_SEATS + 1] = {0, 0, 0, 0, 1, 1, 1, 2, 2};
+    static const uint32_t kRebels[MAX_SEATS + 1] = {0, 0, 0, 1, 1, 2, 3, 3, 4};
+    size_t n = seats_.size();
+    std::vector<Role> roles;
+    roles.push_back(ROLE_LORD);
+    roles.insert(roles.end(), kLoyalists[n], ROLE_LOYALIST);
+    roles.insert(roles.end(), kRebels[n], ROLE_REBEL);
+    roles.push_back(ROLE_RENEGADE);
+    std::shuffle(roles.begin(), roles.end(), rng_);
+
+    for (size_t seat = 0; seat < n; ++seat) {
+        roles_[seat] = roles[seat];
+        if (roles[seat] == ROLE_LORD) {
+            // 主公多1点体力上限，并且先行动
+            seats_[seat].set_hp(5);
+            seats_[seat].set_max_hp(5);
+            currentSeat_ = seat;
+        }
+    }
+
+    // 每个玩家单独收到一次自己的身份
+    for (size_t seat = 0; seat < n; ++seat) {
+        sendRole(seat);
+    }
+}
+
+void GameInstance::sendRole(uint32_t seat) {
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE);
+    auto* gameState = message.mutable_game_state();
+    gameState->set_current_player(currentPlayerId());
+    gameState->set_phase(sanguosha::PHASE_UNKNOWN);
+    gameState->set_game_log(std::string("你的身份是") + roleName(roles_[seat]));
+    fillPlayerStates(gameState, static_cast<int>(seat));
+    if (auto session = server_.getSession(seats_[seat].player_id())) {
+        session->send(message);
+    }
 }
 
 void GameInstance::initDeck() {
     deck_.clear();
+    discardPile_.clear();
     
     // 简单卡牌配置：30张杀，15张闪，8张桃
     for (int i = 0; i < 30; i++) deck_.push_back(static_cast<uint32_t>(sanguosha::CARD_ATTACK));
@@ -52,48 +122,57 @@ void GameInstance::initDeck() {
 
 void GameInstance::dealInitialCards() {
     // 每个玩家发4张牌
-    for (const auto& pair : playerStates_) {
-        uint32_t playerId = pair.first;
-        auto& state = playerStates_[playerId];
-        for (int i = 0; i < 4 && !deck_.empty(); i++) {
-            uint32_t card = deck_.back();
-            deck_.pop_back();
+    for (auto& state : seats_) {
+        uint32_t card;
+        for (int i = 0; i < 4 && drawCard(card); i++) {
             state.add_hand_cards(card);
         }
     }
 }
 
+bool GameInstance::drawCard(uint32_t& card) {
+    if (deck_.empty()) {
+        // 牌堆摸完：弃牌堆洗匀后作为新牌堆，否则对局会在无牌可出时僵住
+        deck_.swap(discardPile_);
+        std::shuffle(deck_.begin(), deck_.end(), rng_);
+        if (deck_.empty()) {
+            return false;
+        }
+    }
+    card = deck_.back();
+    deck_.pop_back();
+    return true;
+}
+
 // 修改 processTurn 函数中的 broadcastGameState 调用
-void GameInstance::processTurn(uint32_t playerId) {
-    currentPlayer_ = playerId;
+void GameInstance::processTurn(uint32_t seat) {
+    currentSeat_ = seat;
     
     // 摸牌阶段：摸2张牌
     sanguosha::GameMessage drawMessage;
     drawMessage.set_type(sanguosha::GAME_STATE);
     auto* gameState = drawMessage.mutable_game_state();
-    gameState->set_current_player(currentPlayer_);
+    gameState->set_current_player(currentPlayerId());
     gameState->set_phase(sanguosha::DRAW_PHASE);
     
     // 给当前玩家发2张牌
-    auto& playerState = playerStates_[currentPlayer_];
-    for (int i = 0; i < 2 && !deck_.empty(); i++) {
-        uint32_t card = deck_.back();
-        deck_.pop_back();
+    auto& playerState = seats_[currentSeat_];
+    uint32_t card;
+    for (int i = 0; i < 2 && drawCard(card); i++) {
         playerState.add_hand_cards(card);
     }
     
     // 复制玩家状态到gameState
-    for (const auto& pair : playerStates_) {
-        PlayerState* ps = gameState->add_players();
-        ps->CopyFrom(pair.second);
-    }
+    fillPlayerStates(gameState);
     
     // 广播游戏状态 - 修复参数类型
     broadcastGameState(*gameState);
     
-    // 进入出牌阶段
+    // 进入出牌阶段，开始回合倒计时
+    scheduleTurnTimer();
     gameState->set_phase(sanguosha::PLAY_PHASE);
-    gameState->set_game_log("玩家 " + std::to_string(currentPlayer_) + " 的回合开始");
+    gameState->set_turn_timeout_ms(server_.config().turnTimeoutMs);
+    gameState->set_game_log("玩家 " + std::to_string(currentPlayerId()) + " 的回合开始");
     // 广播游戏状态 - 修复参数类型
     broadcastGameState(*gameState);
 }
@@ -102,8 +181,8 @@ void GameInstance::processTurn(uint32_t playerId) {
 bool GameInstance::processPlayerAction(uint32_t playerId, const GameAction& action) {
 
     // 检查玩家是否已死亡
-    auto playerIt = playerStates_.find(playerId);
-    if (playerIt == playerStates_.end() || playerIt->second.hp() <= 0) {
+    int seat = findSeat(playerId);
+    if (seat < 0 || !aliveMask_.test(seat)) {
         std::cerr << "Player " << playerId << " is dead or not found, ignoring action" << std::endl;
         return false;
     }
@@ -113,142 +192,226 @@ bool GameInstance::processPlayerAction(uint32_t playerId, const GameAction& acti
         std::cerr << "Game is over, ignoring action" << std::endl;
         return false;
     }
+    // 之后被拒绝的操作也可能改变状态（如连续超时计数清零），一律记录，回放时同样被拒绝
+    journal(RoomJournalRecord::GAME_ACTION, playerId, 0, &action);
+
+    // 响应窗口打开期间，只接受被提示玩家的响应
+    if (pending_.active) {
+        if (static_cast<uint32_t>(seat) != pending_.targetSeat || action.type() != sanguosha::ACTION_RESPOND) {
+            return false;
+        }
+        if (action.prompt_id() != 0 && action.prompt_id() != pending_.promptId) {
+            return false; // 过期的响应
+        }
+        consecutiveTimeouts_[seat] = 0;
+        bool responded = action.card_id() == static_cast<uint32_t>(pending_.cardType) &&
+                         removeHandCard(seats_[seat], pending_.cardType);
+        closeResponseWindow(responded);
+        maybeScheduleBot();
+        return true;
+    }
 
-    if (playerId != currentPlayer_) {
+    if (static_cast<uint32_t>(seat) != currentSeat_) {
         return false; // 不是当前回合玩家
     }
+    consecutiveTimeouts_[seat] = 0;
     
     switch (action.type()) {
         case sanguosha::ACTION_PLAY_CARD:
             // 处理出牌逻辑
     if (action.card_id() == sanguosha::CARD_ATTACK && action.target_player() != 0) {
-        // 从手牌中移除使用的牌
-        auto& playerState = playerStates_[playerId];
-        for (int i = 0; i < playerState.hand_cards_size(); i++) {
-            if (playerState.hand_cards(i) == action.card_id()) {
-                playerState.mutable_hand_cards()->erase(playerState.hand_cards().begin() + i);
-                break;
-            }
+        // 目标必须是其他存活玩家
+        int targetSeat = findSeat(action.target_player());
+        if (targetSeat < 0 || targetSeat == seat || !aliveMask_.test(targetSeat)) {
+            return false;
         }
-        
-        resolveAttack(playerId, action.target_player());
+
+        // 从手牌中移除使用的牌
+        auto& playerState = seats_[seat];
+        removeHandCard(playerState, action.card_id());
         
         // 修复：出牌后不结束回合，只更新状态
         sanguosha::GameMessage message;
         message.set_type(sanguosha::GAME_STATE);
         auto* gameState = message.mutable_game_state();
-        gameState->set_current_player(currentPlayer_);
+        gameState->set_current_player(currentPlayerId());
         gameState->set_phase(sanguosha::PLAY_PHASE);
-        gameState->set_game_log("玩家 " + std::to_string(playerId) + " 使用了杀");
+        gameState->set_game_log("玩家 " + std::to_string(playerId) + " 对玩家 " +
+                                std::to_string(action.target_player()) + " 使用了杀");
         
         // 复制玩家状态
-        for (const auto& pair : playerStates_) {
-            PlayerState* ps = gameState->add_players();
-            ps->CopyFrom(pair.second);
-        }
+        fillPlayerStates(gameState);
         
         broadcastGameState(*gameState);
+
+        // 结算杀：目标有闪时会先打开响应窗口
+        resolveAttack(seat, targetSeat);
     } else if (action.card_id() == sanguosha::CARD_HEAL) {
                 // 处理桃：给自己加血
-                auto& playerState = playerStates_[playerId];
+                auto& playerState = seats_[seat];
                 if (playerState.hp() < playerState.max_hp()) {
                     playerState.set_hp(playerState.hp() + 1);
                     
                     // 从手牌中移除使用的牌
-                    for (int i = 0; i < playerState.hand_cards_size(); i++) {
-                        if (playerState.hand_cards(i) == action.card_id()) {
-                            playerState.mutable_hand_cards()->erase(playerState.hand_cards().begin() + i);
-                            break;
-                        }
-                    }
+                    removeHandCard(playerState, action.card_id());
                     
                     // 广播加血信息
                     sanguosha::GameMessage message;
                     message.set_type(sanguosha::GAME_STATE);
                     auto* gameState = message.mutable_game_state();
-                    gameState->set_current_player(currentPlayer_);
+                    gameState->set_current_player(currentPlayerId());
                     gameState->set_phase(sanguosha::PLAY_PHASE);
                     gameState->set_game_log("玩家 " + std::to_string(playerId) + " 使用了桃，恢复1点体力");
                     
                     // 复制玩家状态
-                    for (const auto& pair : playerStates_) {
-                        PlayerState* ps = gameState->add_players();
-                        ps->CopyFrom(pair.second);
-                    }
+                    fillPlayerStates(gameState);
                     
                     // 修复参数类型
                     broadcastGameState(*gameState);
                 }
             }
             break;
+
+        case sanguosha::ACTION_RESPOND:
+            // 当前没有打开的响应窗口
+            return false;
             
         case sanguosha::ACTION_END_TURN:
-    // 结束回合，切换到下一个玩家
-    currentPlayer_ = getNextPlayer();
+            endTurn(seat, "玩家 " + std::to_string(playerId) + " 结束了回合");
+            break;
+    }
+    
+    maybeScheduleBot();
+    return true;
+}
+
+void GameInstance::endTurn(uint32_t seat, const std::string& log) {
+    // 结束回合，切换到下一个存活座位
+    currentSeat_ = nextAliveSeat(seat);
     
     // 发送回合结束通知
     sanguosha::GameMessage message;
     message.set_type(sanguosha::GAME_STATE);
     auto* gameState = message.mutable_game_state();
-    gameState->set_current_player(currentPlayer_);
+    gameState->set_current_player(currentPlayerId());
     gameState->set_phase(sanguosha::PLAY_PHASE);
-    gameState->set_game_log("玩家 " + std::to_string(playerId) + " 结束了回合");
+    gameState->set_game_log(log);
     
     // 复制玩家状态
-    for (const auto& pair : playerStates_) {
-        PlayerState* ps = gameState->add_players();
-        ps->CopyFrom(pair.second);
-    }
+    fillPlayerStates(gameState);
     
     broadcastGameState(*gameState);
     
     // 开始下一个玩家的回合
-    processTurn(currentPlayer_);
-    break;
-    }
-    
-    return true;
+    processTurn(currentSeat_);
 }
 
-void GameInstance::resolveAttack(uint32_t attacker, uint32_t target) {
-    auto& targetState = playerStates_[target];
-    
-    // 检查目标玩家是否有闪
-    bool hasDodge = false;
-    for (int i = 0; i < targetState.hand_cards_size(); i++) {
-        if (targetState.hand_cards(i) == sanguosha::CARD_DEFEND) {
-            hasDodge = true;
-            // 使用闪：从手牌中移除
-            targetState.mutable_hand_cards()->erase(targetState.hand_cards().begin() + i);
-            break;
+void GameInstance::scheduleTurnTimer() {
+    // 用回合序号识别过期的回调，不需要每局持有单独的定时器对象
+    ++turnSeq_;
+    armTurnTimer(turnTimeout());
+}
+
+std::chrono::milliseconds GameInstance::turnTimeout() const {
+    return std::chrono::milliseconds(server_.config().turnTimeoutMs);
+}
+
+std::chrono::milliseconds GameInstance::responseTimeout() const {
+    return std::chrono::milliseconds(server_.config().responseTimeoutMs);
+}
+
+void GameInstance::armTurnTimer(std::chrono::milliseconds delay) {
+    auto& wheel = server_.getTimerWheel();
+    wheel.cancel(turnTimer_);
+
+    uint64_t turnSeq = turnSeq_;
+    turnDeadline_ = std::chrono::steady_clock::now() + delay;
+    std::weak_ptr<GameInstance> weakSelf = weak_from_this();
+    turnTimer_ = wheel.schedule(delay, [weakSelf, turnSeq]() {
+        if (auto self = weakSelf.lock()) {
+            self->onTurnTimeout(turnSeq);
         }
+    });
+}
+
+void GameInstance::onTurnTimeout(uint64_t turnSeq) {
+    if (turnSeq != turnSeq_ || gameOver_) {
+        return;
+    }
+    turnTimer_ = Sanguosha::Common::TimerWheel::INVALID_TIMER;
+
+    // 响应窗口有自己的时限，等它结算后再给当前玩家一个完整的响应时长
+    if (pending_.active) {
+        armTurnTimer(responseTimeout());
+        return;
+    }
+    journal(RoomJournalRecord::TURN_TIMEOUT, 0, turnSeq);
+
+    uint32_t seat = currentSeat_;
+    uint32_t playerId = currentPlayerId();
+    uint32_t timeouts = ++consecutiveTimeouts_[seat];
+    std::cout << "Player " << playerId << " turn timed out in room " << roomId_
+              << " (" << timeouts << " in a row)" << std::endl;
+
+    if (timeouts >= MAX_CONSECUTIVE_TIMEOUTS) {
+        // 挂机判负，尽快结束游戏释放房间
+        forfeitSeat(seat, "玩家 " + std::to_string(playerId) + " 挂机判负");
+        maybeScheduleBot();
+        return;
+    }
+
+    autoDiscard(seat);
+    endTurn(seat, "玩家 " + std::to_string(playerId) + " 超时，自动结束回合");
+    maybeScheduleBot();
+}
+
+void GameInstance::autoDiscard(uint32_t seat) {
+    // 弃牌阶段规则：手牌数不能超过当前体力值，从最后摸到的牌开始弃
+    auto& state = seats_[seat];
+    while (state.hand_cards_size() > static_cast<int>(state.hp())) {
+        discardPile_.push_back(state.hand_cards(state.hand_cards_size() - 1));
+        state.mutable_hand_cards()->RemoveLast();
     }
+}
+
+void GameInstance::resolveAttack(uint32_t attackerSeat, uint32_t targetSeat) {
+    // 目标手里有闪时由目标自己决定是否打出；没有闪则无需等待，直接结算
+    if (hasHandCard(seats_[targetSeat], sanguosha::CARD_DEFEND)) {
+        openResponseWindow(attackerSeat, targetSeat, sanguosha::CARD_DEFEND);
+        return;
+    }
+    applyAttackResult(targetSeat, false);
+}
+
+void GameInstance::applyAttackResult(uint32_t targetSeat, bool dodged) {
+    auto& targetState = seats_[targetSeat];
+    uint32_t target = targetState.player_id();
     
-    if (!hasDodge) {
+    if (!dodged) {
         // 没有闪，扣血
         targetState.set_hp(targetState.hp() - 1);
         
         // 检查目标玩家是否死亡
         if (targetState.hp() <= 0) {
+            killSeat(targetSeat);
+
             // 玩家死亡，检查游戏是否结束
             if (checkGameOver()) {
                 handleGameOver();
                 return; // 游戏结束，不再继续处理
             }
             
-            // 添加死亡玩家状态更新
+            // 添加死亡玩家状态更新（阵亡后公开身份）
             sanguosha::GameMessage deathMessage;
             deathMessage.set_type(sanguosha::GAME_STATE);
             auto* deathState = deathMessage.mutable_game_state();
-            deathState->set_current_player(currentPlayer_);
+            deathState->set_current_player(currentPlayerId());
             deathState->set_phase(sanguosha::PLAY_PHASE);
-            deathState->set_game_log("玩家 " + std::to_string(target) + " 死亡");
+            deathState->set_game_log("玩家 " + std::to_string(target) + " 死亡，身份是" +
+                                     roleName(roles_[targetSeat]));
             
             // 复制玩家状态
-            for (const auto& pair : playerStates_) {
-                PlayerState* ps = deathState->add_players();
-                ps->CopyFrom(pair.second);
-            }
+            fillPlayerStates(deathState);
             
             broadcastGameState(*deathState);
         }
@@ -258,19 +421,16 @@ void GameInstance::resolveAttack(uint32_t attacker, uint32_t target) {
     sanguosha::GameMessage message;
     message.set_type(sanguosha::GAME_STATE);
     auto* gameState = message.mutable_game_state();
-    gameState->set_current_player(currentPlayer_);
+    gameState->set_current_player(currentPlayerId());
     gameState->set_phase(sanguosha::PLAY_PHASE);
-    if (hasDodge) {
+    if (dodged) {
         gameState->set_game_log("玩家 " + std::to_string(target) + " 使用了闪，抵消了杀");
     } else {
         gameState->set_game_log("玩家 " + std::to_string(target) + " 没有闪，受到1点伤害");
     }
     
     // 复制玩家状态
-    for (const auto& pair : playerStates_) {
-        PlayerState* ps = gameState->add_players();
-        ps->CopyFrom(pair.second);
-    }
+    fillPlayerStates(gameState);
     
     broadcastGameState(*gameState);
     
@@ -280,55 +440,361 @@ void GameInstance::resolveAttack(uint32_t attacker, uint32_t target) {
     }
 }
 
+void GameInstance::fillPlayerStates(GameState* gameState, int viewerSeat) const {
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        PlayerState* ps = gameState->add_players();
+        ps->CopyFrom(seats_[seat]);
+        ps->set_seat(seat);
+        // 身份只对主公公开；阵亡、游戏结束或查看自己时才显示
+        bool visible = roles_[seat] == ROLE_LORD || !aliveMask_.test(seat) || gameOver_ ||
+                       viewerSeat == static_cast<int>(seat);
+        ps->set_role(visible ? roles_[seat] : ROLE_NONE);
+    }
+}
+
 void GameInstance::broadcastGameState(const sanguosha::GameState& gameState) {
-    roomManager_.broadcastMessage(roomId_, sanguosha::GAME_STATE, gameState, server_);
+    roomManager_.broadcastMessage(roomId_, sanguosha::GAME_STATE, gameState);
+}
+
+void GameInstance::killSeat(uint32_t seat) {
+    aliveMask_.reset(seat);
+    // 阵亡玩家的手牌弃置
+    discardPile_.insert(discardPile_.end(), seats_[seat].hand_cards().begin(), seats_[seat].hand_cards().end());
+    seats_[seat].clear_hand_cards();
+}
+
+void GameInstance::forfeitSeat(uint32_t seat, const std::string& log) {
+    // 判负的玩家如果正被要求响应，先按不出闪结算
+    if (pending_.active && pending_.targetSeat == seat) {
+        closeResponseWindow(false);
+        if (gameOver_) {
+            return;
+        }
+    }
+    if (aliveMask_.test(seat)) {
+        seats_[seat].set_hp(0);
+        killSeat(seat);
+    }
+    if (checkGameOver()) {
+        handleGameOver();
+        return;
+    }
+    if (seat == currentSeat_ && !pending_.active) {
+        endTurn(seat, log);
+        return;
+    }
+
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE);
+    auto* gameState = message.mutable_game_state();
+    gameState->set_current_player(currentPlayerId());
+    gameState->set_phase(pending_.active ? sanguosha::RESPONSE_PHASE : sanguosha::PLAY_PHASE);
+    gameState->set_game_log(log);
+    fillPlayerStates(gameState);
+    broadcastGameState(*gameState);
 }
 
-uint32_t GameInstance::getNextPlayer() {
-    if (playerStates_.empty()) {
-        return 0; // 但理论上不会为空，添加保护
+void GameInstance::forfeitPlayer(uint32_t playerId) {
+    int seat = findSeat(playerId);
+    if (seat < 0 || gameOver_ || !aliveMask_.test(seat)) {
+        return;
     }
-    // 简单实现：按玩家ID顺序获取下一个玩家
-    auto it = playerStates_.find(currentPlayer_);
-    if (it != playerStates_.end()) {
-        auto nextIt = std::next(it);
-        if (nextIt != playerStates_.end()) {
-            return nextIt->first;
+    journal(RoomJournalRecord::FORFEIT, playerId, 0);
+    forfeitSeat(seat, "玩家 " + std::to_string(playerId) + " 断线判负");
+    maybeScheduleBot();
+}
+
+void GameInstance::onPlayerReconnected(uint32_t playerId) {
+    int seat = findSeat(playerId);
+    if (seat < 0 || gameOver_) {
+        return;
+    }
+    // 广播的关键帧里看不到自己的身份，单独补发
+    if (seats_.size() >= 3) {
+        sendRole(seat);
+    }
+    if (pending_.active && pending_.targetSeat == static_cast<uint32_t>(seat)) {
+        sendResponsePrompt();
+    }
+}
+
+int GameInstance::findSeat(uint32_t playerId) const {
+    // 最多8个座位，线性扫描比哈希查找更快
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        if (seats_[seat].player_id() == playerId) {
+            return static_cast<int>(seat);
         }
     }
-    return playerStates_.begin()->first; // 如果是最后一个玩家，回到第一个玩家
+    return -1;
+}
+
+uint32_t GameInstance::nextAliveSeat(uint32_t seat) const {
+    unsigned long alive = aliveMask_.to_ulong();
+    if (alive == 0) {
+        return seat; // 但理论上不会为空，添加保护
+    }
+    // 取座位号大于seat的存活座位，没有则绕回最小的存活座位
+    unsigned long after = alive & ~((2UL << seat) - 1);
+    return static_cast<uint32_t>(__builtin_ctzl(after ? after : alive));
 }
 
 bool GameInstance::checkGameOver() {
-    // 简单实现：检查是否有玩家生命值为0
-    for (const auto& pair : playerStates_) {
-        if (pair.second.hp() <= 0) {
+    winners_.clear();
+    winnerRole_ = ROLE_NONE;
+
+    // 1v1：只剩一名存活玩家时结束
+    if (seats_.size() < 3) {
+        if (aliveMask_.count() > 1) {
+            return false;
+        }
+        for (size_t seat = 0; seat < seats_.size(); ++seat) {
+            if (aliveMask_.test(seat)) {
+                winners_.push_back(seats_[seat].player_id());
+            }
+        }
+        return true;
+    }
+
+    // 身份局胜负判定
+    bool lordAlive = false;
+    size_t opponentsAlive = 0;
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        if (!aliveMask_.test(seat)) {
+            continue;
+        }
+        if (roles_[seat] == ROLE_LORD) {
+            lordAlive = true;
+        } else if (roles_[seat] == ROLE_REBEL || roles_[seat] == ROLE_RENEGADE) {
+            ++opponentsAlive;
+        }
+    }
+
+    if (lordAlive) {
+        if (opponentsAlive > 0) {
+            return false;
+        }
+        winnerRole_ = ROLE_LORD; // 主公和忠臣获胜
+    } else if (aliveMask_.count() == 1 && roles_[__builtin_ctzl(aliveMask_.to_ulong())] == ROLE_RENEGADE) {
+        winnerRole_ = ROLE_RENEGADE; // 内奸单挑获胜
+    } else {
+        winnerRole_ = ROLE_REBEL; // 主公阵亡，反贼获胜
+    }
+
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        Role role = roles_[seat];
+        bool won = winnerRole_ == ROLE_LORD ? (role == ROLE_LORD || role == ROLE_LOYALIST)
+                                            : role == winnerRole_;
+        if (won) {
+            winners_.push_back(seats_[seat].player_id());
+        }
+    }
+    return true;
+}
+
+void GameInstance::openResponseWindow(uint32_t sourceSeat, uint32_t targetSeat, CardType cardType) {
+    pending_.active = true;
+    pending_.promptId = nextPromptId_++;
+    pending_.sourceSeat = sourceSeat;
+    pending_.targetSeat = targetSeat;
+    pending_.cardType = cardType;
+    armResponseTimer(responseTimeout());
+
+    // 只向被提示的玩家发送响应请求
+    uint32_t target = seats_[targetSeat].player_id();
+    sendResponsePrompt();
+
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE);
+    auto* gameState = message.mutable_game_state();
+    gameState->set_current_player(currentPlayerId());
+    gameState->set_phase(sanguosha::RESPONSE_PHASE);
+    gameState->set_game_log("等待玩家 " + std::to_string(target) + " 响应");
+    fillPlayerStates(gameState);
+    broadcastGameState(*gameState);
+}
+
+void GameInstance::armResponseTimer(std::chrono::milliseconds delay) {
+    // 截止时间挂在共享时间轮上，游戏销毁后回调自动失效
+    auto& wheel = server_.getTimerWheel();
+    wheel.cancel(pending_.timer);
+    std::weak_ptr<GameInstance> weakSelf = weak_from_this();
+    uint32_t promptId = pending_.promptId;
+    pending_.timer = wheel.schedule(delay, [weakSelf, promptId]() {
+        if (auto self = weakSelf.lock()) {
+            self->onResponseTimeout(promptId);
+        }
+    });
+
+    pending_.deadline = std::chrono::steady_clock::now() + delay;
+}
+
+void GameInstance::sendResponsePrompt() {
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        pending_.deadline - std::chrono::steady_clock::now()).count();
+
+    sanguosha::GameMessage promptMessage;
+    promptMessage.set_type(sanguosha::RESPONSE_PROMPT);
+    auto* prompt = promptMessage.mutable_response_prompt();
+    prompt->set_prompt_id(pending_.promptId);
+    prompt->set_card_type(pending_.cardType);
+    prompt->set_source_player(seats_[pending_.sourceSeat].player_id());
+    prompt->set_timeout_ms(static_cast<uint32_t>(std::max<int64_t>(remaining, 0)));
+    if (auto session = server_.getSession(seats_[pending_.targetSeat].player_id())) {
+        session->send(promptMessage);
+    }
+}
+
+void GameInstance::closeResponseWindow(bool responded) {
+    server_.getTimerWheel().cancel(pending_.timer);
+    uint32_t targetSeat = pending_.targetSeat;
+    pending_ = PendingResponse{};
+
+    applyAttackResult(targetSeat, responded);
+    // 出杀的当前玩家在等待响应期间判负了（forfeitSeat那时不能切换回合），结算完轮到下一个存活座位
+    if (!gameOver_ && !aliveMask_.test(currentSeat_)) {
+        endTurn(currentSeat_, "玩家 " + std::to_string(currentPlayerId()) + " 已判负，轮到下一位玩家");
+    }
+}
+
+void GameInstance::onResponseTimeout(uint32_t promptId) {
+    if (!pending_.active || pending_.promptId != promptId || gameOver_) {
+        return; // 已经响应过了
+    }
+    journal(RoomJournalRecord::RESPONSE_TIMEOUT, 0, promptId);
+    std::cout << "Player " << seats_[pending_.targetSeat].player_id()
+              << " response timed out in room " << roomId_ << std::endl;
+    pending_.timer = Sanguosha::Common::TimerWheel::INVALID_TIMER;
+    closeResponseWindow(false);
+    maybeScheduleBot();
+}
+
+bool GameInstance::hasHandCard(const PlayerState& state, uint32_t card) const {
+    for (int i = 0; i < state.hand_cards_size(); i++) {
+        if (state.hand_cards(i) == card) {
             return true;
         }
     }
     return false;
 }
 
-void GameInstance::handleGameOver() {
-    // 确定胜利者
-    winnerId_ = 0;
-    for (const auto& pair : playerStates_) {
-        if (pair.second.hp() > 0) {
-            winnerId_ = pair.first;
-            break;
+bool GameInstance::removeHandCard(PlayerState& state, uint32_t card) {
+    for (int i = 0; i < state.hand_cards_size(); i++) {
+        if (state.hand_cards(i) == card) {
+            state.mutable_hand_cards()->erase(state.hand_cards().begin() + i);
+            discardPile_.push_back(card);
+            return true;
         }
     }
+    return false;
+}
+
+GameSimulator GameInstance::snapshotForBot() const {
+    GameSimulator sim;
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        GameSimulator::Seat simSeat;
+        simSeat.playerId = seats_[seat].player_id();
+        simSeat.hp = static_cast<uint8_t>(seats_[seat].hp());
+        simSeat.maxHp = static_cast<uint8_t>(seats_[seat].max_hp());
+        simSeat.role = roles_[seat];
+        for (uint32_t card : seats_[seat].hand_cards()) {
+            if (card <= CARD_HEAL) {
+                ++simSeat.cards[card];
+            }
+        }
+        sim.seats().push_back(simSeat);
+    }
+    for (uint32_t card : deck_) {
+        sim.deck().push_back(static_cast<uint8_t>(card));
+    }
+    for (uint32_t card : discardPile_) {
+        sim.discardPile().push_back(static_cast<uint8_t>(card));
+    }
+    sim.alive() = aliveMask_;
+    sim.setCurrentSeat(currentSeat_);
+    if (pending_.active) {
+        sim.setPendingResponse(pending_.sourceSeat, pending_.targetSeat);
+    }
+    return sim;
+}
+
+void GameInstance::maybeScheduleBot() {
+    uint64_t version = ++stateVersion_;
+    if (gameOver_ || seats_.empty() || replaying_) {
+        return;
+    }
+
+    uint32_t seat = pending_.active ? pending_.targetSeat : currentSeat_;
+    uint32_t botId = seats_[seat].player_id();
+    if (!isBotPlayer(botId)) {
+        return;
+    }
+
+    // 搜索在机器人线程池上进行，结果投递回io线程再执行，不阻塞事件循环。
+    // 搜索线程比Server活得久，经由IoGate投递，停机后的结果直接丢弃
+    std::weak_ptr<GameInstance> weakSelf = weak_from_this();
+    auto gate = server_.getIoGate();
+    BotPlanner::Instance().requestMove(snapshotForBot(), seat,
+        [weakSelf, gate, version, botId](SimAction action) {
+            gate->post([weakSelf, version, botId, action]() {
+                if (auto self = weakSelf.lock()) {
+                    self->onBotDecision(version, botId, action);
+                }
+            });
+        });
+}
+
+void GameInstance::onBotDecision(uint64_t version, uint32_t botId, const SimAction& action) {
+    if (version != stateVersion_ || gameOver_) {
+        return; // 搜索期间局面已经变化（例如超时）
+    }
+
+    GameAction gameAction;
+    gameAction.set_type(action.type);
+    gameAction.set_card_id(action.card);
+    if (action.type == ACTION_PLAY_CARD && action.card == CARD_ATTACK && action.targetSeat < seats_.size()) {
+        gameAction.set_target_player(seats_[action.targetSeat].player_id());
+    }
+
+    if (!processPlayerAction(botId, gameAction)) {
+        // 兜底：不出 / 结束回合，保证机器人不会卡住对局
+        GameAction fallback;
+        fallback.set_type(pending_.active ? ACTION_RESPOND : ACTION_END_TURN);
+        processPlayerAction(botId, fallback);
+    }
+}
+
+void GameInstance::handleGameOver() {
+    if (pending_.active) {
+        server_.getTimerWheel().cancel(pending_.timer);
+        pending_ = PendingResponse{};
+    }
+    server_.getTimerWheel().cancel(turnTimer_);
+    turnTimer_ = Sanguosha::Common::TimerWheel::INVALID_TIMER;
+
+    // 确定胜利者（checkGameOver已经计算出获胜阵营）
+    winnerId_ = winners_.empty() ? 0 : winners_.front();
     
     // 发送游戏结束消息
     sanguosha::GameMessage message;
     message.set_type(sanguosha::GAME_OVER);
     auto* gameOver = message.mutable_game_over();
     gameOver->set_winner_id(winnerId_);
+    for (uint32_t winner : winners_) {
+        gameOver->add_winner_ids(winner);
+    }
+    gameOver->set_winner_role(winnerRole_);
     
     // 广播游戏结束
-    roomManager_.broadcastMessage(roomId_, sanguosha::GAME_OVER, *gameOver, server_);
+    roomManager_.broadcastMessage(roomId_, sanguosha::GAME_OVER, *gameOver);
     
     gameOver_ = true;
+
+    // 游戏结束后释放房间；投递到io线程执行，避免在自身调用栈中析构GameInstance
+    auto& roomManager = roomManager_;
+    uint32_t roomId = roomId_;
+    boost::asio::post(server_.getIoContext(), [&roomManager, roomId]() {
+        roomManager.closeRoom(roomId);
+    });
 }
 
 bool GameInstance::isGameOver() const {
@@ -336,15 +802,155 @@ bool GameInstance::isGameOver() const {
 }
 
 uint32_t GameInstance::getWinner() const {
-    // 这里需要实现获取胜利者的逻辑
-    // 假设我们在handleGameOver中已经确定了胜利者
-    // 你可能需要在类中添加一个winnerId_成员变量来存储胜利者ID
-    for (const auto& pair : playerStates_) {
-        if (pair.second.hp() > 0) {
-            return pair.first; // 返回第一个存活的玩家作为胜利者
+    return winnerId_;
+}
+
+void GameInstance::journal(RoomJournalRecord::Kind kind, uint32_t playerId, uint64_t sequence,
+                           const GameAction* action) {
+    if (replaying_ || !roomManager_.journalEnabled()) {
+        return;
+    }
+    RoomJournalRecord record;
+    record.set_kind(kind);
+    record.set_room_id(roomId_);
+    record.set_player_id(playerId);
+    record.set_sequence(sequence);
+    if (action != nullptr) {
+        *record.mutable_action() = *action;
+    }
+    roomManager_.journalGameEvent(record);
+}
+
+void GameInstance::saveSnapshot(GameSnapshot* snapshot) const {
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        PlayerState* state = snapshot->add_seats();
+        state->CopyFrom(seats_[seat]);
+        state->set_role(roles_[seat]);
+    }
+    snapshot->set_alive_mask(static_cast<uint32_t>(aliveMask_.to_ulong()));
+    snapshot->set_current_seat(currentSeat_);
+    snapshot->mutable_deck()->Add(deck_.begin(), deck_.end());
+    snapshot->mutable_discard_pile()->Add(discardPile_.begin(), discardPile_.end());
+
+    snapshot->set_rng_seed(rng_.seedValue);
+    snapshot->set_rng_draws(rng_.draws);
+
+    snapshot->set_turn_seq(turnSeq_);
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        snapshot->add_consecutive_timeouts(consecutiveTimeouts_[seat]);
+    }
+    snapshot->set_next_prompt_id(nextPromptId_);
+    if (pending_.active) {
+        snapshot->set_pending_prompt_id(pending_.promptId);
+        snapshot->set_pending_source_seat(pending_.sourceSeat);
+        snapshot->set_pending_target_seat(pending_.targetSeat);
+        snapshot->set_pending_card_type(pending_.cardType);
+    }
+}
+
+void GameInstance::restoreSnapshot(const GameSnapshot& snapshot) {
+    seats_.clear();
+    roles_.fill(ROLE_NONE);
+    for (const auto& saved : snapshot.seats()) {
+        if (seats_.size() >= MAX_SEATS) {
+            break;
         }
+        roles_[seats_.size()] = saved.role();
+        PlayerState state = saved;
+        state.clear_role();
+        seats_.push_back(std::move(state));
+    }
+    aliveMask_ = std::bitset<MAX_SEATS>(snapshot.alive_mask());
+    currentSeat_ = snapshot.current_seat() < seats_.size() ? snapshot.current_seat() : 0;
+    deck_.assign(snapshot.deck().begin(), snapshot.deck().end());
+    discardPile_.assign(snapshot.discard_pile().begin(), snapshot.discard_pile().end());
+    rng_.seed(snapshot.rng_seed(), snapshot.rng_draws());
+
+    turnSeq_ = snapshot.turn_seq();
+    consecutiveTimeouts_.fill(0);
+    for (int seat = 0; seat < snapshot.consecutive_timeouts_size() && seat < static_cast<int>(MAX_SEATS); ++seat) {
+        consecutiveTimeouts_[seat] = snapshot.consecutive_timeouts(seat);
+    }
+    nextPromptId_ = snapshot.next_prompt_id();
+    pending_ = PendingResponse{};
+    if (snapshot.pending_prompt_id() != 0 && snapshot.pending_source_seat() < seats_.size() &&
+        snapshot.pending_target_seat() < seats_.size()) {
+        pending_.active = true;
+        pending_.promptId = snapshot.pending_prompt_id();
+        pending_.sourceSeat = snapshot.pending_source_seat();
+        pending_.targetSeat = snapshot.pending_target_seat();
+        pending_.cardType = snapshot.pending_card_type();
+    }
+    gameOver_ = seats_.empty();
+}
+
+void GameInstance::replay(const RoomJournalRecord& record) {
+    replaying_ = true;
+    switch (record.kind()) {
+        case RoomJournalRecord::GAME_ACTION:
+            processPlayerAction(record.player_id(), record.action());
+            break;
+        case RoomJournalRecord::TURN_TIMEOUT:
+            onTurnTimeout(record.sequence());
+            break;
+        case RoomJournalRecord::RESPONSE_TIMEOUT:
+            onResponseTimeout(static_cast<uint32_t>(record.sequence()));
+            break;
+        case RoomJournalRecord::FORFEIT:
+            forfeitPlayer(record.player_id());
+            break;
+        default:
+            break;
+    }
+    replaying_ = false;
+}
+
+void GameInstance::resumeAfterRestore() {
+    if (gameOver_) {
+        return;
+    }
+    // 停机期间不计时：恢复后给当前玩家一个完整的回合时长，挂起的响应也重新计时
+    armTurnTimer(turnTimeout());
+    if (pending_.active) {
+        armResponseTimer(responseTimeout());
+    }
+
+    sanguosha::GameMessage message;
+    message.set_type(sanguosha::GAME_STATE);
+    auto* gameState = message.mutable_game_state();
+    gameState->set_current_player(currentPlayerId());
+    gameState->set_phase(pending_.active ? sanguosha::RESPONSE_PHASE : sanguosha::PLAY_PHASE);
+    gameState->set_turn_timeout_ms(server_.config().turnTimeoutMs);
+    gameState->set_game_log("服务器重启，对局已恢复");
+    fillPlayerStates(gameState);
+    broadcastGameState(*gameState);
+
+    maybeScheduleBot();
+}
+
+bool GameInstance::awaitingDisconnectedPlayer() const {
+    if (gameOver_ || seats_.empty()) {
+        return false;
+    }
+    uint32_t playerId = seats_[pending_.active ? pending_.targetSeat : currentSeat_].player_id();
+    return !isBotPlayer(playerId) && !server_.getSession(playerId);
+}
+
+void GameInstance::resumeTimers(std::chrono::steady_clock::time_point turnDeadline,
+                                std::chrono::steady_clock::time_point responseDeadline) {
+    if (gameOver_) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    auto remaining = [now](std::chrono::steady_clock::time_point deadline) {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::max(deadline - now, std::chrono::steady_clock::duration::zero()));
+    };
+    // 休眠期间已经到期的截止时间在下一个刻度触发
+    armTurnTimer(remaining(turnDeadline));
+    if (pending_.active) {
+        armResponseTimer(remaining(responseDeadline));
     }
-    return 0; // 如果没有存活的玩家，返回0
 }
 
-} // namespace sanguosha
\ No newline at end of file
+} // namespace sanguosha
@@ -0,0 +1,229 @@
+#include "game/game_simulator.h"
+#include <algorithm>
+
+namespace sanguosha {
+
+void GameSimulator::setPendingResponse(uint32_t sourceSeat, uint32_t targetSeat) {
+    pendingActive_ = true;
+    pendingSource_ = sourceSeat;
+    pendingTarget_ = targetSeat;
+}
+
+std::vector<SimAction> GameSimulator::legalActions() const {
+    std::vector<SimAction> actions;
+    if (terminal_) {
+        return actions;
+    }
+
+    if (pendingActive_) {
+        // 响应窗口：出闪或不出
+        const auto& target = seats_[pendingTarget_];
+        if (target.cards[CARD_DEFEND] > 0) {
+            actions.push_back({ACTION_RESPOND, CARD_DEFEND, 0});
+        }
+        actions.push_back({ACTION_RESPOND, CARD_UNKNOWN, 0});
+        return actions;
+    }
+
+    const auto& self = seats_[currentSeat_];
+    if (self.cards[CARD_ATTACK] > 0) {
+        for (size_t seat = 0; seat < seats_.size(); ++seat) {
+            if (seat != currentSeat_ && alive_.test(seat)) {
+                actions.push_back({ACTION_PLAY_CARD, CARD_ATTACK, static_cast<uint8_t>(seat)});
+            }
+        }
+    }
+    if (self.cards[CARD_HEAL] > 0 && self.hp < self.maxHp) {
+        actions.push_back({ACTION_PLAY_CARD, CARD_HEAL, 0});
+    }
+    actions.push_back({ACTION_END_TURN, CARD_UNKNOWN, 0});
+    return actions;
+}
+
+void GameSimulator::apply(const SimAction& action) {
+    if (terminal_) {
+        return;
+    }
+
+    switch (action.type) {
+        case ACTION_RESPOND: {
+            auto& target = seats_[pendingTarget_];
+            bool dodged = action.card == CARD_DEFEND && target.cards[CARD_DEFEND] > 0;
+            uint32_t targetSeat = pendingTarget_;
+            pendingActive_ = false;
+            if (dodged) {
+                --target.cards[CARD_DEFEND];
+                discardPile_.push_back(CARD_DEFEND);
+            } else {
+                damage(targetSeat);
+            }
+            break;
+        }
+        case ACTION_PLAY_CARD: {
+            auto& self = seats_[currentSeat_];
+            if (action.card == CARD_ATTACK && self.cards[CARD_ATTACK] > 0) {
+                --self.cards[CARD_ATTACK];
+                discardPile_.push_back(CARD_ATTACK);
+                // 与GameInstance一致：目标有闪才需要等待响应
+                if (seats_[action.targetSeat].cards[CARD_DEFEND] > 0) {
+                    setPendingResponse(currentSeat_, action.targetSeat);
+                } else {
+                    damage(action.targetSeat);
+                }
+            } else if (action.card == CARD_HEAL && self.cards[CARD_HEAL] > 0 && self.hp < self.maxHp) {
+                --self.cards[CARD_HEAL];
+                discardPile_.push_back(CARD_HEAL);
+                ++self.hp;
+            }
+            break;
+        }
+        case ACTION_END_TURN:
+            nextTurn();
+            break;
+        default:
+            break;
+    }
+}
+
+void GameSimulator::damage(uint32_t seat) {
+    auto& state = seats_[seat];
+    if (state.hp > 0) {
+        --state.hp;
+    }
+    if (state.hp == 0) {
+        alive_.reset(seat);
+        for (uint8_t card = CARD_ATTACK; card <= CARD_HEAL; ++card) {
+            discardPile_.insert(discardPile_.end(), state.cards[card], card);
+        }
+        state.cards.fill(0);
+        updateTerminal();
+    }
+}
+
+void GameSimulator::drawCards(uint32_t seat, int count) {
+    for (int i = 0; i < count; ++i) {
+        if (deck_.empty()) {
+            // 与GameInstance一致地回收弃牌堆；推演中不再洗牌，保持apply是确定性的
+            deck_.swap(discardPile_);
+            if (deck_.empty()) {
+                return;
+            }
+        }
+        ++seats_[seat].cards[deck_.back()];
+        deck_.pop_back();
+    }
+}
+
+void GameSimulator::nextTurn() {
+    unsigned long alive = alive_.to_ulong();
+    if (alive == 0) {
+        return;
+    }
+    unsigned long after = alive & ~((2UL << currentSeat_) - 1);
+    currentSeat_ = static_cast<uint32_t>(__builtin_ctzl(after ? after : alive));
+    drawCards(currentSeat_, 2);
+}
+
+void GameSimulator::updateTerminal() {
+    if (seats_.size() < 3) {
+        terminal_ = alive_.count() <= 1;
+        return;
+    }
+
+    bool lordAlive = false;
+    size_t opponentsAlive = 0;
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        if (!alive_.test(seat)) {
+            continue;
+        }
+        if (seats_[seat].role == ROLE_LORD) {
+            lordAlive = true;
+        } else if (seats_[seat].role == ROLE_REBEL || seats_[seat].role == ROLE_RENEGADE) {
+            ++opponentsAlive;
+        }
+    }
+
+    if (lordAlive) {
+        if (opponentsAlive > 0) {
+            return;
+        }
+        winnerRole_ = ROLE_LORD;
+    } else if (alive_.count() == 1 && seats_[__builtin_ctzl(alive_.to_ulong())].role == ROLE_RENEGADE) {
+        winnerRole_ = ROLE_RENEGADE;
+    } else {
+        winnerRole_ = ROLE_REBEL;
+    }
+    terminal_ = true;
+}
+
+bool GameSimulator::isWinner(uint32_t seat) const {
+    if (seats_.size() < 3) {
+        return alive_.test(seat);
+    }
+    Role role = seats_[seat].role;
+    if (winnerRole_ == ROLE_LORD) {
+        return role == ROLE_LORD || role == ROLE_LOYALIST;
+    }
+    return role == winnerRole_;
+}
+
+double GameSimulator::reward(uint32_t seat) const {
+    if (terminal_) {
+        return isWinner(seat) ? 1.0 : 0.0;
+    }
+    // 未分胜负：自己体力占全场存活体力的比例
+    double total = 0;
+    for (size_t i = 0; i < seats_.size(); ++i) {
+        if (alive_.test(i)) {
+            total += seats_[i].hp;
+        }
+    }
+    if (total <= 0 || !alive_.test(seat)) {
+        return 0.0;
+    }
+    return std::min(1.0, seats_[seat].hp * static_cast<double>(alive_.count()) / (2.0 * total));
+}
+
+void GameSimulator::determinize(uint32_t viewerSeat, std::mt19937& rng) {
+    // 收集看不到的牌（他人手牌 + 牌堆），洗匀后按原手牌数重新分配
+    std::vector<uint8_t> unseen(deck_.begin(), deck_.end());
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        if (seat == viewerSeat) {
+            continue;
+        }
+        for (uint8_t card = CARD_ATTACK; card <= CARD_HEAL; ++card) {
+            unseen.insert(unseen.end(), seats_[seat].cards[card], card);
+        }
+    }
+    std::shuffle(unseen.begin(), unseen.end(), rng);
+
+    auto it = unseen.begin();
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        if (seat == viewerSeat) {
+            continue;
+        }
+        uint32_t handSize = seats_[seat].handSize();
+        seats_[seat].cards.fill(0);
+        for (uint32_t i = 0; i < handSize; ++i) {
+            ++seats_[seat].cards[*it++];
+        }
+    }
+    deck_.assign(it, unseen.end());
+
+    // 身份同样是隐藏信息：存活的非主公身份在彼此之间重新打乱
+    std::vector<size_t> hiddenSeats;
+    std::vector<Role> hiddenRoles;
+    for (size_t seat = 0; seat < seats_.size(); ++seat) {
+        if (seat != viewerSeat && alive_.test(seat) && seats_[seat].role != ROLE_LORD &&
+            seats_[seat].role != ROLE_NONE) {
+            hiddenSeats.push_back(seat);
+            hiddenRoles.push_back(seats_[seat].role);
+        }
+    }
+    std::shuffle(hiddenRoles.begin(), hiddenRoles.end(), rng);
+    for (size_t i = 0; i < hiddenSeats.size(); ++i) {
+        seats_[hiddenSeats[i]].role = hiddenRoles[i];
+    }
+}
+
+} // namespace sanguosha
@@ -0,0 +1,270 @@
+#include "game/mcts_bot.h"
+#include "common/work_stealing_pool.h"
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <thread>
+
+namespace sanguosha {
+
+namespace {
+
+constexpr double kExploration = 1.4;
+constexpr int kMaxRolloutDepth = 120;
+
+// 推演策略：比纯随机更接近真人，推演结果更有区分度
+SimAction rolloutAction(const std::vector<SimAction>& actions, std::mt19937& rng) {
+    std::uniform_real_distribution<double> chance(0.0, 1.0);
+    std::vector<const SimAction*> attacks;
+    const SimAction* heal = nullptr;
+    for (const auto& action : actions) {
+        if (action.type == ACTION_RESPOND && action.card == CARD_DEFEND && chance(rng) < 0.9) {
+            return action;
+        }
+        if (action.type == ACTION_PLAY_CARD && action.card == CARD_ATTACK) {
+            attacks.push_back(&action);
+        } else if (action.type == ACTION_PLAY_CARD && action.card == CARD_HEAL) {
+            heal = &action;
+        }
+    }
+    if (heal) {
+        return *heal;
+    }
+    if (!attacks.empty() && chance(rng) < 0.7) {
+        return *attacks[std::uniform_int_distribution<size_t>(0, attacks.size() - 1)(rng)];
+    }
+    return actions.back(); // 结束回合 / 不出
+}
+
+} // namespace
+
+std::vector<MctsBot::ActionStats> MctsBot::search(const GameSimulator& root, uint32_t seat,
+                                                  std::chrono::steady_clock::time_point deadline,
+                                                  uint32_t seed) {
+    MctsSearch search(root, seat, seed);
+    search.run(UINT32_MAX, deadline);
+    return search.rootStats();
+}
+
+MctsSearch::MctsSearch(const GameSimulator& root, uint32_t seat, uint32_t seed)
+    : rng_(seed), base_(root) {
+    base_.determinize(seat, rng_);
+    nodes_.emplace_back();
+    nodes_[0].untried = base_.legalActions();
+}
+
+bool MctsSearch::run(uint32_t iterations, std::chrono::steady_clock::time_point deadline) {
+    for (uint32_t i = 0; i < iterations; ++i) {
+        // 每16次迭代（以及每段开始时）检查一次时间，至少完成一轮
+        if ((i == 0 || (iterations_ & 15) == 0) && iterations_ > 0 &&
+            std::chrono::steady_clock::now() >= deadline) {
+            return true;
+        }
+        iterate();
+        ++iterations_;
+    }
+    return std::chrono::steady_clock::now() >= deadline;
+}
+
+void MctsSearch::iterate() {
+    GameSimulator sim = base_;
+    int node = 0;
+
+    // 选择：所有操作都展开过后按UCT下降
+    while (nodes_[node].untried.empty() && !nodes_[node].children.empty()) {
+        double logVisits = std::log(static_cast<double>(nodes_[node].visits));
+        int best = -1;
+        double bestScore = -1;
+        for (int child : nodes_[node].children) {
+            const auto& c = nodes_[child];
+            double score = c.reward / c.visits + kExploration * std::sqrt(logVisits / c.visits);
+            if (score > bestScore) {
+                bestScore = score;
+                best = child;
+            }
+        }
+        sim.apply(nodes_[best].action);
+        node = best;
+    }
+
+    // 扩展：随机挑一个未尝试的操作
+    if (!nodes_[node].untried.empty() && !sim.isTerminal()) {
+        auto& untried = nodes_[node].untried;
+        size_t pick = std::uniform_int_distribution<size_t>(0, untried.size() - 1)(rng_);
+        SimAction action = untried[pick];
+        untried[pick] = untried.back();
+        untried.pop_back();
+
+        Node child;
+        child.action = action;
+        child.parent = node;
+        child.actor = sim.actingSeat();
+        sim.apply(action);
+        child.untried = sim.legalActions();
+        nodes_.push_back(std::move(child));
+        nodes_[node].children.push_back(static_cast<int>(nodes_.size() - 1));
+        node = static_cast<int>(nodes_.size() - 1);
+    }
+
+    // 推演
+    for (int depth = 0; depth < kMaxRolloutDepth && !sim.isTerminal(); ++depth) {
+        auto actions = sim.legalActions();
+        sim.apply(rolloutAction(actions, rng_));
+    }
+
+    // 回传
+    for (int n = node; n != -1; n = nodes_[n].parent) {
+        ++nodes_[n].visits;
+        if (n != 0) {
+            nodes_[n].reward += sim.reward(nodes_[n].actor);
+        }
+    }
+}
+
+std::vector<MctsBot::ActionStats> MctsSearch::rootStats() const {
+    std::vector<MctsBot::ActionStats> stats;
+    for (int child : nodes_[0].children) {
+        stats.push_back({nodes_[child].action, nodes_[child].visits, nodes_[child].reward});
+    }
+    return stats;
+}
+
+SimAction MctsBot::pickBest(const std::vector<std::vector<ActionStats>>& results) {
+    std::vector<ActionStats> merged;
+    for (const auto& result : results) {
+        for (const auto& stats : result) {
+            auto it = std::find_if(merged.begin(), merged.end(),
+                                   [&](const ActionStats& m) { return m.action == stats.action; });
+            if (it == merged.end()) {
+                merged.push_back(stats);
+            } else {
+                it->visits += stats.visits;
+                it->reward += stats.reward;
+            }
+        }
+    }
+
+    SimAction best; // 没有任何统计时默认结束回合
+    uint32_t bestVisits = 0;
+    for (const auto& stats : merged) {
+        if (stats.visits > bestVisits) {
+            bestVisits = stats.visits;
+            best = stats.action;
+        }
+    }
+    return best;
+}
+
+BotPlanner& BotPlanner::Instance() {
+    static BotPlanner instance;
+    return instance;
+}
+
+struct BotPlanner::Job {
+    std::mutex mutex;
+    std::vector<std::vector<MctsBot::ActionStats>> results;
+    size_t remaining = 0;
+    std::chrono::steady_clock::time_point deadline;
+    std::function<void(SimAction)> onDecision;
+};
+
+namespace {
+
+size_t defaultWorkerCount() {
+    // 只用一半核心，给事件循环线程留出余量
+    return std::max(1u, std::thread::hardware_concurrency() / 2);
+}
+
+} // namespace
+
+BotPlanner::BotPlanner()
+    : pool_(std::make_unique<Sanguosha::Common::WorkStealingPool>(defaultWorkerCount())) {
+}
+
+BotPlanner::~BotPlanner() = default;
+
+void BotPlanner::configureWorkers(size_t threads, const std::vector<int>& cpus) {
+    if (threads == 0) {
+        threads = cpus.empty() ? defaultWorkerCount() : cpus.size();
+    }
+    if (threads != pool_->size()) {
+        cancelAll();
+        pool_ = std::make_unique<Sanguosha::Common::WorkStealingPool>(threads);
+    }
+    pool_->pinThreads(cpus);
+}
+
+size_t BotPlanner::workerCount() const {
+    return pool_->size();
+}
+
+void BotPlanner::requestMove(const GameSimulator& state, uint32_t seat,
+                             std::function<void(SimAction)> onDecision) {
+    // 只有一个选择时不必搜索
+    auto actions = state.legalActions();
+    if (actions.size() <= 1) {
+        onDecision(actions.empty() ? SimAction{} : actions.front());
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->remaining = pool_->size();
+    job->deadline = std::chrono::steady_clock::now() + MOVE_BUDGET;
+    job->onDecision = std::move(onDecision);
+
+    uint64_t epoch;
+    {
+        std::lock_guard<std::mutex> lock(idleMutex_);
+        epoch = epoch_;
+    }
+    std::random_device rd;
+    for (size_t i = 0; i < pool_->size(); ++i) {
+        submitSlice(job, std::make_shared<MctsSearch>(state, seat, rd()), epoch);
+    }
+}
+
+void BotPlanner::submitSlice(std::shared_ptr<Job> job, std::shared_ptr<MctsSearch> search, uint64_t epoch) {
+    pool_->submit([this, job, search, epoch]() {
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            if (epoch != epoch_) {
+                return; // 提交之后被cancelAll取消了
+            }
+            ++running_;
+        }
+        if (!search->run(SLICE_ITERATIONS, job->deadline)) {
+            // 还没到截止时间：下一段放回本线程队列，别的线程空闲时可以偷走。
+            // 在running_计数期间提交，cancelAll返回后不会再有新的分段
+            submitSlice(job, search, epoch);
+        } else {
+            bool last = false;
+            {
+                std::lock_guard<std::mutex> lock(job->mutex);
+                job->results.push_back(search->rootStats());
+                last = --job->remaining == 0;
+            }
+            bool cancelled;
+            {
+                std::lock_guard<std::mutex> lock(idleMutex_);
+                cancelled = epoch != epoch_;
+            }
+            // 回调期间仍计入running_，cancelAll返回后不会再有回调
+            if (last && !cancelled) {
+                job->onDecision(MctsBot::pickBest(job->results));
+            }
+        }
+        {
+            std::lock_guard<std::mutex> lock(idleMutex_);
+            --running_;
+        }
+        idle_.notify_all();
+    });
+}
+
+void BotPlanner::cancelAll() {
+    std::unique_lock<std::mutex> lock(idleMutex_);
+    ++epoch_;
+    idle_.wait(lock, [this]() { return running_ == 0; });
+}
+
+} // namespace sanguosha
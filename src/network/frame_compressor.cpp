@@ -0,0 +1,158 @@
+#include "network/frame_compressor.h"
+#include "network/message_codec.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace Sanguosha {
+namespace Network {
+
+namespace {
+
+// raw deflate，不带zlib头和校验，帧边界由我们自己的长度头表示
+constexpr int WINDOW_BITS = -15;
+constexpr int MEM_LEVEL = 8;
+// Z_SYNC_FLUSH在每段数据末尾追加的空存储块
+constexpr char SYNC_TAIL[] = {0x00, 0x00, static_cast<char>(0xFF), static_cast<char>(0xFF)};
+
+sanguosha::PlayerState* addPlayer(sanguosha::GameState& state, uint32_t id, uint32_t seat) {
+    auto* player = state.add_players();
+    player->set_player_id(id);
+    player->set_hp(4);
+    player->set_max_hp(4);
+    player->set_seat(seat);
+    for (uint32_t card : {sanguosha::CARD_ATTACK, sanguosha::CARD_DEFEND, sanguosha::CARD_ATTACK,
+                          sanguosha::CARD_HEAL}) {
+        player->add_hand_cards(card);
+    }
+    return player;
+}
+
+std::string buildDictionary() {
+    // deflate优先匹配离当前位置近的历史，最常见的内容放在字典末尾
+    std::string dict;
+
+    sanguosha::GameMessage list;
+    list.set_type(sanguosha::ROOM_LIST_RESPONSE);
+    for (uint32_t room = 1; room <= 8; ++room) {
+        auto* info = list.mutable_room_list_response()->add_rooms();
+        info->set_room_id(room);
+        info->set_max_players(room % 2 == 0 ? 8 : 2);
+        info->set_current_players(room % 3 + 1);
+        info->set_status(room % 2 == 0 ? sanguosha::PLAYING : sanguosha::WAITING);
+        for (uint32_t p = 0; p < info->current_players(); ++p) {
+            info->add_players(1000 + room * 8 + p);
+        }
+    }
+    dict += list.SerializeAsString();
+
+    for (const char* phrase : {"你的身份是主公", "你的身份是忠臣", "你的身份是反贼", "你的身份是内奸",
+                               " 死亡，身份是", " 使用了桃，恢复1点体力", " 使用了闪，抵消了杀",
+                               " 没有闪，受到1点伤害", " 超时，自动结束回合", "等待玩家 ",
+                               " 结束了回合", " 的回合开始", "玩家 "}) {
+        dict += phrase;
+    }
+
+    for (uint32_t players : {2u, 5u, 8u}) {
+        sanguosha::GameMessage msg;
+        msg.set_type(sanguosha::GAME_STATE);
+        auto& state = *msg.mutable_game_state();
+        state.set_current_player(1000);
+        state.set_phase(sanguosha::PLAY_PHASE);
+        state.set_turn_timeout_ms(30000);
+        for (uint32_t seat = 0; seat < players; ++seat) {
+            addPlayer(state, 1000 + seat, seat);
+        }
+        state.set_game_log("玩家 1000 的回合开始");
+        dict += msg.SerializeAsString();
+    }
+    return dict;
+}
+
+} // namespace
+
+const std::string& FrameCompressor::dictionary() {
+    static const std::string dict = buildDictionary();
+    return dict;
+}
+
+uint32_t FrameCompressor::dictionaryId() {
+    static const uint32_t id = static_cast<uint32_t>(
+        adler32(adler32(0, nullptr, 0), reinterpret_cast<const Bytef*>(dictionary().data()),
+                static_cast<uInt>(dictionary().size())));
+    return id;
+}
+
+FrameCompressor::FrameCompressor(int level) {
+    if (deflateInit2(&stream_, level, Z_DEFLATED, WINDOW_BITS, MEM_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw std::runtime_error("deflateInit2 failed");
+    }
+    const auto& dict = dictionary();
+    deflateSetDictionary(&stream_, reinterpret_cast<const Bytef*>(dict.data()), static_cast<uInt>(dict.size()));
+}
+
+FrameCompressor::~FrameCompressor() {
+    deflateEnd(&stream_);
+}
+
+std::vector<char> FrameCompressor::compress(const std::vector<char>& frame) {
+    size_t inputSize = frame.size() - MessageCodec::HEADER_LENGTH;
+    size_t bound = deflateBound(&stream_, inputSize) + sizeof(SYNC_TAIL);
+    std::vector<char> out(MessageCodec::HEADER_LENGTH + 1 + bound);
+    out[MessageCodec::HEADER_LENGTH] = static_cast<char>(MessageCodec::COMPRESSED);
+
+    stream_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(frame.data() + MessageCodec::HEADER_LENGTH));
+    stream_.avail_in = static_cast<uInt>(inputSize);
+    stream_.next_out = reinterpret_cast<Bytef*>(out.data() + MessageCodec::HEADER_LENGTH + 1);
+    stream_.avail_out = static_cast<uInt>(bound);
+    if (deflate(&stream_, Z_SYNC_FLUSH) != Z_OK || stream_.avail_in != 0) {
+        throw std::runtime_error("deflate failed");
+    }
+
+    // 去掉同步刷新的固定结尾，接收方解压前补回
+    size_t compressed = bound - stream_.avail_out;
+    if (compressed >= sizeof(SYNC_TAIL)) {
+        compressed -= sizeof(SYNC_TAIL);
+    }
+    size_t bodySize = 1 + compressed;
+    out.resize(MessageCodec::HEADER_LENGTH + bodySize);
+    MessageCodec::writeHeader(out.data(), static_cast<uint32_t>(bodySize));
+    return out;
+}
+
+FrameDecompressor::FrameDecompressor() {
+    if (inflateInit2(&stream_, WINDOW_BITS) != Z_OK) {
+        throw std::runtime_error("inflateInit2 failed");
+    }
+    const auto& dict = FrameCompressor::dictionary();
+    inflateSetDictionary(&stream_, reinterpret_cast<const Bytef*>(dict.data()), static_cast<uInt>(dict.size()));
+}
+
+FrameDecompressor::~FrameDecompressor() {
+    inflateEnd(&stream_);
+}
+
+bool FrameDecompressor::decompress(const char* body, size_t size, std::string& out) {
+    if (size == 0 || static_cast<uint8_t>(body[0]) != MessageCodec::COMPRESSED) {
+        return false;
+    }
+    std::string input(body + 1, size - 1);
+    input.append(SYNC_TAIL, sizeof(SYNC_TAIL));
+
+    out.clear();
+    stream_.next_in = reinterpret_cast<Bytef*>(&input[0]);
+    stream_.avail_in = static_cast<uInt>(input.size());
+    char chunk[4096];
+    do {
+        stream_.next_out = reinterpret_cast<Bytef*>(chunk);
+        stream_.avail_out = sizeof(chunk);
+        int ret = inflate(&stream_, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR) {
+            return false;
+        }
+        out.append(chunk, sizeof(chunk) - stream_.avail_out);
+    } while (stream_.avail_out == 0);
+    return stream_.avail_in == 0;
+}
+
+} // namespace Network
+} // namespace Sanguosha
@@ -0,0 +1,82 @@
+#include "network/handler_registry.h"
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace Sanguosha {
+namespace Network {
+
+void MessageStats::recordLatency(std::chrono::nanoseconds elapsed) {
+    uint64_t nanos = static_cast<uint64_t>(std::max<int64_t>(elapsed.count(), 0));
+    totalNanos.fetch_add(nanos, std::memory_order_relaxed);
+
+    uint64_t micros = nanos / 1000;
+    size_t bucket = micros == 0 ? 0 : 64 - __builtin_clzll(micros);
+    latency[std::min(bucket, LATENCY_BUCKETS - 1)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t MessageStats::percentileMicros(double p) const {
+    uint64_t total = 0;
+    for (const auto& bucket : latency) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+    uint64_t target = static_cast<uint64_t>(p * total);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < LATENCY_BUCKETS; ++i) {
+        seen += latency[i].load(std::memory_order_relaxed);
+        if (seen > target) {
+            return uint64_t(1) << i;
+        }
+    }
+    return uint64_t(1) << (LATENCY_BUCKETS - 1);
+}
+
+void MessageStatsTable::record(sanguosha::MessageType type, size_t bytes) {
+    auto& stats = at(type);
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void MessageStatsTable::recordError(sanguosha::MessageType type, size_t bytes) {
+    auto& stats = at(type);
+    stats.count.fetch_add(1, std::memory_order_relaxed);
+    stats.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    stats.errors.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::string MessageStatsTable::report() const {
+    std::vector<size_t> order;
+    for (size_t i = 0; i < TYPE_COUNT; ++i) {
+        if (stats_[i].count.load(std::memory_order_relaxed) > 0) {
+            order.push_back(i);
+        }
+    }
+    std::sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+        return stats_[a].totalNanos.load(std::memory_order_relaxed) >
+               stats_[b].totalNanos.load(std::memory_order_relaxed);
+    });
+
+    std::ostringstream oss;
+    oss << std::left << std::setw(20) << "type" << std::right
+        << std::setw(10) << "count" << std::setw(12) << "bytes" << std::setw(8) << "errors"
+        << std::setw(12) << "total_ms" << std::setw(10) << "p50_us" << std::setw(10) << "p99_us" << "\n";
+    for (size_t i : order) {
+        const auto& s = stats_[i];
+        oss << std::left << std::setw(20) << sanguosha::MessageType_Name(static_cast<sanguosha::MessageType>(i))
+            << std::right
+            << std::setw(10) << s.count.load(std::memory_order_relaxed)
+            << std::setw(12) << s.bytes.load(std::memory_order_relaxed)
+            << std::setw(8) << s.errors.load(std::memory_order_relaxed)
+            << std::setw(12) << s.totalNanos.load(std::memory_order_relaxed) / 1000000
+            << std::setw(10) << s.percentileMicros(0.5)
+            << std::setw(10) << s.percentileMicros(0.99) << "\n";
+    }
+    return oss.str();
+}
+
+} // namespace Network
+} // namespace Sanguosha
@@ -0,0 +1,236 @@
+#include "network/hot_restart.h"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace Sanguosha {
+namespace Network {
+
+namespace {
+
+constexpr uint32_t HANDOFF_MAGIC = 0x53475348; // "SGSH"
+constexpr uint32_t MAX_PAYLOAD = 4096;
+
+[[noreturn]] void throwErrno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+void setTimeouts(int fd) {
+    timeval timeout{HandoffChannel::IO_TIMEOUT_SEC, 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+} // namespace
+
+HandoffChannel::HandoffChannel(int fd) : fd_(fd) {
+    setTimeouts(fd_);
+}
+
+HandoffChannel::HandoffChannel(HandoffChannel&& other) noexcept : fd_(other.fd_) {
+    other.fd_ = -1;
+}
+
+HandoffChannel::~HandoffChannel() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+HandoffChannel HandoffChannel::connect(const std::string& path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(addr.sun_path)) {
+        throw std::runtime_error("handoff socket path too long: " + path);
+    }
+    std::memcpy(addr.sun_path, path.data(), path.size());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        throwErrno("socket");
+    }
+    HandoffChannel channel(fd);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        throwErrno("connect " + path);
+    }
+    channel.send(Kind::REQUEST, 0, 0, std::string(), -1);
+    return channel;
+}
+
+void HandoffChannel::awaitRequest() {
+    expect(Kind::REQUEST);
+}
+
+void HandoffChannel::sendAck() {
+    send(Kind::ACK, 0, 0, std::string(), -1);
+}
+
+void HandoffChannel::awaitAck() {
+    expect(Kind::ACK);
+}
+
+void HandoffChannel::expect(Kind kind) {
+    Record record{};
+    std::string payload;
+    int fd = receive(record, payload);
+    if (fd >= 0) {
+        ::close(fd);
+    }
+    if (record.kind != kind) {
+        throw std::runtime_error("unexpected handoff record");
+    }
+}
+
+void HandoffChannel::sendListener(int fd) {
+    send(Kind::LISTENER, 0, 0, std::string(), fd);
+}
+
+void HandoffChannel::sendSession(const HandoffSession& session) {
+    send(Kind::SESSION, session.playerId, session.capabilities, session.resumeToken, session.fd);
+}
+
+void HandoffChannel::sendDone() {
+    send(Kind::DONE, 0, 0, std::string(), -1);
+}
+
+HandoffState HandoffChannel::receiveAll() {
+    HandoffState state;
+    try {
+        while (true) {
+            Record record{};
+            std::string payload;
+            int fd = receive(record, payload);
+            if (record.kind == Kind::DONE) {
+                break;
+            }
+            if (fd < 0 || (record.kind != Kind::LISTENER && record.kind != Kind::SESSION)) {
+                if (fd >= 0) {
+                    ::close(fd);
+                }
+                throw std::runtime_error("malformed handoff record");
+            }
+            if (record.kind == Kind::LISTENER) {
+                if (state.listenerFd >= 0) {
+                    ::close(state.listenerFd);
+                }
+                state.listenerFd = fd;
+            } else {
+                state.sessions.push_back({fd, record.playerId, record.capabilities, std::move(payload)});
+            }
+        }
+    } catch (...) {
+        // 交接失败时已经收到的描述符不能泄漏
+        if (state.listenerFd >= 0) {
+            ::close(state.listenerFd);
+        }
+        for (const auto& session : state.sessions) {
+            ::close(session.fd);
+        }
+        throw;
+    }
+    if (state.listenerFd < 0) {
+        for (const auto& session : state.sessions) {
+            ::close(session.fd);
+        }
+        throw std::runtime_error("handoff finished without a listening socket");
+    }
+    return state;
+}
+
+void HandoffChannel::send(Kind kind, uint32_t playerId, uint32_t capabilities, const std::string& payload, int fd) {
+    Record record{HANDOFF_MAGIC, kind, playerId, capabilities, static_cast<uint32_t>(payload.size())};
+    iovec iov[2] = {
+        {&record, sizeof(record)},
+        {const_cast<char*>(payload.data()), payload.size()},
+    };
+    msghdr msg{};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = payload.empty() ? 1 : 2;
+
+    // 描述符附在记录的第一个字节上，接收方读记录头时一起取到
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    if (fd >= 0) {
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+    }
+
+    size_t total = sizeof(record) + payload.size();
+    ssize_t sent = ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+    if (sent < 0) {
+        throwErrno("sendmsg");
+    }
+    // Unix流socket上这么小的消息不会被拆开，真出现时按错误处理，避免描述符和数据错位
+    if (static_cast<size_t>(sent) != total) {
+        throw std::runtime_error("short write on handoff socket");
+    }
+}
+
+int HandoffChannel::receive(Record& record, std::string& payload) {
+    iovec iov{&record, sizeof(record)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))];
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t received = ::recvmsg(fd_, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+    if (received < 0) {
+        throwErrno("recvmsg");
+    }
+    int fd = -1;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            std::memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+        }
+    }
+    bool valid = static_cast<size_t>(received) == sizeof(record) && record.magic == HANDOFF_MAGIC &&
+                 record.payloadSize <= MAX_PAYLOAD && (msg.msg_flags & MSG_CTRUNC) == 0;
+    if (!valid) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        throw std::runtime_error(received == 0 ? "handoff peer closed" : "malformed handoff record");
+    }
+
+    payload.resize(record.payloadSize);
+    try {
+        readExactly(&payload[0], payload.size());
+    } catch (...) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        throw;
+    }
+    return fd;
+}
+
+void HandoffChannel::readExactly(char* out, size_t size) {
+    while (size > 0) {
+        ssize_t n = ::recv(fd_, out, size, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            if (n == 0) {
+                throw std::runtime_error("handoff peer closed");
+            }
+            throwErrno("recv");
+        }
+        out += n;
+        size -= static_cast<size_t>(n);
+    }
+}
+
+} // namespace Network
+} // namespace Sanguosha
@@ -0,0 +1,83 @@
+#include "network/login_admission.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Sanguosha {
+namespace Network {
+
+LoginAdmission::LoginAdmission(Common::TimerWheel& wheel, double ratePerSecond, uint32_t burst, size_t queueLimit)
+    : wheel_(wheel),
+      bucket_(ratePerSecond, burst),
+      queueLimit_(queueLimit) {
+}
+
+LoginAdmission::Result LoginAdmission::submit(Task task, uint32_t& retryAfterMs) {
+    retryAfterMs = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 已有排队的请求时不能插队
+        if (!queue_.empty() || !bucket_.tryAcquire()) {
+            if (queue_.size() >= queueLimit_) {
+                retryAfterMs = estimateWaitLocked(queue_.size());
+                ++rejected_;
+                return Result::REJECTED;
+            }
+            queue_.push_back(std::move(task));
+            retryAfterMs = estimateWaitLocked(queue_.size());
+            scheduleDrainLocked();
+            return Result::QUEUED;
+        }
+    }
+    ++admitted_;
+    task();
+    return Result::ADMITTED;
+}
+
+size_t LoginAdmission::queued() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+uint32_t LoginAdmission::estimateWaitLocked(size_t position) {
+    // 按当前速率估算第position个请求被放行的时间
+    auto firstToken = bucket_.timeUntilAvailable();
+    if (bucket_.unlimited()) {
+        return 0;
+    }
+    double rest = position > 1 ? (position - 1) / bucket_.rate() * 1000.0 : 0.0;
+    return static_cast<uint32_t>(firstToken.count() + std::ceil(rest));
+}
+
+void LoginAdmission::scheduleDrainLocked() {
+    if (drainScheduled_) {
+        return;
+    }
+    drainScheduled_ = true;
+    auto delay = std::max(bucket_.timeUntilAvailable(), wheel_.tickInterval());
+    wheel_.schedule(delay, [this]() { drain(); });
+}
+
+void LoginAdmission::drain() {
+    std::vector<Task> ready;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        drainScheduled_ = false;
+        while (!queue_.empty() && bucket_.tryAcquire()) {
+            ready.push_back(std::move(queue_.front()));
+            queue_.pop_front();
+        }
+        if (!queue_.empty()) {
+            scheduleDrainLocked();
+        }
+    }
+
+    // 在锁外执行，登录处理可能很慢
+    admitted_ += ready.size();
+    for (auto& task : ready) {
+        task();
+    }
+}
+
+} // namespace Network
+} // namespace Sanguosha
@@ -2,36 +2,327 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <stdexcept>
 #include <arpa/inet.h>  // 用于htonl/ntohl
+#include <endian.h>
 
 using namespace Sanguosha::Network;
 
+namespace {
+
+bool readVarint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64 && p < end; shift += 7) {
+        uint8_t byte = *p++;
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr uint8_t WIRE_VARINT = 0;
+constexpr uint8_t WIRE_LENGTH_DELIMITED = 2;
+
+size_t varintSize(uint64_t value) {
+    size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+char* writeVarint(char* p, uint64_t value) {
+    while (value >= 0x80) {
+        *p++ = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    *p++ = static_cast<char>(value);
+    return p;
+}
+
+// 顶层字段：varint的值放在value；长度前缀的数据从data开始，长度为value
+struct WireField {
+    uint64_t number = 0;
+    uint8_t wireType = 0;
+    uint64_t value = 0;
+    const uint8_t* data = nullptr;
+};
+
+bool readField(const uint8_t*& p, const uint8_t* end, WireField& field) {
+    uint64_t key;
+    if (!readVarint(p, end, key)) {
+        return false;
+    }
+    field.number = key >> 3;
+    field.wireType = static_cast<uint8_t>(key & 0x7);
+    switch (field.wireType) {
+        case WIRE_VARINT:
+            return readVarint(p, end, field.value);
+        case 1: // 64位定长
+            if (end - p < 8) {
+                return false;
+            }
+            p += 8;
+            return true;
+        case WIRE_LENGTH_DELIMITED:
+            if (!readVarint(p, end, field.value) || field.value > static_cast<uint64_t>(end - p)) {
+                return false;
+            }
+            field.data = p;
+            p += field.value;
+            return true;
+        case 5: // 32位定长
+            if (end - p < 4) {
+                return false;
+            }
+            p += 4;
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+void MessageCodec::writeHeader(char* out, uint32_t bodySize) {
+    uint32_t net_size = htonl(bodySize);
+    std::memcpy(out, &net_size, HEADER_LENGTH);
+}
+
+uint32_t MessageCodec::readHeader(const char* in) {
+    uint32_t net_size;
+    std::memcpy(&net_size, in, HEADER_LENGTH);
+    return ntohl(net_size);
+}
+
+size_t MessageCodec::frameSize(const sanguosha::GameMessage& msg) {
+    return HEADER_LENGTH + msg.ByteSizeLong();
+}
+
+size_t MessageCodec::encodeInto(const sanguosha::GameMessage& msg, char* out, size_t capacity) {
+    size_t bodySize = static_cast<size_t>(msg.GetCachedSize());
+    if (capacity < HEADER_LENGTH + bodySize) {
+        return 0;
+    }
+    writeHeader(out, static_cast<uint32_t>(bodySize));
+    msg.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(out + HEADER_LENGTH));
+    return HEADER_LENGTH + bodySize;
+}
+
+bool MessageCodec::decode(const char* body, size_t size, sanguosha::GameMessage& msg) {
+    return msg.ParseFromArray(body, static_cast<int>(size));
+}
+
 std::vector<char> MessageCodec::encode(const sanguosha::GameMessage& msg) {
-    // 计算消息体大小
-    size_t body_size = msg.ByteSizeLong();
-    size_t total_size = HEADER_LENGTH + body_size;
-    
-    std::vector<char> buffer(total_size);
-    char* ptr = buffer.data();
-    
-    // 写入消息头（长度）
-    uint32_t net_size = htonl(static_cast<uint32_t>(body_size));
-    std::memcpy(ptr, &net_size, HEADER_LENGTH);
-    
-    // 写入消息体
-    msg.SerializeToArray(ptr + HEADER_LENGTH, body_size);
-    
+    std::vector<char> buffer(frameSize(msg));
+    encodeInto(msg, buffer.data(), buffer.size());
+    return buffer;
+}
+
+std::vector<char> MessageCodec::encodeEnvelope(sanguosha::MessageType type, int fieldNumber,
+                                               const google::protobuf::MessageLite* payload) {
+    constexpr uint64_t typeKey = (sanguosha::GameMessage::kTypeFieldNumber << 3) | WIRE_VARINT;
+    uint64_t payloadKey = (static_cast<uint64_t>(fieldNumber) << 3) | WIRE_LENGTH_DELIMITED;
+    size_t payloadSize = payload ? payload->ByteSizeLong() : 0;
+
+    // proto3不编码默认值，type为UNKNOWN时省略
+    size_t bodySize = type != sanguosha::UNKNOWN ? varintSize(typeKey) + varintSize(type) : 0;
+    if (payload) {
+        bodySize += varintSize(payloadKey) + varintSize(payloadSize) + payloadSize;
+    }
+
+    std::vector<char> buffer(HEADER_LENGTH + bodySize);
+    writeHeader(buffer.data(), static_cast<uint32_t>(bodySize));
+    char* p = buffer.data() + HEADER_LENGTH;
+    if (type != sanguosha::UNKNOWN) {
+        p = writeVarint(p, typeKey);
+        p = writeVarint(p, static_cast<uint64_t>(type));
+    }
+    if (payload) {
+        p = writeVarint(p, payloadKey);
+        p = writeVarint(p, payloadSize);
+        payload->SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(p));
+    }
+    return buffer;
+}
+
+std::vector<char> MessageCodec::encodeBatch(const std::vector<std::shared_ptr<const std::vector<char>>>& frames) {
+    // GameMessageBatch.messages的每一项就是一条GameMessage的序列化结果，可以直接拼接
+    constexpr uint64_t messageKey = (sanguosha::GameMessageBatch::kMessagesFieldNumber << 3) | WIRE_LENGTH_DELIMITED;
+    size_t batchSize = 0;
+    for (const auto& frame : frames) {
+        size_t bodySize = frame->size() - HEADER_LENGTH;
+        batchSize += varintSize(messageKey) + varintSize(bodySize) + bodySize;
+    }
+
+    // 外层信封：type = BATCH，batch = 上面拼出的GameMessageBatch
+    constexpr uint64_t typeKey = (sanguosha::GameMessage::kTypeFieldNumber << 3) | WIRE_VARINT;
+    constexpr uint64_t batchKey = (sanguosha::GameMessage::kBatchFieldNumber << 3) | WIRE_LENGTH_DELIMITED;
+    size_t bodySize = varintSize(typeKey) + varintSize(sanguosha::BATCH) +
+                      varintSize(batchKey) + varintSize(batchSize) + batchSize;
+
+    std::vector<char> buffer(HEADER_LENGTH + bodySize);
+    writeHeader(buffer.data(), static_cast<uint32_t>(bodySize));
+
+    char* p = buffer.data() + HEADER_LENGTH;
+    p = writeVarint(p, typeKey);
+    p = writeVarint(p, sanguosha::BATCH);
+    p = writeVarint(p, batchKey);
+    p = writeVarint(p, batchSize);
+    for (const auto& frame : frames) {
+        size_t size = frame->size() - HEADER_LENGTH;
+        p = writeVarint(p, messageKey);
+        p = writeVarint(p, size);
+        std::memcpy(p, frame->data() + HEADER_LENGTH, size);
+        p += size;
+    }
     return buffer;
 }
 
+bool MessageCodec::peekEnvelope(const char* body, size_t size, Envelope& envelope) {
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(body);
+    const uint8_t* end = p + size;
+    envelope = Envelope(); // proto3默认值不会被序列化
+
+    // 按规范字段顺序不保证，逐个扫描顶层字段，只记下type、request_id和payload的位置
+    WireField field;
+    while (p < end) {
+        if (!readField(p, end, field)) {
+            return false;
+        }
+        if (field.wireType == WIRE_VARINT) {
+            if (field.number == sanguosha::GameMessage::kTypeFieldNumber) {
+                envelope.type = static_cast<sanguosha::MessageType>(field.value);
+            } else if (field.number == sanguosha::GameMessage::kRequestIdFieldNumber) {
+                envelope.requestId = static_cast<uint32_t>(field.value);
+            }
+        } else if (field.wireType == WIRE_LENGTH_DELIMITED) {
+            // oneof只有一个成员，重复出现时以最后一个为准（与protobuf解析一致）
+            envelope.payloadField = static_cast<int>(field.number);
+            envelope.payload = reinterpret_cast<const char*>(field.data);
+            envelope.payloadSize = static_cast<size_t>(field.value);
+        }
+    }
+    return true;
+}
+
+bool MessageCodec::peekType(const char* body, size_t size, sanguosha::MessageType& type) {
+    Envelope envelope;
+    if (!peekEnvelope(body, size, envelope)) {
+        return false;
+    }
+    type = envelope.type;
+    return true;
+}
+
+bool MessageCodec::nextBatchItem(const char*& cursor, const char* end, const char*& item, size_t& itemSize) {
+    // GameMessageBatch只有messages一个字段，其他字段按未知字段跳过
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(cursor);
+    const uint8_t* last = reinterpret_cast<const uint8_t*>(end);
+    WireField field;
+    while (p < last) {
+        if (!readField(p, last, field)) {
+            return false; // 格式错误，cursor停在出错的字段之前
+        }
+        cursor = reinterpret_cast<const char*>(p);
+        if (field.wireType == WIRE_LENGTH_DELIMITED &&
+            field.number == sanguosha::GameMessageBatch::kMessagesFieldNumber) {
+            item = reinterpret_cast<const char*>(field.data);
+            itemSize = static_cast<size_t>(field.value);
+            return true;
+        }
+    }
+    return false;
+}
+
+static_assert(sizeof(MessageCodec::CompactGameAction) == 18, "compact layout is part of the protocol");
+static_assert(sizeof(MessageCodec::CompactHeartbeat) == 13, "compact layout is part of the protocol");
+
+sanguosha::MessageType MessageCodec::compactType(const char* body, size_t size) {
+    if (size == 0) {
+        return sanguosha::UNKNOWN;
+    }
+    switch (static_cast<uint8_t>(body[0])) {
+        case COMPACT_GAME_ACTION:
+            return size == sizeof(CompactGameAction) ? sanguosha::GAME_ACTION : sanguosha::UNKNOWN;
+        case COMPACT_HEARTBEAT:
+            return size == sizeof(CompactHeartbeat) ? sanguosha::HEARTBEAT : sanguosha::UNKNOWN;
+        default:
+            return sanguosha::UNKNOWN;
+    }
+}
+
+bool MessageCodec::decodeCompact(const char* body, size_t size, sanguosha::GameMessage& msg) {
+    switch (compactType(body, size)) {
+        case sanguosha::GAME_ACTION: {
+            CompactGameAction packed;
+            std::memcpy(&packed, body, sizeof(packed));
+            if (!sanguosha::ActionType_IsValid(packed.actionType)) {
+                return false;
+            }
+            msg.set_type(sanguosha::GAME_ACTION);
+            msg.set_request_id(le32toh(packed.requestId));
+            auto* action = msg.mutable_game_action();
+            action->set_type(static_cast<sanguosha::ActionType>(packed.actionType));
+            action->set_card_id(le32toh(packed.cardId));
+            action->set_target_player(le32toh(packed.targetPlayer));
+            action->set_prompt_id(le32toh(packed.promptId));
+            return true;
+        }
+        case sanguosha::HEARTBEAT: {
+            CompactHeartbeat packed;
+            std::memcpy(&packed, body, sizeof(packed));
+            msg.set_type(sanguosha::HEARTBEAT);
+            msg.set_request_id(le32toh(packed.requestId));
+            msg.mutable_heartbeat()->set_timestamp(le64toh(packed.timestamp));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool MessageCodec::encodeCompact(const sanguosha::GameMessage& msg, std::vector<char>& frame) {
+    auto writeFrame = [&frame](const void* packed, size_t size) {
+        frame.resize(HEADER_LENGTH + size);
+        writeHeader(frame.data(), static_cast<uint32_t>(size));
+        std::memcpy(frame.data() + HEADER_LENGTH, packed, size);
+    };
+
+    switch (msg.type()) {
+        case sanguosha::GAME_ACTION: {
+            const auto& action = msg.game_action();
+            CompactGameAction packed;
+            packed.tag = COMPACT_GAME_ACTION;
+            packed.actionType = static_cast<uint8_t>(action.type());
+            packed.cardId = htole32(action.card_id());
+            packed.targetPlayer = htole32(action.target_player());
+            packed.promptId = htole32(action.prompt_id());
+            packed.requestId = htole32(msg.request_id());
+            writeFrame(&packed, sizeof(packed));
+            return true;
+        }
+        case sanguosha::HEARTBEAT: {
+            CompactHeartbeat packed;
+            packed.tag = COMPACT_HEARTBEAT;
+            packed.timestamp = htole64(msg.heartbeat().timestamp());
+            packed.requestId = htole32(msg.request_id());
+            writeFrame(&packed, sizeof(packed));
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 sanguosha::GameMessage MessageCodec::decode(const std::vector<char>& buffer) {
     if (buffer.size() < HEADER_LENGTH) {
         throw std::runtime_error("Message too short");
     }
     
     // 解析消息头
-    uint32_t net_size;
-    std::memcpy(&net_size, buffer.data(), HEADER_LENGTH);
-    uint32_t body_size = ntohl(net_size);
+    uint32_t body_size = readHeader(buffer.data());
     
     // 检查消息长度
     if (buffer.size() < HEADER_LENGTH + body_size) {
@@ -40,7 +331,7 @@ sanguosha::GameMessage MessageCodec::decode(const std::vector<char>& buffer) {
     
     // 解析消息体
     sanguosha::GameMessage msg;
-    if (!msg.ParseFromArray(buffer.data() + HEADER_LENGTH, body_size)) {
+    if (!decode(buffer.data() + HEADER_LENGTH, body_size, msg)) {
         throw std::runtime_error("Parse message failed");
     }
     
@@ -1,52 +1,478 @@
 #include "network/server.h"
 #include "network/session.h"
+#include "network/message_codec.h"
+#include "room/room_manager.h"
+#include "game/mcts_bot.h"
+#include "common/cpu_topology.h"
+#include "network/hot_restart.h"
 #include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <csignal>
+#include <unistd.h>
 
 using boost::asio::ip::tcp;
 
 namespace Sanguosha {
 namespace Network {
 
-Server::Server() 
-    : io_context_(),
-      acceptor_(io_context_) {}
+Server::Server(const ServerConfig& config)
+    : config_(pinConstructingThread(config)),
+      io_context_(),
+      ioGate_(std::make_shared<Common::IoGate>(io_context_)),
+      acceptor_(io_context_),
+      signals_(io_context_, SIGTERM, SIGINT),
+      handoffAcceptor_(io_context_),
+      timerWheel_(io_context_, std::chrono::milliseconds(config.timerTickMs)),
+      userStore_(config.userStorePath),
+      loginAdmission_(timerWheel_, config.loginRatePerSec, config.loginBurst, config.loginQueueLimit) {
+    sanguosha::GameMessage full;
+    full.set_type(sanguosha::LOGIN_RESPONSE);
+    auto* loginRes = full.mutable_login_response();
+    loginRes->set_success(false);
+    loginRes->set_error_message("Server full");
+    loginRes->set_retry_after_ms(CONNECTION_RETRY_AFTER_MS);
+    serverFullFrame_ = MessageCodec::encode(full);
+
+    Session::registerHandlers(handlers_);
+}
+
+Server::~Server() {
+    ioGate_->close();
+}
 
 void Server::start(unsigned short port) {
-    tcp::endpoint endpoint(tcp::v4(), port);
-    acceptor_.open(endpoint.protocol());
-    acceptor_.set_option(tcp::acceptor::reuse_address(true));
-    acceptor_.bind(endpoint);
-    acceptor_.listen();
+    // 先绑核再建监听socket和会话：之后事件循环线程分配的缓冲区等内存按first-touch落在本地节点。
+    // 构造时已经绑过构造线程，这里再绑一次是为了在别的线程上调用start()的情况
+    placeThreads();
+
+    if (config_.takeover) {
+        takeOver();
+    } else {
+        tcp::endpoint endpoint(tcp::v4(), port);
+        acceptor_.open(endpoint.protocol());
+        acceptor_.set_option(tcp::acceptor::reuse_address(true));
+        acceptor_.bind(endpoint);
+        acceptor_.listen();
+    }
+    listenForHandoff();
+    startPersistence();
     
     do_accept();
+    scheduleStatsReport();
+    waitForSignal();
     
-    std::cout << "Server listening on port " << port << std::endl;
-    io_context_.run();
+    std::cout << "Server listening on port " << acceptor_.local_endpoint().port() << std::endl;
+    runEventLoop();
+}
+
+const ServerConfig& Server::pinConstructingThread(const ServerConfig& config) {
+    if (config.ioCpu >= 0) {
+        Common::pinCurrentThread(config.ioCpu);
+    }
+    return config;
+}
+
+void Server::placeThreads() {
+    auto topology = Common::CpuTopology::detect();
+    std::cout << "CPU topology: " << topology.describe() << std::endl;
+
+    if (config_.ioCpu >= 0) {
+        Common::pinCurrentThread(config_.ioCpu);
+        std::cout << "Event loop pinned to cpu " << config_.ioCpu
+                  << " (node " << topology.nodeOf(config_.ioCpu) << ")" << std::endl;
+    }
+    auto& planner = sanguosha::BotPlanner::Instance();
+    planner.configureWorkers(config_.botThreads, config_.workerCpus);
+    if (!config_.workerCpus.empty()) {
+        std::cout << planner.workerCount() << " bot workers pinned to cpus "
+                  << Common::formatCpuList(config_.workerCpus) << std::endl;
+        for (int cpu : config_.workerCpus) {
+            if (cpu == config_.ioCpu) {
+                std::cerr << "Warning: cpu " << cpu << " is shared by the event loop and bot workers" << std::endl;
+            } else if (config_.ioCpu >= 0 && topology.nodeOf(cpu) != topology.nodeOf(config_.ioCpu)) {
+                std::cerr << "Warning: bot worker cpu " << cpu << " is on a different NUMA node than the event loop"
+                          << std::endl;
+            }
+        }
+    }
+}
+
+void Server::runEventLoop() {
+    if (!config_.busyPoll) {
+        io_context_.run();
+        return;
+    }
+    std::cout << "Event loop: busy-poll (spin " << config_.busyPollSpinUs << "us, SO_BUSY_POLL "
+              << config_.busyPollUsec << "us)" << std::endl;
+
+    // 有事件时一直空转poll()，不进入阻塞等待；连续空闲超过spin时长后改为限时阻塞，
+    // 每次空等一轮时长翻倍（最长MAX_IDLE_BLOCK），一有事件立即回到空转。
+    // 没有任何待处理的工作时poll()会让io_context进入stopped，与run()返回的条件一致
+    using Clock = std::chrono::steady_clock;
+    const auto spin = std::chrono::microseconds(config_.busyPollSpinUs);
+    auto block = MIN_IDLE_BLOCK;
+    auto lastEvent = Clock::now();
+    while (!io_context_.stopped()) {
+        if (io_context_.poll() > 0) {
+            lastEvent = Clock::now();
+            block = MIN_IDLE_BLOCK;
+            continue;
+        }
+        if (Clock::now() - lastEvent < spin) {
+            continue;
+        }
+        if (io_context_.run_one_for(block) > 0) {
+            lastEvent = Clock::now();
+            block = MIN_IDLE_BLOCK;
+        } else {
+            block = std::min(block * 2, MAX_IDLE_BLOCK);
+        }
+    }
+}
+
+void Server::startPersistence() {
+    if (config_.stateDir.empty()) {
+        return;
+    }
+    auto& roomMgr = Room::RoomManager::Instance();
+    // 热重启接管时旧进程还在跑它自己的游戏，不恢复它的快照，只接管目录
+    if (!config_.takeover) {
+        auto started = std::chrono::steady_clock::now();
+        roomMgr.restore(config_.stateDir);
+        std::cout << "State restore took " << std::chrono::duration_cast<std::chrono::milliseconds>(
+                         std::chrono::steady_clock::now() - started).count()
+                  << "ms" << std::endl;
+    }
+    roomMgr.enableJournal(config_.stateDir);
+    scheduleSnapshot();
+}
+
+void Server::scheduleSnapshot() {
+    if (config_.snapshotIntervalSec == 0) {
+        return;
+    }
+    timerWheel_.schedule(std::chrono::seconds(config_.snapshotIntervalSec), [this]() {
+        if (shuttingDown_) {
+            return;
+        }
+        Room::RoomManager::Instance().snapshot();
+        scheduleSnapshot();
+    });
+}
+
+void Server::takeOver() {
+    auto channel = HandoffChannel::connect(config_.handoffSocket);
+    auto state = channel.receiveAll();
+    acceptor_.assign(tcp::v4(), state.listenerFd);
+
+    for (auto& handed : state.sessions) {
+        auto session = std::make_shared<Session>(tcp::socket(io_context_, tcp::v4(), handed.fd), *this);
+        session->adopt(handed.playerId, handed.capabilities);
+        {
+            std::lock_guard<std::mutex> lock(sessionMutex_);
+            sessions_.insert(session);
+            if (handed.playerId != 0) {
+                playerSessions_[handed.playerId] = session;
+                // 客户端手里的重连令牌在新进程里继续有效
+                if (!handed.resumeToken.empty()) {
+                    presence_[handed.playerId].token = handed.resumeToken;
+                    resumeTokens_[handed.resumeToken] = handed.playerId;
+                }
+            }
+        }
+        session->start();
+    }
+    // 确认之后旧进程才停止接受连接，交接中途失败时旧进程照常服务
+    channel.sendAck();
+    std::cout << "Took over listening socket and " << state.sessions.size()
+              << " connections from the previous process" << std::endl;
+}
+
+void Server::listenForHandoff() {
+    if (config_.handoffSocket.empty()) {
+        return;
+    }
+    // 路径上可能是旧进程的socket（已经交接完）或者上次遗留的文件
+    ::unlink(config_.handoffSocket.c_str());
+    boost::asio::local::stream_protocol::endpoint endpoint(config_.handoffSocket);
+    handoffAcceptor_.open(endpoint.protocol());
+    handoffAcceptor_.bind(endpoint);
+    handoffAcceptor_.listen();
+    acceptHandoff();
+}
+
+void Server::acceptHandoff() {
+    handoffAcceptor_.async_accept(
+        [this](boost::system::error_code ec, boost::asio::local::stream_protocol::socket socket) {
+            if (ec) {
+                return;
+            }
+            handOff(std::move(socket));
+        });
+}
+
+void Server::handOff(boost::asio::local::stream_protocol::socket socket) {
+    // 交接是一次性的少量阻塞读写，直接在事件循环线程上做
+    boost::system::error_code ec;
+    HandoffChannel channel(socket.release(ec));
+    auto& roomMgr = Room::RoomManager::Instance();
+    size_t handed = 0;
+    try {
+        channel.awaitRequest();
+        channel.sendListener(acceptor_.native_handle());
+        // 没开局的房间解散，里面的玩家也变成可以迁移的空闲连接
+        roomMgr.stopMatchmaking();
+
+        std::vector<std::shared_ptr<Session>> sessions;
+        {
+            std::lock_guard<std::mutex> lock(sessionMutex_);
+            sessions.assign(sessions_.begin(), sessions_.end());
+        }
+        for (const auto& session : sessions) {
+            uint32_t playerId = session->playerId();
+            if (playerId == 0 && !session->canHandOff()) {
+                // 登录进行到一半的连接：断开让客户端重连到新进程
+                session->close();
+                continue;
+            }
+            if (!session->canHandOff() || (playerId != 0 && roomMgr.roomIdOf(playerId) != 0)) {
+                continue;
+            }
+            HandoffSession record;
+            record.playerId = playerId;
+            record.capabilities = session->capabilities();
+            record.resumeToken = playerId != 0 ? issueResumeToken(playerId) : std::string();
+            record.fd = session->detach();
+            if (record.fd < 0) {
+                continue;
+            }
+            // 描述符已经复制给对方，本进程的这一份直接关掉
+            try {
+                channel.sendSession(record);
+            } catch (...) {
+                ::close(record.fd);
+                throw;
+            }
+            ::close(record.fd);
+            ++handed;
+        }
+        // 状态目录交给新进程，它在收到DONE之后才开始写；留在本进程里打完的游戏不再持久化
+        roomMgr.disableJournal();
+        channel.sendDone();
+        channel.awaitAck();
+    } catch (const std::exception& e) {
+        // 新进程没能接管：继续在原来的监听socket上服务，等待下一次交接
+        std::cerr << "Hot restart handoff failed: " << e.what() << std::endl;
+        roomMgr.resumeMatchmaking();
+        if (!config_.stateDir.empty() && !roomMgr.journalEnabled()) {
+            roomMgr.enableJournal(config_.stateDir);
+        }
+        acceptHandoff();
+        return;
+    }
+
+    // 两个进程没有跨进程的表锁，新进程扩容时还会换掉文件：从此本进程不再写用户表
+    handedOff_ = true;
+    std::cout << "Handed off listening socket and " << handed
+              << " connections; draining the remaining games" << std::endl;
+    handoffAcceptor_.close(ec);
+    beginDrain();
+}
+
+void Server::forgetSession(const std::shared_ptr<Session>& session) {
+    uint32_t playerId = session->playerId();
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    sessions_.erase(session);
+    if (playerId == 0) {
+        return;
+    }
+    auto it = playerSessions_.find(playerId);
+    if (it != playerSessions_.end() && it->second.lock() == session) {
+        playerSessions_.erase(it);
+    }
+    // 重连令牌随连接转给了新进程
+    auto presence = presence_.find(playerId);
+    if (presence != presence_.end()) {
+        timerWheel_.cancel(presence->second.graceTimer);
+        resumeTokens_.erase(presence->second.token);
+        presence_.erase(presence);
+    }
+}
+
+void Server::waitForSignal() {
+    signals_.async_wait([this](const boost::system::error_code& ec, int signal) {
+        if (ec) {
+            return;
+        }
+        if (!draining_) {
+            std::cout << "Received signal " << signal << ", draining" << std::endl;
+            beginDrain();
+            waitForSignal();
+        } else if (!shuttingDown_) {
+            std::cout << "Received signal " << signal << " again, not waiting for games" << std::endl;
+            finishShutdown(std::chrono::steady_clock::now() + DRAIN_FLUSH_TIMEOUT);
+        }
+    });
+}
+
+void Server::beginDrain() {
+    draining_ = true;
+    drainDeadline_ = std::chrono::steady_clock::now() + std::chrono::seconds(config_.drainTimeoutSec);
+
+    // 不再接受新连接；已连接的玩家（包括断线重连的）照常处理，直到自己的游戏结束
+    boost::system::error_code ec;
+    acceptor_.close(ec);
+
+    auto& roomMgr = Room::RoomManager::Instance();
+    size_t closedRooms = roomMgr.stopMatchmaking();
+    std::cout << "Drain: stopped accepting, closed " << closedRooms << " waiting rooms, "
+              << roomMgr.activeGameCount() << " games in progress (timeout "
+              << config_.drainTimeoutSec << "s)" << std::endl;
+    checkDrained();
+}
+
+void Server::checkDrained() {
+    if (shuttingDown_) {
+        return;
+    }
+    size_t games = Room::RoomManager::Instance().activeGameCount();
+    auto now = std::chrono::steady_clock::now();
+    if (games > 0 && now < drainDeadline_) {
+        timerWheel_.schedule(DRAIN_POLL_INTERVAL, [this]() { checkDrained(); });
+        return;
+    }
+    if (games > 0) {
+        std::cerr << "Drain timeout: " << games << " games still in progress, shutting down anyway" << std::endl;
+    }
+    finishShutdown(now + DRAIN_FLUSH_TIMEOUT);
+}
+
+void Server::finishShutdown(std::chrono::steady_clock::time_point flushDeadline) {
+    shuttingDown_ = true;
+
+    // 先让已排队的帧（包括游戏结束消息）写出去再断开
+    std::vector<std::shared_ptr<Session>> sessions;
+    {
+        std::lock_guard<std::mutex> lock(sessionMutex_);
+        sessions.assign(sessions_.begin(), sessions_.end());
+    }
+    size_t pendingBytes = 0;
+    for (const auto& session : sessions) {
+        pendingBytes += session->outboundBytes();
+    }
+    if (pendingBytes > 0 && std::chrono::steady_clock::now() < flushDeadline) {
+        timerWheel_.schedule(DRAIN_POLL_INTERVAL, [this, flushDeadline]() { finishShutdown(flushDeadline); });
+        return;
+    }
+
+    for (const auto& session : sessions) {
+        session->close();
+    }
+    signals_.cancel();
+    // 还在搜索的机器人不会再把结果投递回来：先关闭入口，再丢弃排队的搜索、等正在进行的结束
+    ioGate_->close();
+    sanguosha::BotPlanner::Instance().cancelAll();
+    if (!handedOff_) {
+        userStore_.flush();
+    }
+    // 排空超时时还没打完的游戏写进最后一份快照，下次启动时恢复
+    Room::RoomManager::Instance().disableJournal();
+    std::cout << "Shutdown complete, " << sessions.size() << " connections closed";
+    if (pendingBytes > 0) {
+        std::cout << " (" << pendingBytes << " bytes unsent)";
+    }
+    std::cout << std::endl;
+    io_context_.stop();
 }
 
 void Server::do_accept() {
     acceptor_.async_accept(
         [this](boost::system::error_code ec, tcp::socket socket) {
-            if (!ec) {
-                std::cout << "New connection accepted" << std::endl;
-                // 创建Session时，传入this（Server）的引用
-                auto session = std::make_shared<Session>(std::move(socket), *this);
+            if (ec == boost::asio::error::operation_aborted || !acceptor_.is_open()) {
+                return; // 停机排空时关闭了监听socket
+            }
+            if (ec) {
+                // 文件描述符耗尽等错误时稍后再接受，避免空转
+                std::cerr << "Accept error: " << ec.message() << std::endl;
+                timerWheel_.schedule(timerWheel_.tickInterval(), [this]() { do_accept(); });
+                return;
+            }
+
+            // 连接数已满：在创建Session之前拒绝
+            if (connectionCount() >= config_.maxConnections) {
+                rejectConnection(std::move(socket));
+                do_accept();
+                return;
+            }
+
+            std::cout << "New connection accepted" << std::endl;
+            // 创建Session时，传入this（Server）的引用
+            auto session = std::make_shared<Session>(std::move(socket), *this);
+            {
+                std::lock_guard<std::mutex> lock(sessionMutex_);
                 sessions_.insert(session);
-                session->start();
             }
+            session->start();
             do_accept();
         });
 }
 
+void Server::scheduleStatsReport() {
+    if (config_.statsIntervalSec == 0) {
+        return;
+    }
+    timerWheel_.schedule(std::chrono::seconds(config_.statsIntervalSec), [this]() {
+        auto& roomManager = Room::RoomManager::Instance();
+        std::cout << "Message handler stats:\n" << handlers_.report()
+                  << "Rooms: " << roomManager.activeGameCount() << " games in progress, "
+                  << roomManager.hibernatedRoomCount() << " hibernated" << std::endl;
+        scheduleStatsReport();
+    });
+}
+
+void Server::rejectConnection(tcp::socket socket) {
+    // 非阻塞地尽力写出"服务器已满"的响应，写不完也直接关闭
+    boost::system::error_code ec;
+    socket.non_blocking(true, ec);
+    socket.write_some(boost::asio::buffer(serverFullFrame_), ec);
+    socket.shutdown(tcp::socket::shutdown_both, ec);
+    socket.close(ec);
+}
+
+void Server::recordRateLimited(sanguosha::MessageType type) {
+    if (static_cast<size_t>(type) < rateLimited_.size()) {
+        rateLimited_[type].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Server::rateLimitedCount(sanguosha::MessageType type) const {
+    return static_cast<size_t>(type) < rateLimited_.size() ? rateLimited_[type].load(std::memory_order_relaxed) : 0;
+}
+
+size_t Server::connectionCount() {
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    return sessions_.size();
+}
+
 void Server::registerSession(uint32_t playerId, std::shared_ptr<Session> session) {
     std::lock_guard<std::mutex> lock(sessionMutex_);
     playerSessions_[playerId] = session; // 存储shared_ptr，避免循环引用
     std::cout << "Player " << playerId << " session registered." << std::endl;
 }
 
-void Server::unregisterSession(uint32_t playerId) {
+void Server::unregisterSession(uint32_t playerId, const Session* session) {
     std::lock_guard<std::mutex> lock(sessionMutex_);
-    playerSessions_.erase(playerId);
+    auto it = playerSessions_.find(playerId);
+    if (it == playerSessions_.end()) {
+        return;
+    }
+    // 玩家已经用新连接重新登录时保留新的映射
+    auto current = it->second.lock();
+    if (current && current.get() != session) {
+        return;
+    }
+    playerSessions_.erase(it);
     std::cout << "Player " << playerId << " session unregistered." << std::endl;
 }
 
@@ -59,5 +485,93 @@ std::shared_ptr<Session> Server::getSession(uint32_t playerId) {
     return nullptr;
 }
 
+std::string Server::issueResumeToken(uint32_t playerId) {
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    auto& presence = presence_[playerId];
+    if (!presence.token.empty()) {
+        return presence.token; // 同一身份沿用已有令牌
+    }
+
+    // 128位随机令牌，十六进制编码
+    std::ostringstream oss;
+    oss << std::hex << std::setfill('0')
+        << std::setw(16) << tokenRng_() << std::setw(16) << tokenRng_();
+    presence.token = oss.str();
+    resumeTokens_[presence.token] = playerId;
+    return presence.token;
+}
+
+uint32_t Server::resumePlayer(const std::string& token) {
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    auto it = resumeTokens_.find(token);
+    if (it == resumeTokens_.end()) {
+        return 0;
+    }
+    uint32_t playerId = it->second;
+    auto& presence = presence_[playerId];
+    // 宽限期内回来了，座位继续保留
+    timerWheel_.cancel(presence.graceTimer);
+    presence.graceTimer = Common::TimerWheel::INVALID_TIMER;
+    return playerId;
+}
+
+void Server::onSessionClosed(const std::shared_ptr<Session>& session) {
+    uint32_t playerId = session->playerId();
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    sessions_.erase(session);
+    if (playerId == 0) {
+        return; // 未登录的连接没有需要保留的状态
+    }
+
+    // 玩家已经从别的连接恢复，旧连接断开不影响座位
+    auto it = playerSessions_.find(playerId);
+    if (it != playerSessions_.end()) {
+        auto current = it->second.lock();
+        if (current && current != session) {
+            return;
+        }
+        playerSessions_.erase(it);
+    }
+
+    auto presence = presence_.find(playerId);
+    if (presence == presence_.end()) {
+        return;
+    }
+    timerWheel_.cancel(presence->second.graceTimer);
+    presence->second.graceTimer = timerWheel_.schedule(
+        std::chrono::milliseconds(config_.resumeGraceMs),
+        [this, playerId]() { onGraceExpired(playerId); });
+    std::cout << "Player " << playerId << " disconnected, holding seat for "
+              << config_.resumeGraceMs << "ms" << std::endl;
+}
+
+void Server::holdSeat(uint32_t playerId) {
+    std::lock_guard<std::mutex> lock(sessionMutex_);
+    if (playerSessions_.count(playerId)) {
+        return;
+    }
+    auto& presence = presence_[playerId];
+    timerWheel_.cancel(presence.graceTimer);
+    presence.graceTimer = timerWheel_.schedule(
+        std::chrono::milliseconds(config_.resumeGraceMs),
+        [this, playerId]() { onGraceExpired(playerId); });
+}
+
+void Server::onGraceExpired(uint32_t playerId) {
+    {
+        std::lock_guard<std::mutex> lock(sessionMutex_);
+        auto presence = presence_.find(playerId);
+        if (presence == presence_.end() || playerSessions_.count(playerId)) {
+            return; // 已经重连
+        }
+        resumeTokens_.erase(presence->second.token);
+        presence_.erase(presence);
+    }
+
+    // 宽限期已过，释放座位（不能持锁调用，游戏逻辑会回头查询会话）
+    std::cout << "Player " << playerId << " did not reconnect, releasing seat" << std::endl;
+    Room::RoomManager::Instance().onPlayerAbandoned(playerId);
+}
+
 } // namespace Network
 } // namespace Sanguosha
\ No newline at end of file
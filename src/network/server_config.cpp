@@ -0,0 +1,184 @@
+#include "network/server_config.h"
+#include "sanguosha.pb.h"
+#include "common/cpu_topology.h"
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace Sanguosha {
+namespace Network {
+
+namespace {
+
+uint32_t parseUnsigned(const std::string& key, const std::string& value) {
+    try {
+        size_t pos = 0;
+        unsigned long parsed = std::stoul(value, &pos);
+        if (pos == value.size() && parsed <= UINT32_MAX) {
+            return static_cast<uint32_t>(parsed);
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::invalid_argument("invalid value for --" + key + ": " + value);
+}
+
+std::vector<int> parseCpuListArg(const std::string& key, const std::string& value) {
+    try {
+        return Common::parseCpuList(value);
+    } catch (const std::invalid_argument&) {
+        throw std::invalid_argument("invalid value for --" + key + ": " + value);
+    }
+}
+
+double parseDouble(const std::string& key, const std::string& value) {
+    try {
+        size_t pos = 0;
+        double parsed = std::stod(value, &pos);
+        if (pos == value.size()) {
+            return parsed;
+        }
+    } catch (const std::exception&) {
+    }
+    throw std::invalid_argument("invalid value for --" + key + ": " + value);
+}
+
+// 形如 "20/40"（速率/突发），只写速率时突发量取速率的两倍
+RateLimit parseRateLimit(const std::string& key, const std::string& value) {
+    RateLimit limit;
+    auto slash = value.find('/');
+    limit.ratePerSec = parseDouble(key, value.substr(0, slash));
+    if (slash != std::string::npos) {
+        limit.burst = parseUnsigned(key, value.substr(slash + 1));
+    } else {
+        limit.burst = static_cast<uint32_t>(limit.ratePerSec * 2 > 1 ? limit.ratePerSec * 2 : 1);
+    }
+    return limit;
+}
+
+} // namespace
+
+std::unordered_map<int, RateLimit> ServerConfig::defaultMessageRateLimits() {
+    // 按正常客户端的操作频率留足余量
+    return {
+        {sanguosha::LOGIN_REQUEST, {1, 3}},
+        {sanguosha::HEARTBEAT, {2, 5}},
+        {sanguosha::ROOM_REQUEST, {5, 10}},
+        {sanguosha::GAME_ACTION, {20, 40}},
+        {sanguosha::GAME_STATE_REQUEST, {5, 10}},
+        {sanguosha::ROOM_LIST_REQUEST, {2, 5}},
+        // 批内的每条消息还会按各自的类型限流
+        {sanguosha::BATCH, {20, 40}},
+    };
+}
+
+const RateLimit& ServerConfig::rateLimitFor(int messageType) const {
+    auto it = messageRateLimits.find(messageType);
+    return it != messageRateLimits.end() ? it->second : defaultRateLimit;
+}
+
+ServerConfig ServerConfig::fromArgs(int argc, char* argv[]) {
+    ServerConfig config;
+
+    using Setter = std::function<void(const std::string& key, const std::string& value)>;
+    const std::unordered_map<std::string, Setter> setters = {
+        {"port", [&](const std::string& k, const std::string& v) {
+            uint32_t port = parseUnsigned(k, v);
+            if (port == 0 || port > 65535) {
+                throw std::invalid_argument("invalid value for --" + k + ": " + v);
+            }
+            config.port = static_cast<unsigned short>(port);
+        }},
+        {"user-store", [&](const std::string&, const std::string& v) { config.userStorePath = v; }},
+        {"max-frame-size", [&](const std::string& k, const std::string& v) { config.maxFrameSize = parseUnsigned(k, v); }},
+        {"compress-threshold", [&](const std::string& k, const std::string& v) { config.compressThreshold = parseUnsigned(k, v); }},
+        {"max-outbound-bytes", [&](const std::string& k, const std::string& v) { config.maxOutboundBytes = parseUnsigned(k, v); }},
+        {"outbound-policy", [&](const std::string& k, const std::string& v) {
+            if (v == "drop-oldest") {
+                config.outboundPolicy = OutboundPolicy::DROP_OLDEST_STATE;
+            } else if (v == "keyframe") {
+                config.outboundPolicy = OutboundPolicy::LATEST_KEYFRAME;
+            } else if (v == "disconnect") {
+                config.outboundPolicy = OutboundPolicy::DISCONNECT;
+            } else {
+                throw std::invalid_argument("invalid value for --" + k + ": " + v);
+            }
+        }},
+        {"max-connections", [&](const std::string& k, const std::string& v) { config.maxConnections = parseUnsigned(k, v); }},
+        {"login-rate", [&](const std::string& k, const std::string& v) { config.loginRatePerSec = parseDouble(k, v); }},
+        {"login-burst", [&](const std::string& k, const std::string& v) { config.loginBurst = parseUnsigned(k, v); }},
+        {"login-queue", [&](const std::string& k, const std::string& v) { config.loginQueueLimit = parseUnsigned(k, v); }},
+        {"rate-limit.default", [&](const std::string& k, const std::string& v) { config.defaultRateLimit = parseRateLimit(k, v); }},
+        {"flood-threshold", [&](const std::string& k, const std::string& v) { config.floodDisconnectThreshold = parseUnsigned(k, v); }},
+        {"stats-interval", [&](const std::string& k, const std::string& v) { config.statsIntervalSec = parseUnsigned(k, v); }},
+        {"handoff-socket", [&](const std::string&, const std::string& v) { config.handoffSocket = v; }},
+        {"takeover", [&](const std::string& k, const std::string& v) {
+            if (v == "on") {
+                config.takeover = true;
+            } else if (v == "off") {
+                config.takeover = false;
+            } else {
+                throw std::invalid_argument("invalid value for --" + k + ": " + v);
+            }
+        }},
+        {"state-dir", [&](const std::string&, const std::string& v) { config.stateDir = v; }},
+        {"snapshot-interval", [&](const std::string& k, const std::string& v) { config.snapshotIntervalSec = parseUnsigned(k, v); }},
+        {"turn-timeout-ms", [&](const std::string& k, const std::string& v) { config.turnTimeoutMs = parseUnsigned(k, v); }},
+        {"response-timeout-ms", [&](const std::string& k, const std::string& v) { config.responseTimeoutMs = parseUnsigned(k, v); }},
+        {"timer-tick-ms", [&](const std::string& k, const std::string& v) { config.timerTickMs = parseUnsigned(k, v); }},
+        {"resume-grace-ms", [&](const std::string& k, const std::string& v) { config.resumeGraceMs = parseUnsigned(k, v); }},
+        {"hibernate-idle-ms", [&](const std::string& k, const std::string& v) { config.hibernateIdleMs = parseUnsigned(k, v); }},
+        {"drain-timeout", [&](const std::string& k, const std::string& v) { config.drainTimeoutSec = parseUnsigned(k, v); }},
+        {"io-cpu", [&](const std::string& k, const std::string& v) {
+            auto cpus = parseCpuListArg(k, v);
+            if (cpus.size() != 1) {
+                throw std::invalid_argument("--" + k + " takes a single cpu: " + v);
+            }
+            config.ioCpu = cpus.front();
+        }},
+        {"busy-poll", [&](const std::string& k, const std::string& v) {
+            if (v == "on") {
+                config.busyPoll = true;
+            } else if (v == "off") {
+                config.busyPoll = false;
+            } else {
+                throw std::invalid_argument("invalid value for --" + k + ": " + v);
+            }
+        }},
+        {"busy-poll-spin-us", [&](const std::string& k, const std::string& v) { config.busyPollSpinUs = parseUnsigned(k, v); }},
+        {"busy-poll-usec", [&](const std::string& k, const std::string& v) { config.busyPollUsec = parseUnsigned(k, v); }},
+        {"worker-cpus", [&](const std::string& k, const std::string& v) { config.workerCpus = parseCpuListArg(k, v); }},
+        {"bot-threads", [&](const std::string& k, const std::string& v) { config.botThreads = parseUnsigned(k, v); }},
+    };
+    const std::string rateLimitPrefix = "rate-limit.";
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto eq = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+            throw std::invalid_argument("expected --key=value, got: " + arg);
+        }
+        std::string key = arg.substr(2, eq - 2);
+        std::string value = arg.substr(eq + 1);
+        auto it = setters.find(key);
+        if (it != setters.end()) {
+            it->second(key, value);
+            continue;
+        }
+
+        // 按消息类型名配置限流
+        sanguosha::MessageType type;
+        if (key.rfind(rateLimitPrefix, 0) == 0 &&
+            sanguosha::MessageType_Parse(key.substr(rateLimitPrefix.size()), &type)) {
+            config.messageRateLimits[type] = parseRateLimit(key, value);
+            continue;
+        }
+        throw std::invalid_argument("unknown option: --" + key);
+    }
+    if (config.takeover && config.handoffSocket.empty()) {
+        throw std::invalid_argument("--takeover=on requires --handoff-socket");
+    }
+    return config;
+}
+
+} // namespace Network
+} // namespace Sanguosha
@@ -2,12 +2,16 @@
 #include "network/message_codec.h"
 #include "room/room_manager.h"
 #include <iostream>
-#include <cstdlib>
-#include <ctime>
 #include "room/room.h" // 添加room.h包含
 #include "network/server.h" // 添加server.h包含
+#include "network/login_admission.h"
 #include "game/game_instance.h" 
+#include "game/mcts_bot.h"
 #include <iomanip>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
 
 using boost::asio::ip::tcp;
 using boost::asio::steady_timer;
@@ -19,25 +23,94 @@ Session::Session(tcp::socket socket, Server& server)
     : socket_(std::move(socket)),
       server_(server),
       heartbeat_timer_(socket_.get_executor()) {
+    const auto& config = server_.config();
+    rateBuckets_.reserve(sanguosha::MessageType_ARRAYSIZE);
+    for (int type = 0; type < sanguosha::MessageType_ARRAYSIZE; ++type) {
+        const auto& limit = config.rateLimitFor(type);
+        rateBuckets_.emplace_back(limit.ratePerSec, limit.burst);
+    }
+    rateLimited_.assign(sanguosha::MessageType_ARRAYSIZE, 0);
 }
 
 Session::~Session() {
     if (playerId_ != 0) {
-        server_.unregisterSession(playerId_);
+        server_.unregisterSession(playerId_, this);
     }
 }
 
 void Session::start() {
+    // 可读后用非阻塞读一次取走所有已到达的数据
+    boost::system::error_code ec;
+    socket_.non_blocking(true, ec);
+    if (server_.config().busyPoll && server_.config().busyPollUsec > 0) {
+        enableBusyPoll();
+    }
     startHeartbeat();
-    doReadHeader();
+    doRead();
+}
+
+void Session::enableBusyPoll() {
+    // 收包时内核在驱动队列上忙等一小段时间，省掉软中断到唤醒的延迟
+    int usec = static_cast<int>(server_.config().busyPollUsec);
+    if (::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec)) != 0) {
+        // 通常是缺少CAP_NET_ADMIN；每个进程只提示一次，事件循环的忙轮询不受影响
+        static std::atomic<bool> reported{false};
+        if (!reported.exchange(true)) {
+            std::cerr << "SO_BUSY_POLL not applied: " << std::strerror(errno) << std::endl;
+        }
+    }
+}
+
+bool Session::canHandOff() const {
+    return !closed_ && !readPaused_ && recvBytes_ == 0 && inFlight_ == 0 && outbox_.empty() &&
+           coalesced_.empty() && (capabilities_ & sanguosha::CAPABILITY_COMPRESS) == 0;
+}
+
+int Session::detach() {
+    // 先标记为已关闭，被取消的读等待回调据此直接返回
+    closed_ = true;
+    heartbeat_timer_.cancel();
+    boost::system::error_code ec;
+    int fd = socket_.release(ec);
+    server_.forgetSession(shared_from_this());
+    return ec ? -1 : fd;
+}
+
+void Session::adopt(uint32_t playerId, uint32_t capabilities) {
+    playerId_ = playerId;
+    capabilities_ = capabilities;
+}
+
+void Session::close() {
+    if (closed_) {
+        return;
+    }
+    closed_ = true;
+
+    boost::system::error_code ec;
+    heartbeat_timer_.cancel();
+    socket_.shutdown(tcp::socket::shutdown_both, ec);
+    socket_.close(ec);
+    coalescing_ = false;
+    coalesced_.clear();
+    clearOutbox();
+    server_.onSessionClosed(shared_from_this());
 }
 
 void Session::startHeartbeat() {
     // 设置心跳计时器
     heartbeat_timer_.expires_after(std::chrono::seconds(HEARTBEAT_INTERVAL));
-    heartbeat_timer_.async_wait(
+    heartbeat_timer_.async_wait(withHandlerMemory(timerHandlerMemory_,
         [self = shared_from_this()](const boost::system::error_code& ec) {
             if (!ec) {
+                // 对端长时间无任何数据视为半开连接，主动断开以便进入重连宽限期
+                if (std::chrono::steady_clock::now() - self->lastActivity_ >
+                    std::chrono::seconds(HEARTBEAT_TIMEOUT)) {
+                    std::cerr << "Heartbeat timeout for player: " << self->playerId_ << std::endl;
+                    self->close();
+                    return;
+                }
+
                 // 发送心跳包
                 sanguosha::GameMessage msg;
                 msg.set_type(sanguosha::HEARTBEAT);
@@ -46,161 +119,419 @@ void Session::startHeartbeat() {
                 // 重新设置计时器
                 self->startHeartbeat();
             }
-        });
+        }));
 }
 
-void Session::doReadHeader() {
-    auto self(shared_from_this());
-    boost::asio::async_read(socket_,
-        boost::asio::buffer(header_buffer_, MessageCodec::HEADER_LENGTH),
-        [this, self](boost::system::error_code ec, size_t) {
+void Session::doRead() {
+    if (closed_ || readPaused_) {
+        return;
+    }
+    // 先等待可读再取缓冲区，空闲连接不占用接收缓冲区
+    socket_.async_wait(tcp::socket::wait_read, withHandlerMemory(readHandlerMemory_,
+        [this, self = shared_from_this()](boost::system::error_code ec) {
             if (ec) {
-                if (ec != boost::asio::error::eof) {
-                    std::cerr << "Header read error: " << ec.message() << std::endl;
+                if (ec != boost::asio::error::operation_aborted) {
+                    std::cerr << "Read wait error: " << ec.message() << std::endl;
                 }
+                close();
                 return;
             }
-            
-            // 修复字节序处理
-            uint32_t net_size;
-            memcpy(&net_size, header_buffer_.data(), sizeof(uint32_t));
-            expected_body_size_ = ntohl(net_size); // 正确转换网络字节序到主机字节序
-            
-            // 准备读取消息体
-            body_buffer_.resize(expected_body_size_);
-            doReadBody();
-        });
+            onReadable();
+        }));
 }
 
-void Session::doReadBody() {
-    auto self(shared_from_this());
-    boost::asio::async_read(socket_,
-        boost::asio::buffer(body_buffer_, expected_body_size_),
-        [this, self](boost::system::error_code ec, size_t bytes_transferred) {
-            if (ec) {
-                std::cerr << "Body read error: " << ec.message() 
-                          << ", expected: " << expected_body_size_
-                          << ", transferred: " << bytes_transferred << std::endl;
-                return;
-            }
-            
-            try {
-                // 直接解析消息体，不使用MessageCodec::decode
-                sanguosha::GameMessage msg;
-                if (!msg.ParseFromArray(body_buffer_.data(), body_buffer_.size())) {
-                    std::cerr << "Parse message body failed. Body size: " 
-                              << body_buffer_.size() << std::endl;
-                    // 打印前20字节的十六进制用于调试
-                    std::cerr << "First 20 bytes (hex): ";
-                    for (size_t i = 0; i < std::min(body_buffer_.size(), size_t(20)); ++i) {
-                        std::cerr << std::hex << std::setw(2) << std::setfill('0') 
-                                  << static_cast<int>(body_buffer_[i]) << " ";
-                    }
-                    std::cerr << std::dec << std::endl;
-                    return;
-                }
-                
-                // 根据消息类型处理
-                switch (msg.type()) {
-                    case sanguosha::LOGIN_REQUEST:
-                        std::cout << "Processing login request" << std::endl;
-                        handleLogin(msg.login_request());
-                        break;
-                    case sanguosha::HEARTBEAT:
-                        handleHeartbeat(ec);
-                        break;
-                    case sanguosha::ROOM_REQUEST:
-                        std::cout << "Processing room request" << std::endl;
-                        handleRoomRequest(msg.room_request());
-                        break;
-                    case sanguosha::GAME_ACTION:
-                        std::cout << "Processing game action" << std::endl;
-                        handleGameAction(msg.game_action());
-                        break;
-                    case sanguosha::ROOM_LIST_REQUEST:
-                        handleRoomListRequest();
-                        break;
-                    default:
-                        std::cerr << "Unknown message type: " << msg.type() << std::endl;
-                }
-                
-                // 继续读取下一条消息
-                doReadHeader();
-            } catch (const std::exception& e) {
-                std::cerr << "Process message error: " << e.what() 
-                          << ", buffer size: " << body_buffer_.size()
-                          << ", expected size: " << expected_body_size_ << std::endl;
-            }
-        });
+void Session::onReadable() {
+    if (closed_) {
+        return;
+    }
+    ensureRecvCapacity(std::max(recvBytes_ + MessageCodec::HEADER_LENGTH, RECV_BUFFER_SIZE));
 
-    // 调试信息：打印接收到的数据（十六进制）
-    std::cout << "Received body data (hex): ";
-    for (auto byte : body_buffer_) {
-        std::cout << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte) << " ";
+    boost::system::error_code ec;
+    size_t n = socket_.read_some(
+        boost::asio::buffer(recvBuffer_.data() + recvBytes_, recvBuffer_.capacity() - recvBytes_), ec);
+    if (ec == boost::asio::error::would_block || ec == boost::asio::error::try_again) {
+        doRead();
+        return;
     }
-    std::cout << std::dec << std::endl;
+    if (ec) {
+        if (ec != boost::asio::error::eof) {
+            std::cerr << "Read error: " << ec.message() << std::endl;
+        }
+        close();
+        return;
+    }
+    recvBytes_ += n;
+    lastActivity_ = std::chrono::steady_clock::now();
+    processFrames();
 }
 
-void Session::handleHeartbeat(const boost::system::error_code& ec) {
-    if (ec) {
-        // 如果有错误，记录日志但不中断连接
-        std::cerr << "Heartbeat error: " << ec.message() << std::endl;
+void Session::ensureRecvCapacity(size_t bytes) {
+    if (recvBuffer_.capacity() >= bytes) {
         return;
     }
-    
-    // 重置心跳计时器
-    heartbeat_timer_.expires_after(std::chrono::seconds(HEARTBEAT_INTERVAL));
-    heartbeat_timer_.async_wait(
-        [self = shared_from_this()](const boost::system::error_code& ec) {
-            if (!ec) {
-                // 发送心跳包
-                sanguosha::GameMessage msg;
-                msg.set_type(sanguosha::HEARTBEAT);
-                self->send(msg);
-                
-                // 重新设置计时器
-                self->startHeartbeat();
+    auto larger = server_.getBufferPool().acquire(bytes);
+    if (recvBytes_ > 0) {
+        memcpy(larger.data(), recvBuffer_.data(), recvBytes_);
+    }
+    recvBuffer_ = std::move(larger);
+}
+
+void Session::processFrames() {
+    // 客户端支持BATCH时，这一批请求产生的响应合并成一帧
+    coalescing_ = (capabilities_ & sanguosha::CAPABILITY_BATCH) != 0;
+    size_t offset = 0;
+    while (!closed_ && !readPaused_ && recvBytes_ - offset >= MessageCodec::HEADER_LENGTH) {
+        uint32_t bodySize = MessageCodec::readHeader(recvBuffer_.data() + offset);
+
+        // 长度头不可信：超过上限直接断开，不为它分配内存
+        if (bodySize > server_.config().maxFrameSize) {
+            std::cerr << "Frame too large from player " << playerId_ << ": "
+                      << bodySize << " > " << server_.config().maxFrameSize << std::endl;
+            close();
+            return;
+        }
+        size_t frameSize = MessageCodec::HEADER_LENGTH + bodySize;
+        if (recvBytes_ - offset < frameSize) {
+            break;
+        }
+        if (!handleFrame(recvBuffer_.data() + offset + MessageCodec::HEADER_LENGTH, bodySize)) {
+            return;
+        }
+        offset += frameSize;
+    }
+    coalescing_ = false;
+    if (closed_) {
+        return;
+    }
+    flushCoalesced();
+
+    // 未处理的数据移到缓冲区开头；全部处理完时缓冲区归还给池子
+    recvBytes_ -= offset;
+    if (recvBytes_ == 0) {
+        recvBuffer_.reset();
+    } else if (offset > 0) {
+        memmove(recvBuffer_.data(), recvBuffer_.data() + offset, recvBytes_);
+    }
+    if (recvBytes_ >= MessageCodec::HEADER_LENGTH) {
+        // 半个大帧：按帧长扩容，下次直接读进来
+        ensureRecvCapacity(MessageCodec::HEADER_LENGTH + MessageCodec::readHeader(recvBuffer_.data()));
+    }
+    doRead();
+}
+
+void Session::resumeReading() {
+    readPaused_ = false;
+    if (!closed_) {
+        processFrames();
+    }
+}
+
+bool Session::handleFrame(const char* body, uint32_t size) {
+    // 先只预解析信封：类型、关联ID和payload位置，决定要处理时才完整解析
+    bool compact = (capabilities_ & sanguosha::CAPABILITY_COMPACT) && MessageCodec::isCompact(body, size);
+    MessageCodec::Envelope envelope;
+    if (compact) {
+        envelope.type = MessageCodec::compactType(body, size);
+    }
+    if (compact ? envelope.type == sanguosha::UNKNOWN : !MessageCodec::peekEnvelope(body, size, envelope)) {
+        std::cerr << "Malformed message from player " << playerId_ << ", body size: " << size << std::endl;
+        server_.getHandlerRegistry().recordError(sanguosha::UNKNOWN, size);
+        close();
+        return false;
+    }
+
+    if (envelope.type == sanguosha::BATCH) {
+        return handleBatch(envelope, size);
+    }
+    return handleMessage(body, size, envelope, compact);
+}
+
+bool Session::handleMessage(const char* body, size_t size, const MessageCodec::Envelope& envelope, bool compact) {
+    // 解析之前先按类型限流，刷屏的消息不花解析的代价
+    if (!admitMessage(envelope.type)) {
+        if (consecutiveDropped_ >= server_.config().floodDisconnectThreshold) {
+            std::cerr << "Flood detected from player " << playerId_ << ", closing" << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    // 没有处理函数或未登录的请求直接丢弃，同样不解析
+    auto& registry = server_.getHandlerRegistry();
+    if (!registry.has(envelope.type)) {
+        std::cerr << "Unknown message type: " << envelope.type << std::endl;
+        registry.recordError(envelope.type, size);
+        return true;
+    }
+    if (registry.access(envelope.type) == HandlerAccess::LOGGED_IN && playerId_ == 0) {
+        std::cerr << "Message type " << envelope.type << " (request " << envelope.requestId
+                  << ") before login, ignored" << std::endl;
+        registry.recordError(envelope.type, size);
+        return true;
+    }
+
+    try {
+        sanguosha::GameMessage parsed;
+        const sanguosha::GameMessage* msg = &parsed;
+        bool ok;
+        if (compact) {
+            ok = MessageCodec::decodeCompact(body, size, compactMessage_);
+            msg = &compactMessage_;
+        } else {
+            ok = MessageCodec::decode(body, size, parsed);
+        }
+        if (!ok) {
+            std::cerr << "Parse message body failed. Body size: " << size << std::endl;
+            // 打印前20字节的十六进制用于调试
+            std::cerr << "First 20 bytes (hex): ";
+            for (size_t i = 0; i < std::min(size, size_t(20)); ++i) {
+                std::cerr << std::hex << std::setw(2) << std::setfill('0')
+                          << static_cast<int>(static_cast<unsigned char>(body[i])) << " ";
             }
-        });
+            std::cerr << std::dec << std::endl;
+            registry.recordError(envelope.type, size);
+            close();
+            return false;
+        }
+
+        // 按消息类型查表分发
+        registry.dispatch(*this, *msg, size);
+    } catch (const std::exception& e) {
+        std::cerr << "Process message error: " << e.what() << ", body size: " << size << std::endl;
+        close();
+        return false;
+    }
+    return !closed_;
+}
+
+bool Session::admitMessage(sanguosha::MessageType type) {
+    size_t index = static_cast<size_t>(type) < rateBuckets_.size() ? static_cast<size_t>(type)
+                                                                   : static_cast<size_t>(sanguosha::UNKNOWN);
+    if (rateBuckets_[index].tryAcquire()) {
+        consecutiveDropped_ = 0;
+        return true;
+    }
+    if (rateLimited_[index]++ == 0) {
+        std::cerr << "Rate limiting message type " << index << " from player " << playerId_ << std::endl;
+    }
+    ++consecutiveDropped_;
+    server_.recordRateLimited(static_cast<sanguosha::MessageType>(index));
+    return false;
+}
+
+void Session::handleHeartbeat(const sanguosha::Heartbeat& heartbeat, uint32_t requestId) {
+    // 只记下活动时间，由周期性的心跳计时器检查。不在这里重新发起等待：
+    // 被取消的那次等待还占着timerHandlerMemory_，重新发起会退回堆分配
+    lastActivity_ = std::chrono::steady_clock::now();
     
-    // 可以在这里添加其他心跳处理逻辑
     std::cout << "Heartbeat received from player: " << playerId_ << std::endl;
+
+    // 带了request_id的心跳原样回显时间戳，客户端据此确认送达并测量往返时延
+    if (requestId != 0) {
+        sanguosha::GameMessage response;
+        response.set_type(sanguosha::HEARTBEAT);
+        response.mutable_heartbeat()->set_timestamp(heartbeat.timestamp());
+        reply(requestId, response);
+    }
+}
+
+void Session::registerHandlers(HandlerRegistry& registry) {
+    registry.add(sanguosha::LOGIN_REQUEST, [](Session& session, const sanguosha::GameMessage& msg) {
+        session.handleLogin(msg.login_request(), msg.request_id());
+    });
+    registry.add(sanguosha::HEARTBEAT, [](Session& session, const sanguosha::GameMessage& msg) {
+        session.handleHeartbeat(msg.heartbeat(), msg.request_id());
+    });
+    registry.add(sanguosha::ROOM_REQUEST, [](Session& session, const sanguosha::GameMessage& msg) {
+        session.handleRoomRequest(msg.room_request(), msg.request_id());
+    }, HandlerAccess::LOGGED_IN);
+    registry.add(sanguosha::GAME_ACTION, [](Session& session, const sanguosha::GameMessage& msg) {
+        session.handleGameAction(msg.game_action(), msg.request_id());
+    }, HandlerAccess::LOGGED_IN);
+    registry.add(sanguosha::ROOM_LIST_REQUEST, [](Session& session, const sanguosha::GameMessage& msg) {
+        session.handleRoomListRequest(msg.request_id());
+    });
+}
+
+bool Session::handleBatch(const MessageCodec::Envelope& envelope, size_t size) {
+    // 外层只计数；批内每条消息单独预解析、限流和分发，打包发送不能绕过这些检查
+    if (!admitMessage(sanguosha::BATCH)) {
+        if (consecutiveDropped_ >= server_.config().floodDisconnectThreshold) {
+            std::cerr << "Flood detected from player " << playerId_ << ", closing" << std::endl;
+            close();
+            return false;
+        }
+        return true;
+    }
+    auto& registry = server_.getHandlerRegistry();
+    registry.record(sanguosha::BATCH, size);
+
+    const char* cursor = envelope.payload;
+    const char* end = envelope.payload + envelope.payloadSize;
+    const char* item = nullptr;
+    size_t itemSize = 0;
+    while (!closed_ && MessageCodec::nextBatchItem(cursor, end, item, itemSize)) {
+        MessageCodec::Envelope inner;
+        if (!MessageCodec::peekEnvelope(item, itemSize, inner)) {
+            break;
+        }
+        if (inner.type == sanguosha::BATCH) {
+            std::cerr << "Nested batch from player " << playerId_ << ", ignored" << std::endl;
+            registry.recordError(sanguosha::BATCH, itemSize);
+            continue;
+        }
+        if (!handleMessage(item, itemSize, inner, false)) {
+            return false;
+        }
+    }
+    if (!closed_ && cursor != end) {
+        std::cerr << "Malformed batch from player " << playerId_ << std::endl;
+        registry.recordError(sanguosha::BATCH, size);
+        close();
+    }
+    return !closed_;
 }
 
-void Session::handleLogin(const sanguosha::LoginRequest& login) {
+void Session::handleLogin(const sanguosha::LoginRequest& login, uint32_t requestId) {
+    // 登录要查用户表、恢复房间状态，代价较高；重连风暴时经准入队列限速
+    uint32_t retryAfterMs = 0;
+    auto self = shared_from_this();
+    auto result = server_.getLoginAdmission().submit(
+        [self, login, requestId]() {
+            if (self->closed_) {
+                return;
+            }
+            self->processLogin(login, requestId);
+            // 排队期间暂停了后续请求的处理，登录完成后继续
+            if (self->readPaused_) {
+                self->resumeReading();
+            }
+        },
+        retryAfterMs);
+
+    if (result == LoginAdmission::Result::QUEUED) {
+        // 流水线中跟在登录后面的请求依赖登录结果，等登录处理完再处理
+        pauseReading();
+    }
+
+    if (result == LoginAdmission::Result::REJECTED) {
+        sanguosha::GameMessage response;
+        response.set_type(sanguosha::LOGIN_RESPONSE);
+        auto* login_res = response.mutable_login_response();
+        login_res->set_success(false);
+        login_res->set_error_message("Server busy");
+        login_res->set_retry_after_ms(retryAfterMs);
+        reply(requestId, response);
+    }
+}
+
+void Session::processLogin(const sanguosha::LoginRequest& login, uint32_t requestId) {
     std::cout << "Login attempt: " << login.username() << std::endl;
     
     sanguosha::GameMessage response;
     response.set_type(sanguosha::LOGIN_RESPONSE);
     auto* login_res = response.mutable_login_response();
+
+    // 热重启交接之后用户表归新进程所有，留在本进程打完游戏的连接不能再登录，让客户端重连到新进程
+    if (server_.handedOff()) {
+        login_res->set_success(false);
+        login_res->set_error_message("Server restarting");
+        login_res->set_retry_after_ms(Server::CONNECTION_RETRY_AFTER_MS);
+        reply(requestId, response);
+        return;
+    }
     
-    // 简化登录：允许任何用户名登录，分配随机用户ID
-    // 在实际应用中，这里应该验证用户名和密码
-    playerId_ = 1000 + (rand() % 9000);
+    // 一个连接只能登录一次：再次登录会换掉playerId_，旧ID的会话登记和房间座位却还指向这个连接
+    if (playerId_ != 0) {
+        login_res->set_success(false);
+        login_res->set_error_message("Already logged in");
+        reply(requestId, response);
+        return;
+    }
+
+    // 携带有效令牌时恢复原玩家ID，座位和游戏状态都还在
+    uint32_t resumedId = login.resume_token().empty() ? 0 : server_.resumePlayer(login.resume_token());
+    if (resumedId != 0) {
+        playerId_ = resumedId;
+        login_res->set_resumed(true);
+    } else {
+        // 同一用户名始终得到同一个ID；没有用户名的游客分配一次性ID
+        // 在实际应用中，这里还应该验证密码
+        auto& users = server_.getUserStore();
+        uint64_t userId = login.username().empty() ? users.allocateId()
+                                                   : users.findOrCreate(login.username());
+        // 协议中的玩家ID是32位，最高位留给机器人
+        if (userId == Common::UserStore::INVALID_USER || userId >= sanguosha::BOT_ID_BASE) {
+            login_res->set_success(false);
+            login_res->set_error_message("Invalid username");
+            reply(requestId, response);
+            return;
+        }
+        playerId_ = static_cast<uint32_t>(userId);
+    }
     login_res->set_success(true);
     login_res->set_user_id(playerId_);
+    uint32_t supported = SUPPORTED_CAPABILITIES;
+    if (server_.config().compressThreshold == 0) {
+        supported &= ~static_cast<uint32_t>(sanguosha::CAPABILITY_COMPRESS);
+    }
+    capabilities_ = login.capabilities() & supported;
+    login_res->set_capabilities(capabilities_);
+    if ((capabilities_ & sanguosha::CAPABILITY_COMPRESS) && !compressor_) {
+        compressor_ = std::make_unique<FrameCompressor>();
+        login_res->set_dictionary_id(FrameCompressor::dictionaryId());
+    }
+    login_res->set_resume_token(server_.issueResumeToken(playerId_));
     
-    std::cout << "Login successful, user ID: " << playerId_ << std::endl;
+    std::cout << (resumedId != 0 ? "Session resumed" : "Login successful")
+              << ", user ID: " << playerId_ << std::endl;
     
     // 注册会话到服务器
+    auto previous = server_.getSession(playerId_);
     server_.registerSession(playerId_, shared_from_this());
-    
-    send(response);
+
+    // 同一账号的旧连接（重复登录或未检测到的半开连接）由新连接顶替
+    if (previous && previous.get() != this) {
+        previous->close();
+    }
+
+    // 玩家仍在房间中：先回登录响应，再补发房间最近一次的完整状态作为关键帧
+    auto& roomMgr = Sanguosha::Room::RoomManager::Instance();
+    uint32_t roomId = roomMgr.roomIdOf(playerId_);
+    if (roomId == 0) {
+        reply(requestId, response);
+        return;
+    }
+    login_res->set_room_id(roomId);
+    reply(requestId, response);
+    roomMgr.onPlayerReconnected(playerId_, shared_from_this());
 }
 
-void Session::handleRoomRequest(const sanguosha::RoomRequest& request) {
+void Session::handleRoomRequest(const sanguosha::RoomRequest& request, uint32_t requestId) {
     sanguosha::GameMessage response;
     response.set_type(sanguosha::ROOM_RESPONSE);
     auto* room_res = response.mutable_room_response();
     
     auto& roomMgr = Sanguosha::Room::RoomManager::Instance();
+    if (request.action() != sanguosha::LEAVE_ROOM && !roomMgr.acceptingGames()) {
+        room_res->set_success(false);
+        room_res->set_error_message("Server is shutting down");
+        reply(requestId, response);
+        return;
+    }
     
     switch (request.action()) {
         case sanguosha::CREATE_ROOM: {
-            uint32_t roomId = roomMgr.createRoom();
+            uint32_t capacity = request.max_players() != 0 ? request.max_players()
+                                                           : Sanguosha::Room::Room::MIN_PLAYERS;
+            uint32_t roomId = roomMgr.createRoom(capacity);
             if (roomMgr.joinRoom(roomId, playerId_)) {
                 room_res->set_success(true);
                 room_res->mutable_room_info()->set_room_id(roomId);
+                if (auto room = roomMgr.getRoom(roomId)) {
+                    room_res->mutable_room_info()->set_max_players(room->capacity());
+                }
             } else {
                 room_res->set_success(false);
                 room_res->set_error_message("Create room failed");
@@ -218,40 +549,61 @@ void Session::handleRoomRequest(const sanguosha::RoomRequest& request) {
             break;
         }
         case sanguosha::START_GAME: {
-            room_res->set_success(false);
-            room_res->set_error_message("Start game is automatically handled");
+            // 坐满会自动开始；房主也可以在人数达到下限后提前开始
+            if (roomMgr.startRoom(request.room_id(), playerId_)) {
+                room_res->set_success(true);
+                room_res->mutable_room_info()->set_room_id(request.room_id());
+            } else {
+                room_res->set_success(false);
+                room_res->set_error_message("Only the room owner can start a room with enough players");
+            }
+            break;
+        }
+        case sanguosha::LEAVE_ROOM: {
+            // 停机排空期间也允许离开；对局中离开按判负处理
+            if (roomMgr.leaveRoom(request.room_id(), playerId_)) {
+                room_res->set_success(true);
+                room_res->mutable_room_info()->set_room_id(request.room_id());
+            } else {
+                room_res->set_success(false);
+                room_res->set_error_message("Not in this room");
+            }
             break;
         }
+        default:
+            room_res->set_success(false);
+            room_res->set_error_message("Unknown room action");
+            break;
     }
     
+    reply(requestId, response);
+}
+
+void Session::reply(uint32_t requestId, sanguosha::GameMessage& response) {
+    response.set_request_id(requestId);
     send(response);
 }
 
 void Session::send(const sanguosha::GameMessage& msg) {
-    // 计算消息体大小
-    size_t body_size = msg.ByteSizeLong();
-    size_t total_size = 4 + body_size;
-    
-    std::vector<char> buffer(total_size);
-    
-    // 写入消息头（长度）- 使用网络字节序
-    uint32_t net_size = htonl(static_cast<uint32_t>(body_size));
-    memcpy(buffer.data(), &net_size, 4);
-    
-    // 写入消息体
-    if (!msg.SerializeToArray(buffer.data() + 4, body_size)) {
+    // 协商了紧凑编码的连接，支持的类型走定长格式
+    if (capabilities_ & sanguosha::CAPABILITY_COMPACT) {
+        auto frame = std::make_shared<std::vector<char>>();
+        if (MessageCodec::encodeCompact(msg, *frame)) {
+            sendFrame(std::move(frame));
+            return;
+        }
+    }
+
+    // 分帧统一由MessageCodec完成，直接序列化到帧缓冲区
+    auto frame = std::make_shared<std::vector<char>>(MessageCodec::frameSize(msg));
+    auto& buffer = *frame;
+    if (MessageCodec::encodeInto(msg, buffer.data(), buffer.size()) == 0) {
         std::cerr << "Failed to serialize message" << std::endl;
         return;
     }
     
     // 发送完整消息
-    boost::asio::async_write(socket_, boost::asio::buffer(buffer),
-        [self = shared_from_this()](boost::system::error_code ec, size_t) {
-            if (ec) {
-                std::cerr << "Send failed: " << ec.message() << std::endl;
-                // 这里可以添加重连或关闭连接逻辑
-            }
-        });
+    sendFrame(frame);
     std::cout << "Sending message type: " << msg.type() << std::endl;
     if (msg.type() == sanguosha::ROOM_RESPONSE) {
         std::cout << "Room response - success: " << msg.room_response().success() 
@@ -266,36 +618,199 @@ void Session::send(const sanguosha::GameMessage& msg) {
     std::cout << std::dec << "..." << std::endl;
 }
 
-void Session::handleRoomListRequest() {
+void Session::sendFrame(std::shared_ptr<const std::vector<char>> frame, FrameKind kind) {
+    // 发送队列只在会话所在的io线程上操作；已在该线程上时直接执行，不必为投递再持有一份会话引用
+    auto& io = server_.getIoContext();
+    if (io.get_executor().running_in_this_thread()) {
+        enqueueFrame(std::move(frame), kind);
+        return;
+    }
+    boost::asio::post(io,
+        [self = shared_from_this(), frame = std::move(frame), kind]() mutable {
+            self->enqueueFrame(std::move(frame), kind);
+        });
+}
+
+void Session::enqueueFrame(std::shared_ptr<const std::vector<char>> frame, FrameKind kind) {
+    if (closed_) {
+        return;
+    }
+    // 紧凑编码的帧不是protobuf，不能放进BATCH
+    if (coalescing_ && kind == FrameKind::CONTROL &&
+        !MessageCodec::isCompact(frame->data() + MessageCodec::HEADER_LENGTH,
+                                 frame->size() - MessageCodec::HEADER_LENGTH)) {
+        coalesced_.push_back(std::move(frame));
+        return;
+    }
+    // 状态帧不合并，但不能越过之前攒下的响应
+    flushCoalesced();
+
+    // 客户端读得太慢，积压超过上限时按策略腾出空间，腾不出来就断开
+    auto& metrics = server_.outboundMetrics();
+    size_t size = frame->size();
+    if (outboundBytes_ + size > server_.config().maxOutboundBytes && !makeRoom(size, kind)) {
+        std::cerr << "Slow consumer, player " << playerId_ << " has " << outboundBytes_
+                  << " bytes queued, closing" << std::endl;
+        metrics.slowConsumerDisconnects.fetch_add(1, std::memory_order_relaxed);
+        close();
+        return;
+    }
+
+    outbox_.push_back({std::move(frame), kind});
+    outboundBytes_ += size;
+    metrics.queuedBytes.fetch_add(size, std::memory_order_relaxed);
+    metrics.recordDepth(outboundBytes_);
+    if (inFlight_ == 0) {
+        doWrite();
+    }
+}
+
+bool Session::makeRoom(size_t incoming, FrameKind kind) {
+    const auto& config = server_.config();
+    size_t limit = config.maxOutboundBytes;
+    if (outbox_.empty()) {
+        return true; // 单帧超过上限也允许发送，只限制积压
+    }
+
+    // 正在写的队首帧不能动
+    size_t first = inFlight_;
+    switch (config.outboundPolicy) {
+        case OutboundPolicy::DISCONNECT:
+            return false;
+        case OutboundPolicy::DROP_OLDEST_STATE:
+            for (size_t i = first; i < outbox_.size() && outboundBytes_ + incoming > limit;) {
+                if (outbox_[i].kind == FrameKind::STATE) {
+                    dropQueuedFrame(i);
+                } else {
+                    ++i;
+                }
+            }
+            break;
+        case OutboundPolicy::LATEST_KEYFRAME: {
+            // 状态帧都是完整快照：新帧也是快照时旧的全部作废，否则只保留最新的一帧
+            size_t keep = outbox_.size();
+            if (kind != FrameKind::STATE) {
+                for (size_t i = first; i < outbox_.size(); ++i) {
+                    if (outbox_[i].kind == FrameKind::STATE) {
+                        keep = i;
+                    }
+                }
+            }
+            for (size_t i = first; i < outbox_.size();) {
+                if (outbox_[i].kind == FrameKind::STATE && i != keep) {
+                    dropQueuedFrame(i);
+                    if (i < keep) {
+                        --keep;
+                    }
+                } else {
+                    ++i;
+                }
+            }
+            break;
+        }
+    }
+    return outboundBytes_ + incoming <= limit;
+}
+
+void Session::flushCoalesced() {
+    if (coalesced_.empty()) {
+        return;
+    }
+    std::shared_ptr<const std::vector<char>> frame;
+    if (coalesced_.size() == 1) {
+        frame = std::move(coalesced_.front());
+    } else {
+        frame = std::make_shared<std::vector<char>>(MessageCodec::encodeBatch(coalesced_));
+    }
+    coalesced_.clear();
+
+    bool coalescing = coalescing_;
+    coalescing_ = false;
+    enqueueFrame(std::move(frame), FrameKind::CONTROL);
+    coalescing_ = coalescing;
+}
+
+void Session::dropQueuedFrame(size_t index) {
+    size_t size = outbox_[index].frame->size();
+    outboundBytes_ -= size;
+    auto& metrics = server_.outboundMetrics();
+    metrics.queuedBytes.fetch_sub(size, std::memory_order_relaxed);
+    metrics.droppedFrames.fetch_add(1, std::memory_order_relaxed);
+    outbox_.erase(outbox_.begin() + index);
+}
+
+void Session::doWrite() {
+    // 把队列里已有的帧合并成一次写，流水线请求的多个响应只需一次系统调用。
+    // 正在写的帧留在队首，丢弃策略和clearOutbox都不会动它们，写完才移除
+    inFlight_ = std::min(outbox_.size(), MAX_GATHER_FRAMES);
+    inFlightBytes_ = 0; // 按压缩前的大小计入发送队列
+    writeBuffers_.clear();
+    compressedFrames_.clear();
+    compressedFrames_.reserve(inFlight_); // 保证下面取到的压缩帧地址不会因扩容失效
+    for (size_t i = 0; i < inFlight_; ++i) {
+        const auto& frame = *outbox_[i].frame;
+        inFlightBytes_ += frame.size();
+        if (compressor_ && frame.size() >= MessageCodec::HEADER_LENGTH + server_.config().compressThreshold) {
+            compressedFrames_.push_back(compressor_->compress(frame));
+            const auto& compressed = compressedFrames_.back();
+            auto& metrics = server_.outboundMetrics();
+            metrics.compressedFrames.fetch_add(1, std::memory_order_relaxed);
+            metrics.bytesBeforeCompression.fetch_add(frame.size(), std::memory_order_relaxed);
+            metrics.bytesAfterCompression.fetch_add(compressed.size(), std::memory_order_relaxed);
+            writeBuffers_.emplace_back(boost::asio::buffer(compressed));
+        } else {
+            writeBuffers_.emplace_back(boost::asio::buffer(frame));
+        }
+    }
+    BufferRange range{writeBuffers_.data(), writeBuffers_.data() + writeBuffers_.size()};
+    boost::asio::async_write(socket_, range, withHandlerMemory(writeHandlerMemory_,
+        [this, self = shared_from_this()](boost::system::error_code ec, size_t) {
+            outbox_.erase(outbox_.begin(), outbox_.begin() + std::min(inFlight_, outbox_.size()));
+            outboundBytes_ -= inFlightBytes_;
+            server_.outboundMetrics().queuedBytes.fetch_sub(inFlightBytes_, std::memory_order_relaxed);
+            inFlight_ = 0;
+            inFlightBytes_ = 0;
+            if (ec || closed_) {
+                if (ec && ec != boost::asio::error::operation_aborted) {
+                    std::cerr << "Send failed: " << ec.message() << std::endl;
+                }
+                clearOutbox();
+                close();
+                return;
+            }
+            if (!outbox_.empty()) {
+                doWrite();
+            }
+        }));
+}
+
+void Session::clearOutbox() {
+    // 正在写的帧等写回调里再移除
+    auto first = outbox_.begin() + inFlight_;
+    size_t bytes = 0;
+    for (auto it = first; it != outbox_.end(); ++it) {
+        bytes += it->frame->size();
+    }
+    outbox_.erase(first, outbox_.end());
+    outboundBytes_ -= bytes;
+    server_.outboundMetrics().queuedBytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void Session::handleRoomListRequest(uint32_t requestId) {
     auto& roomMgr = Sanguosha::Room::RoomManager::Instance();
     
     sanguosha::GameMessage response;
     response.set_type(sanguosha::ROOM_LIST_RESPONSE);
     auto* roomListRes = response.mutable_room_list_response();
     
-    // 获取所有房间信息
-    std::lock_guard<std::mutex> lock(roomMgr.getMutex());
-    for (const auto& [roomId, room] : roomMgr.getRooms()) {
-        sanguosha::RoomInfo* roomInfo = roomListRes->add_rooms();
-        roomInfo->set_room_id(room->id());
-        roomInfo->set_current_players(room->playerCount());
-        roomInfo->set_max_players(2);
-        
-        // 修复：使用完全限定的枚举名称
-        roomInfo->set_status(room->state() == Sanguosha::Room::Room::State::WAITING ? 
-                           sanguosha::WAITING : sanguosha::PLAYING);
-        
-        const auto& players = room->getPlayers();
-        for (uint32_t playerId : players) {
-            roomInfo->add_players(playerId);
-        }
-    }
+    // 获取所有房间信息（包括休眠的房间）
+    roomMgr.listRooms(roomListRes);
     
-    send(response);
+    reply(requestId, response);
 }
 
 // 在 Session 类中添加处理游戏动作的方法
-void Session::handleGameAction(const sanguosha::GameAction& action) {
+void Session::handleGameAction(const sanguosha::GameAction& action, uint32_t requestId) {
     if (playerId_ == 0) {
         std::cerr << "Player not logged in" << std::endl;
         return;
@@ -324,7 +839,7 @@ void Session::handleGameAction(const sanguosha::GameAction& action) {
         response.set_type(sanguosha::GAME_OVER);
         auto* gameOver = response.mutable_game_over();
         gameOver->set_winner_id(gameInstance->getWinner());
-        send(response);
+        reply(requestId, response);
         return;
     }
     
@@ -337,7 +852,16 @@ void Session::handleGameAction(const sanguosha::GameAction& action) {
         response.set_type(sanguosha::GAME_STATE);
         auto* gameState = response.mutable_game_state();
         gameState->set_game_log("操作无效");
-        send(response);
+        reply(requestId, response);
+        return;
+    }
+
+    // 状态变化已经广播；带了request_id的请求另外确认，流水线发送的客户端据此对上号
+    if (requestId != 0) {
+        sanguosha::GameMessage response;
+        response.set_type(sanguosha::ACTION_RESULT);
+        response.mutable_action_result()->set_success(true);
+        reply(requestId, response);
     }
 }
 
@@ -7,14 +7,23 @@
 namespace Sanguosha {
 namespace Room {
 
-Room::Room(uint32_t id) : id_(id), state_(State::WAITING) {}
+static_assert(Room::MAX_PLAYERS == sanguosha::GameInstance::MAX_SEATS,
+              "room capacity must match game seats");
+
+Room::Room(uint32_t id, uint32_t capacity)
+    : id_(id),
+      capacity_(std::min(std::max(capacity, MIN_PLAYERS), MAX_PLAYERS)),
+      state_(State::WAITING) {}
 
 bool Room::addPlayer(uint32_t playerId) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (players_.size() >= 2)
+    if (players_.size() >= capacity_)
+        return false;
+    if (std::find(players_.begin(), players_.end(), playerId) != players_.end())
         return false;
     
     players_.push_back(playerId);
+    sessions_.emplace_back();
     return true;
 }
 
@@ -24,35 +33,76 @@ bool Room::removePlayer(uint32_t playerId) {
     if (it == players_.end())
         return false;
     
+    sessions_.erase(sessions_.begin() + (it - players_.begin()));
     players_.erase(it);
     return true;
 }
 
-// room.cpp - 修改startGame函数
-bool Room::startGame(RoomManager& roomManager, Sanguosha::Network::Server& server) {
+void Room::bindSession(uint32_t playerId, std::weak_ptr<Sanguosha::Network::Session> session) {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (players_.size() != 2 || state_ != State::WAITING) {
-        return false;
+    auto it = std::find(players_.begin(), players_.end(), playerId);
+    if (it != players_.end()) {
+        sessions_[it - players_.begin()] = std::move(session);
     }
-    state_ = State::PLAYING;
-    
-    gameInstance_ = std::make_shared<sanguosha::GameInstance>(id_, roomManager, server);
-    gameInstance_->startGame(players_);
+}
+
+std::vector<std::shared_ptr<Sanguosha::Network::Session>> Room::getSessions() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::shared_ptr<Sanguosha::Network::Session>> sessions;
+    sessions.reserve(sessions_.size());
+    for (const auto& weak : sessions_) {
+        if (auto session = weak.lock()) {
+            sessions.push_back(std::move(session));
+        }
+    }
+    return sessions;
+}
+
+void Room::setStateFrame(std::shared_ptr<const std::vector<char>> frame) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stateFrame_ = std::move(frame);
+}
+
+std::shared_ptr<const std::vector<char>> Room::stateFrame() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stateFrame_;
+}
+
+// room.cpp - 修改startGame函数
+bool Room::startGame(RoomManager& roomManager, Sanguosha::Network::Server& server) {
+    std::shared_ptr<sanguosha::GameInstance> game;
+    std::vector<uint32_t> players;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (players_.size() < MIN_PLAYERS || state_ != State::WAITING) {
+            return false;
+        }
+        state_ = State::PLAYING;
+        
+        gameInstance_ = std::make_shared<sanguosha::GameInstance>(id_, roomManager, server);
+        game = gameInstance_;
+        players = players_;
+    } // 开局会广播，广播需要再次获取房间锁
+    game->startGame(players);
+    roomManager.journalRoom(*this);
     
     // 广播游戏开始消息
     sanguosha::GameStart gameStartMsg;
     gameStartMsg.set_room_id(id_); // 确保设置正确的房间ID
-    for (auto playerId : players_) {
+    for (auto playerId : players) {
         gameStartMsg.add_player_ids(playerId);
     }
     
     // 使用正确的消息类型
-    roomManager.broadcastMessage(id_, sanguosha::GAME_START, gameStartMsg, server);
+    roomManager.broadcastMessage(id_, sanguosha::GAME_START, gameStartMsg);
     
     return true;
 }
 
 uint32_t Room::playerCount() const { return players_.size(); }
+uint32_t Room::capacity() const { return capacity_; }
+bool Room::isFull() const { return players_.size() >= capacity_; }
+uint32_t Room::owner() const { return players_.empty() ? 0 : players_.front(); }
 uint32_t Room::id() const { return id_; }
 Room::State Room::state() const { return state_; }
 
@@ -61,5 +111,33 @@ const std::vector<uint32_t>& Room::getPlayers() const { return players_; }
 bool Room::isPlaying() const { return state_ == State::PLAYING; }
 std::shared_ptr<sanguosha::GameInstance> Room::getGameInstance() const { return gameInstance_; }
 
+void Room::saveSnapshot(sanguosha::RoomSnapshot* snapshot) {
+    std::shared_ptr<sanguosha::GameInstance> game;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        snapshot->set_room_id(id_);
+        snapshot->set_capacity(capacity_);
+        snapshot->mutable_players()->Add(players_.begin(), players_.end());
+        game = gameInstance_;
+    }
+    if (game) {
+        game->saveSnapshot(snapshot->mutable_game());
+    }
+}
+
+std::shared_ptr<Room> Room::fromSnapshot(const sanguosha::RoomSnapshot& snapshot, RoomManager& roomManager,
+                                         Sanguosha::Network::Server& server) {
+    auto room = std::make_shared<Room>(snapshot.room_id(), snapshot.capacity());
+    for (uint32_t playerId : snapshot.players()) {
+        room->addPlayer(playerId);
+    }
+    if (snapshot.has_game()) {
+        room->state_ = State::PLAYING;
+        room->gameInstance_ = std::make_shared<sanguosha::GameInstance>(room->id_, roomManager, server);
+        room->gameInstance_->restoreSnapshot(snapshot.game());
+    }
+    return room;
+}
+
 } // namespace Room
 } // namespace Sanguosha
\ No newline at end of file
@@ -0,0 +1,340 @@
+#include "room/room_journal.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace Sanguosha {
+namespace Room {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x53475253; // "SGRS"
+const char* const SNAPSHOT_FILE = "rooms.snapshot";
+const char* const WAL_PREFIX = "rooms.wal.";
+
+[[noreturn]] void throwErrno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+uint32_t checksum(const std::string& payload) {
+    return static_cast<uint32_t>(::crc32(0L, reinterpret_cast<const Bytef*>(payload.data()),
+                                         static_cast<uInt>(payload.size())));
+}
+
+void putU32(std::string& out, uint32_t value) {
+    char bytes[4];
+    std::memcpy(bytes, &value, sizeof(value));
+    out.append(bytes, sizeof(bytes));
+}
+
+uint32_t getU32(const char* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+// 一条记录：长度 + CRC32 + protobuf编码
+void appendFrame(std::string& out, const std::string& payload) {
+    putU32(out, static_cast<uint32_t>(payload.size()));
+    putU32(out, checksum(payload));
+    out += payload;
+}
+
+// 从offset处读出一条完整且校验通过的记录；末尾写了一半或损坏时返回false
+bool nextFrame(const std::string& data, size_t& offset, std::string& payload) {
+    if (data.size() - offset < 8) {
+        return false;
+    }
+    uint32_t size = getU32(data.data() + offset);
+    uint32_t crc = getU32(data.data() + offset + 4);
+    if (data.size() - offset - 8 < size) {
+        return false;
+    }
+    payload.assign(data, offset + 8, size);
+    if (checksum(payload) != crc) {
+        return false;
+    }
+    offset += 8 + size;
+    return true;
+}
+
+std::string readFile(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// 文件名为rooms.wal.<N>时返回true并取出N
+bool parseWalName(const std::string& name, uint64_t& generation) {
+    size_t prefix = std::strlen(WAL_PREFIX);
+    if (name.size() <= prefix || name.compare(0, prefix, WAL_PREFIX) != 0 ||
+        name.find_first_not_of("0123456789", prefix) != std::string::npos || name.size() - prefix > 18) {
+        return false;
+    }
+    generation = std::stoull(name.substr(prefix));
+    return true;
+}
+
+std::vector<uint64_t> listWalGenerations(const std::string& directory) {
+    std::vector<uint64_t> generations;
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        uint64_t generation = 0;
+        if (parseWalName(entry.path().filename().string(), generation)) {
+            generations.push_back(generation);
+        }
+    }
+    std::sort(generations.begin(), generations.end());
+    return generations;
+}
+
+bool readSnapshot(const std::string& directory, sanguosha::RoomManagerSnapshot& snapshot) {
+    std::string data = readFile(fs::path(directory) / SNAPSHOT_FILE);
+    size_t offset = 4;
+    std::string payload;
+    return data.size() >= 4 && getU32(data.data()) == SNAPSHOT_MAGIC &&
+           nextFrame(data, offset, payload) && snapshot.ParseFromString(payload);
+}
+
+void syncDirectory(const std::string& directory) {
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+        ::fsync(fd);
+        ::close(fd);
+    }
+}
+
+} // namespace
+
+RoomJournal::Recovery RoomJournal::recover(const std::string& directory) {
+    Recovery recovery;
+    if (!readSnapshot(directory, recovery.snapshot)) {
+        recovery.snapshot.Clear();
+    }
+
+    // 快照之后可能有不止一代日志（新一代日志建好后、快照rename之前崩溃），按代数顺序回放
+    for (uint64_t generation : listWalGenerations(directory)) {
+        if (generation < recovery.snapshot.generation()) {
+            continue;
+        }
+        std::string data = readFile(fs::path(directory) / (WAL_PREFIX + std::to_string(generation)));
+        size_t offset = 0;
+        std::string payload;
+        while (nextFrame(data, offset, payload)) {
+            sanguosha::RoomJournalRecord record;
+            if (!record.ParseFromString(payload)) {
+                break;
+            }
+            recovery.records.push_back(std::move(record));
+        }
+        if (offset != data.size()) {
+            std::cerr << "Room journal generation " << generation << ": discarded "
+                      << (data.size() - offset) << " trailing bytes" << std::endl;
+        }
+    }
+    return recovery;
+}
+
+RoomJournal::RoomJournal(const std::string& directory) : directory_(directory) {
+    fs::create_directories(directory_);
+
+    // 新的代数要比目录里已有的都大，旧进程留下的文件不会被误当成新日志
+    sanguosha::RoomManagerSnapshot existing;
+    if (readSnapshot(directory_, existing)) {
+        generation_ = existing.generation();
+    }
+    auto generations = listWalGenerations(directory_);
+    if (!generations.empty()) {
+        generation_ = std::max(generation_, generations.back());
+    }
+    writer_ = std::thread([this]() { run(); });
+}
+
+RoomJournal::~RoomJournal() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_one();
+    writer_.join();
+}
+
+void RoomJournal::append(const sanguosha::RoomJournalRecord& record) {
+    std::string payload = record.SerializeAsString();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+        tasks_.emplace_back();
+        ++enqueued_;
+        wakeup_.notify_one();
+    }
+    appendFrame(tasks_.back().records, payload);
+}
+
+void RoomJournal::writeSnapshot(std::unique_ptr<sanguosha::RoomManagerSnapshot> snapshot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    snapshot->set_generation(++generation_);
+    tasks_.emplace_back();
+    tasks_.back().snapshot = std::move(snapshot);
+    ++enqueued_;
+    wakeup_.notify_one();
+}
+
+void RoomJournal::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t target = enqueued_;
+    ++flushWaiters_;
+    wakeup_.notify_one();
+    flushed_.wait(lock, [this, target]() { return completed_ >= target; });
+    --flushWaiters_;
+}
+
+uint64_t RoomJournal::generation() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return generation_;
+}
+
+void RoomJournal::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wakeup_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            break;
+        }
+        // 攒一个批次再写；有人在等落盘或正在退出时立即写
+        wakeup_.wait_for(lock, FLUSH_INTERVAL, [this]() { return stopping_ || flushWaiters_ > 0; });
+        std::deque<Task> batch;
+        batch.swap(tasks_);
+        lock.unlock();
+
+        for (auto& task : batch) {
+            try {
+                process(task);
+            } catch (const std::exception& e) {
+                reportError(e);
+            }
+        }
+        if (walFd_ >= 0 && ::fdatasync(walFd_) != 0) {
+            reportError(std::system_error(errno, std::generic_category(), "fdatasync " + walPath(walGeneration_)));
+        }
+
+        lock.lock();
+        completed_ += batch.size();
+        flushed_.notify_all();
+    }
+    if (walFd_ >= 0) {
+        ::close(walFd_);
+        walFd_ = -1;
+    }
+}
+
+void RoomJournal::process(Task& task) {
+    if (task.snapshot) {
+        // 快照写失败时后面的事件照样写进当前这一代日志
+        try {
+            rotate(*task.snapshot);
+        } catch (const std::exception& e) {
+            reportError(e);
+        }
+    }
+    if (task.records.empty()) {
+        return;
+    }
+    if (walFd_ < 0) {
+        throw std::runtime_error("room journal has no open log (no snapshot written yet)");
+    }
+    writeAll(walFd_, task.records, walPath(walGeneration_));
+}
+
+void RoomJournal::rotate(sanguosha::RoomManagerSnapshot& snapshot) {
+    uint64_t generation = snapshot.generation();
+    std::string bytes;
+    putU32(bytes, SNAPSHOT_MAGIC);
+    appendFrame(bytes, snapshot.SerializeAsString());
+
+    std::string path = (fs::path(directory_) / SNAPSHOT_FILE).string();
+    std::string tmpPath = path + ".tmp";
+    int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throwErrno("open " + tmpPath);
+    }
+    try {
+        writeAll(fd, bytes, tmpPath);
+        if (::fsync(fd) != 0) {
+            throwErrno("fsync " + tmpPath);
+        }
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    ::close(fd);
+
+    // 快照替换之前建好新一代日志，替换之后的事件都写进它。任何一步失败都留在旧快照和旧日志上，
+    // 事件继续追加到旧日志，恢复时照样从旧快照回放
+    std::string wal = walPath(generation);
+    int walFd = ::open(wal.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_APPEND | O_CLOEXEC, 0644);
+    if (walFd < 0) {
+        throwErrno("open " + wal);
+    }
+    if (::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        int error = errno;
+        ::close(walFd);
+        ::unlink(wal.c_str());
+        throw std::system_error(error, std::generic_category(), "rename " + tmpPath);
+    }
+    syncDirectory(directory_);
+
+    if (walFd_ >= 0) {
+        ::fdatasync(walFd_);
+        ::close(walFd_);
+    }
+    walFd_ = walFd;
+    walGeneration_ = generation;
+
+    // 新快照已经落盘，更早的日志不再需要
+    for (uint64_t old : listWalGenerations(directory_)) {
+        if (old < generation) {
+            ::unlink(walPath(old).c_str());
+        }
+    }
+}
+
+void RoomJournal::writeAll(int fd, const std::string& bytes, const std::string& path) {
+    const char* data = bytes.data();
+    size_t remaining = bytes.size();
+    while (remaining > 0) {
+        ssize_t n = ::write(fd, data, remaining);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            throwErrno("write " + path);
+        }
+        data += n;
+        remaining -= static_cast<size_t>(n);
+    }
+}
+
+std::string RoomJournal::walPath(uint64_t generation) const {
+    return (fs::path(directory_) / (WAL_PREFIX + std::to_string(generation))).string();
+}
+
+void RoomJournal::reportError(const std::exception& e) {
+    // 持久化失败不影响正在进行的游戏，只是崩溃后恢复不到最新状态
+    if (!failed_) {
+        std::cerr << "Room journal write failed: " << e.what() << std::endl;
+        failed_ = true;
+    }
+}
+
+} // namespace Room
+} // namespace Sanguosha
@@ -1,54 +1,106 @@
 #include "room/room_manager.h"
 #include "room/room.h"
+#include "room/room_journal.h"
 #include "network/server.h"
+#include "network/message_codec.h"
+#include "game/mcts_bot.h"
+#include "game/game_instance.h"
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <stdexcept>
 
 namespace Sanguosha {
 namespace Room {
 
-// 静态成员初始化
-boost::asio::io_context RoomManager::dummy_io_context_;
+namespace {
 
-RoomManager::RoomManager() 
-    : io_(nullptr),
-      cleanupTimer_(std::make_unique<boost::asio::steady_timer>(dummy_io_context_)) {
-}
-
-RoomManager::~RoomManager() {
-    if (cleanupTimer_) {
-        boost::system::error_code ec;
-        cleanupTimer_->cancel(ec);
+void fillRoomInfo(sanguosha::RoomInfo* roomInfo, uint32_t roomId, const std::vector<uint32_t>& players,
+                  uint32_t capacity, bool playing) {
+    roomInfo->set_room_id(roomId);
+    roomInfo->set_current_players(players.size());
+    roomInfo->set_max_players(capacity);
+    roomInfo->set_status(playing ? sanguosha::PLAYING : sanguosha::WAITING);
+    for (uint32_t playerId : players) {
+        roomInfo->add_players(playerId);
     }
 }
 
+} // namespace
+
+RoomManager::RoomManager() = default;
+
+RoomManager::~RoomManager() = default;
+
 RoomManager& RoomManager::Instance() {
     static RoomManager instance;
     return instance;
 }
 
-uint32_t RoomManager::createRoom() {
-    return createRoom({});
+uint32_t RoomManager::createRoom(uint32_t capacity) {
+    return createRoom(std::vector<uint32_t>{}, capacity);
 }
 
 void RoomManager::setServer(Sanguosha::Network::Server& server) {
     serverPtr_ = &server;
 }
 
-uint32_t RoomManager::createRoom(const std::vector<uint32_t>& playerIds) {
+uint32_t RoomManager::createRoom(const std::vector<uint32_t>& playerIds, uint32_t capacity) {
     std::lock_guard<std::mutex> lock(mutex_);
+    if (!acceptingGames_) {
+        return 0;
+    }
     uint32_t roomId = nextRoomId_++;
     
-    auto room = std::make_shared<Room>(roomId);
+    auto room = std::make_shared<Room>(roomId, capacity);
     for (auto playerId : playerIds) {
-        room->addPlayer(playerId);
+        if (room->addPlayer(playerId) && serverPtr_ != nullptr) {
+            room->bindSession(playerId, serverPtr_->getSession(playerId));
+        }
     }
     
     rooms_[roomId] = room;
+    indexPlayersLocked(roomId, room->getPlayers());
+    journalRoom(*room);
+    scheduleBotFill(roomId);
+    scheduleIdleCheck(roomId, room->activity());
     return roomId;
 }
 
+void RoomManager::scheduleBotFill(uint32_t roomId) {
+    if (serverPtr_ == nullptr) {
+        return;
+    }
+    serverPtr_->getTimerWheel().schedule(std::chrono::milliseconds(BOT_FILL_DELAY_MS), [this, roomId]() {
+        fillWithBots(roomId);
+    });
+}
+
+void RoomManager::fillWithBots(uint32_t roomId) {
+    std::shared_ptr<Room> room;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        room = findRoomLocked(roomId);
+        if (!room) {
+            return;
+        }
+        // 只给还有真人在等待的房间补位
+        if (!acceptingGames_ || room->state() != Room::State::WAITING || room->playerCount() == 0 || room->isFull()) {
+            return;
+        }
+        while (!room->isFull()) {
+            room->addPlayer(sanguosha::BOT_ID_BASE | (nextBotId_++ & ~sanguosha::BOT_ID_BASE));
+        }
+        indexPlayersLocked(roomId, room->getPlayers());
+        journalRoom(*room);
+    }
+
+    std::cout << "Filled room " << roomId << " with bots" << std::endl;
+    if (serverPtr_ != nullptr && room->startGame(*this, *serverPtr_)) {
+        std::cout << "Game started successfully in room " << roomId << std::endl;
+    }
+}
+
 bool RoomManager::joinRoom(uint32_t roomId, uint32_t playerId) {
     std::shared_ptr<Room> room;
     bool shouldStartGame = false;
@@ -56,19 +108,29 @@ bool RoomManager::joinRoom(uint32_t roomId, uint32_t playerId) {
     {
         std::lock_guard<std::mutex> lock(mutex_);
         std::cout << "Attempting to join room " << roomId << " with player " << playerId << std::endl;
+        if (!acceptingGames_) {
+            return false;
+        }
         
-        auto it = rooms_.find(roomId);
-        if (it == rooms_.end()) {
+        room = findRoomLocked(roomId);
+        if (!room) {
             std::cout << "Room not found: " << roomId << std::endl;
             return false;
         }
         
-        room = it->second;
         bool success = room->addPlayer(playerId);
         std::cout << "Join room result: " << success << std::endl;
+        if (success && serverPtr_ != nullptr) {
+            room->bindSession(playerId, serverPtr_->getSession(playerId));
+        }
+        if (success) {
+            playerRooms_[playerId] = roomId;
+            room->touch();
+            journalRoom(*room);
+        }
         
-        // 检查是否需要开始游戏
-        if (success && room->playerCount() == 2 && room->state() == Room::State::WAITING) {
+        // 坐满后自动开始游戏
+        if (success && room->isFull() && room->state() == Room::State::WAITING) {
             std::cout << "Room is full, will start game" << std::endl;
             shouldStartGame = true;
         }
@@ -90,136 +152,571 @@ bool RoomManager::joinRoom(uint32_t roomId, uint32_t playerId) {
     return true;
 }
 
+bool RoomManager::startRoom(uint32_t roomId, uint32_t playerId) {
+    std::shared_ptr<Room> room = getRoom(roomId);
+    if (!room) {
+        return false;
+    }
+
+    if (!acceptingGames_ || room->owner() != playerId || serverPtr_ == nullptr) {
+        return false;
+    }
+    return room->startGame(*this, *serverPtr_);
+}
+
 bool RoomManager::leaveRoom(uint32_t roomId, uint32_t playerId) {
+    // 对局中离开按判负处理；判负会广播，广播需要mutex_，所以在加锁之前做
+    if (auto room = getRoom(roomId)) {
+        auto game = room->getGameInstance();
+        const auto& players = room->getPlayers();
+        if (game && !game->isGameOver() && std::find(players.begin(), players.end(), playerId) != players.end()) {
+            game->forfeitPlayer(playerId);
+        }
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
-    auto it = rooms_.find(roomId);
-    if (it == rooms_.end()) {
+    auto room = findRoomLocked(roomId);
+    if (!room || !room->removePlayer(playerId)) {
         return false;
     }
-    return it->second->removePlayer(playerId);
+    auto indexed = playerRooms_.find(playerId);
+    if (indexed != playerRooms_.end() && indexed->second == roomId) {
+        playerRooms_.erase(indexed);
+    }
+    // 最后一个人离开时立即回收
+    if (room->playerCount() == 0) {
+        removeRoomLocked(roomId);
+        std::cout << "Room " << roomId << " closed (empty)" << std::endl;
+        return true;
+    }
+    room->touch();
+    journalRoom(*room);
+    return true;
+}
+
+bool RoomManager::closeRoom(uint32_t roomId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!rooms_.count(roomId) && !hibernated_.count(roomId)) {
+        return false;
+    }
+    removeRoomLocked(roomId);
+    std::cout << "Room " << roomId << " closed" << std::endl;
+    return true;
 }
 
 // 修复：使用完整类型替代别名
 std::shared_ptr<Room> RoomManager::getRoom(uint32_t roomId) {
     std::lock_guard<std::mutex> lock(mutex_);
-    auto it = rooms_.find(roomId);
-    return it != rooms_.end() ? it->second : nullptr;
+    return findRoomLocked(roomId);
 }
 
 // 保持实现但已添加声明
 uint32_t RoomManager::matchPlayers(const std::vector<uint32_t>& playerIds) {
-    if (playerIds.empty()) return 0;
+    if (playerIds.empty() || !acceptingGames_) return 0;
     
     // 1. 尝试找到合适的现有房间
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        auto seat = [&](uint32_t roomId, Room& room) {
+            for (auto playerId : playerIds) {
+                room.addPlayer(playerId);
+            }
+            indexPlayersLocked(roomId, room.getPlayers());
+            room.touch();
+            journalRoom(room);
+        };
         
         for (auto& [id, room] : rooms_) {
             if (room->state() == Room::State::WAITING && 
-                room->playerCount() < 8 && 
-                room->playerCount() + playerIds.size() <= 8) {
-                
-                // 加入房间
-                for (auto playerId : playerIds) {
-                    room->addPlayer(playerId);
-                }
+                room->playerCount() + playerIds.size() <= room->capacity()) {
+                seat(id, *room);
                 return id;
             }
         }
+        // 休眠中的等人房间同样可以加入
+        for (const auto& [id, hibernated] : hibernated_) {
+            if (!hibernated.playing && hibernated.players.size() + playerIds.size() <= hibernated.capacity) {
+                uint32_t roomId = id; // 唤醒会移除这条记录
+                auto room = wakeLocked(roomId);
+                seat(roomId, *room);
+                return roomId;
+            }
+        }
     }
     
     // 2. 没有合适房间则创建新房间
-    return createRoom(playerIds);
+    return createRoom(playerIds, Room::MAX_PLAYERS);
 }
 
 std::shared_ptr<Room> RoomManager::getRoomByPlayerId(uint32_t playerId) {
     std::lock_guard<std::mutex> lock(mutex_);
-    for (const auto& [roomId, room] : rooms_) {
-        const auto& players = room->getPlayers();
-        if (std::find(players.begin(), players.end(), playerId) != players.end()) {
-            return room;
+    auto it = playerRooms_.find(playerId);
+    return it != playerRooms_.end() ? findRoomLocked(it->second) : nullptr;
+}
+
+uint32_t RoomManager::roomIdOf(uint32_t playerId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = playerRooms_.find(playerId);
+    return it != playerRooms_.end() ? it->second : 0;
+}
+
+void RoomManager::onPlayerReconnected(uint32_t playerId, const std::shared_ptr<Network::Session>& session) {
+    std::shared_ptr<Room> room;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto indexed = playerRooms_.find(playerId);
+        if (indexed == playerRooms_.end()) {
+            return;
         }
+        // 休眠的等人房间不必唤醒：唤醒时会按在线情况重新绑定会话，这里只补发关键帧。
+        // 休眠的游戏正在等这个玩家，要唤醒
+        auto hibernated = hibernated_.find(indexed->second);
+        if (hibernated != hibernated_.end() && !hibernated->second.playing) {
+            if (hibernated->second.stateFrame) {
+                session->sendFrame(hibernated->second.stateFrame, Network::Session::FrameKind::STATE);
+            }
+            std::cout << "Player " << playerId << " resumed in room " << indexed->second << std::endl;
+            return;
+        }
+        room = findRoomLocked(indexed->second);
+    }
+    if (!room) {
+        return;
     }
-    return nullptr;
+    room->bindSession(playerId, session);
+    room->touch();
+
+    // 补发缓存的完整状态帧，不需要为重连的玩家重新序列化
+    if (auto frame = room->stateFrame()) {
+        session->sendFrame(frame, Network::Session::FrameKind::STATE);
+    }
+    if (auto game = room->getGameInstance()) {
+        game->onPlayerReconnected(playerId);
+    }
+    std::cout << "Player " << playerId << " resumed in room " << room->id() << std::endl;
 }
 
-void RoomManager::setIoContext(boost::asio::io_context& io) {
-    io_ = &io;
-    
-    // 创建新的定时器
-    cleanupTimer_ = std::make_unique<boost::asio::steady_timer>(*io_);
+void RoomManager::onPlayerAbandoned(uint32_t playerId) {
+    uint32_t roomId = roomIdOf(playerId);
+    if (roomId == 0) {
+        return;
+    }
+    // 判负或离开都要改动房间，休眠的房间在这里唤醒
+    auto room = getRoom(roomId);
+    if (!room) {
+        return;
+    }
+    if (auto game = room->getGameInstance()) {
+        game->forfeitPlayer(playerId);
+    } else {
+        leaveRoom(roomId, playerId);
+    }
 }
 
-void RoomManager::startCleanupTask() {
-    if (!io_ || !cleanupTimer_) return;
-    
-    cleanupTimer_->expires_after(std::chrono::minutes(5));
-    cleanupTimer_->async_wait([this](const boost::system::error_code& ec) {
-        if (!ec) {
-            cleanupRooms();
-            startCleanupTask();
+size_t RoomManager::stopMatchmaking() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    acceptingGames_ = false;
+    std::vector<uint32_t> waiting;
+    for (const auto& [roomId, room] : rooms_) {
+        if (room->state() == Room::State::WAITING) {
+            waiting.push_back(roomId);
+        }
+    }
+    for (const auto& [roomId, hibernated] : hibernated_) {
+        if (!hibernated.playing) {
+            waiting.push_back(roomId);
+        }
+    }
+    for (uint32_t roomId : waiting) {
+        removeRoomLocked(roomId);
+    }
+    return waiting.size();
+}
+
+size_t RoomManager::activeGameCount() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t count = 0;
+    for (const auto& [roomId, room] : rooms_) {
+        auto game = room->getGameInstance();
+        if (game && !game->isGameOver()) {
+            ++count;
+        }
+    }
+    for (const auto& [roomId, hibernated] : hibernated_) {
+        if (hibernated.playing) {
+            ++count;
         }
+    }
+    return count;
+}
+
+size_t RoomManager::hibernatedRoomCount() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hibernated_.size();
+}
+
+void RoomManager::listRooms(sanguosha::RoomListResponse* response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [roomId, room] : rooms_) {
+        fillRoomInfo(response->add_rooms(), roomId, room->getPlayers(), room->capacity(),
+                     room->state() == Room::State::PLAYING);
+    }
+    for (const auto& [roomId, hibernated] : hibernated_) {
+        fillRoomInfo(response->add_rooms(), roomId, hibernated.players, hibernated.capacity, hibernated.playing);
+    }
+}
+
+std::shared_ptr<Room> RoomManager::findRoomLocked(uint32_t roomId) {
+    auto it = rooms_.find(roomId);
+    if (it != rooms_.end()) {
+        return it->second;
+    }
+    return wakeLocked(roomId);
+}
+
+void RoomManager::scheduleIdleCheck(uint32_t roomId, uint64_t activity) {
+    if (serverPtr_ == nullptr) {
+        return;
+    }
+    auto idle = std::chrono::milliseconds(serverPtr_->config().hibernateIdleMs);
+    serverPtr_->getTimerWheel().schedule(idle, [this, roomId, activity]() {
+        checkIdle(roomId, activity);
     });
 }
 
-void RoomManager::cleanupRooms() {
+void RoomManager::checkIdle(uint32_t roomId, uint64_t activity) {
     std::lock_guard<std::mutex> lock(mutex_);
-    auto it = rooms_.begin();
-    while (it != rooms_.end()) {
-        // 清理条件：房间为空
-        if (it->second->playerCount() == 0) {
-            it = rooms_.erase(it);
+    auto it = rooms_.find(roomId);
+    if (it == rooms_.end()) {
+        return; // 已回收或已休眠，检查随之结束
+    }
+    auto room = it->second;
+    if (room->activity() != activity) {
+        scheduleIdleCheck(roomId, room->activity());
+        return;
+    }
+
+    auto game = room->getGameInstance();
+    if (!game) {
+        if (room->playerCount() == 0) {
+            // 建好后没人进来（例如建房后入房失败）的空房间
+            removeRoomLocked(roomId);
+            std::cout << "Room " << roomId << " closed (empty)" << std::endl;
         } else {
-            ++it;
+            hibernateLocked(room);
         }
+        return;
+    }
+    if (game->isGameOver()) {
+        return; // 结束时已经安排了关闭
+    }
+    // 轮到在线玩家或机器人时对局随时会推进，不休眠
+    if (game->awaitingDisconnectedPlayer()) {
+        hibernateLocked(room);
+    } else {
+        scheduleIdleCheck(roomId, activity);
     }
 }
 
-void RoomManager::broadcastMessage(uint32_t roomId, sanguosha::MessageType type, const google::protobuf::Message& message, Network::Server& server) {
+void RoomManager::hibernateLocked(const std::shared_ptr<Room>& room) {
+    uint32_t roomId = room->id();
+    sanguosha::RoomSnapshot snapshot;
+    room->saveSnapshot(&snapshot);
+
+    HibernatedRoom hibernated;
+    hibernated.capacity = room->capacity();
+    hibernated.players = room->getPlayers();
+    hibernated.stateFrame = room->stateFrame();
+    if (auto game = room->getGameInstance()) {
+        hibernated.playing = true;
+        hibernated.turnDeadline = game->turnDeadline();
+        hibernated.responseDeadline = game->responseDeadline();
+        // 截止时间到了自己醒来，按原来的时限超时
+        auto wakeAt = hibernated.turnDeadline;
+        if (game->isAwaitingResponse()) {
+            wakeAt = std::min(wakeAt, hibernated.responseDeadline);
+        }
+        auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::max(wakeAt - std::chrono::steady_clock::now(), std::chrono::steady_clock::duration::zero()));
+        hibernated.wakeTimer = serverPtr_->getTimerWheel().schedule(delay, [this, roomId]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            wakeLocked(roomId);
+        });
+    }
+    snapshot.SerializeToString(&hibernated.record);
+
+    rooms_.erase(roomId);
+    hibernated_[roomId] = std::move(hibernated);
+    std::cout << "Room " << roomId << " hibernated" << std::endl;
+}
+
+std::shared_ptr<Room> RoomManager::wakeLocked(uint32_t roomId) {
+    auto it = hibernated_.find(roomId);
+    if (it == hibernated_.end()) {
+        return nullptr;
+    }
+    HibernatedRoom hibernated = std::move(it->second);
+    hibernated_.erase(it);
+    serverPtr_->getTimerWheel().cancel(hibernated.wakeTimer);
+
+    sanguosha::RoomSnapshot snapshot;
+    snapshot.ParseFromString(hibernated.record);
+    auto room = Room::fromSnapshot(snapshot, *this, *serverPtr_);
+    room->setStateFrame(std::move(hibernated.stateFrame));
+    // 会话绑定没有保存，按当前在线情况重新绑定
+    for (uint32_t playerId : room->getPlayers()) {
+        room->bindSession(playerId, serverPtr_->getSession(playerId));
+    }
+    if (auto game = room->getGameInstance()) {
+        game->resumeTimers(hibernated.turnDeadline, hibernated.responseDeadline);
+    }
+    rooms_[roomId] = room;
+    scheduleIdleCheck(roomId, room->activity());
+    std::cout << "Room " << roomId << " woke up" << std::endl;
+    return room;
+}
+
+void RoomManager::removeRoomLocked(uint32_t roomId) {
     std::vector<uint32_t> players;
+    auto live = rooms_.find(roomId);
+    if (live != rooms_.end()) {
+        players = live->second->getPlayers();
+        rooms_.erase(live);
+    } else {
+        auto hibernated = hibernated_.find(roomId);
+        if (hibernated == hibernated_.end()) {
+            return;
+        }
+        players = hibernated->second.players;
+        if (serverPtr_ != nullptr) {
+            serverPtr_->getTimerWheel().cancel(hibernated->second.wakeTimer);
+        }
+        hibernated_.erase(hibernated);
+    }
+    for (uint32_t playerId : players) {
+        auto indexed = playerRooms_.find(playerId);
+        if (indexed != playerRooms_.end() && indexed->second == roomId) {
+            playerRooms_.erase(indexed);
+        }
+    }
+    journalClosed(roomId);
+}
+
+void RoomManager::indexPlayersLocked(uint32_t roomId, const std::vector<uint32_t>& players) {
+    for (uint32_t playerId : players) {
+        playerRooms_[playerId] = roomId;
+    }
+}
+
+size_t RoomManager::restore(const std::string& directory) {
+    if (serverPtr_ == nullptr) {
+        throw std::logic_error("RoomManager::restore requires setServer()");
+    }
+    auto recovery = RoomJournal::recover(directory);
     {
         std::lock_guard<std::mutex> lock(mutex_);
+        nextRoomId_ = std::max(nextRoomId_, recovery.snapshot.next_room_id());
+        nextBotId_ = std::max(nextBotId_, recovery.snapshot.next_bot_id());
+        for (const auto& saved : recovery.snapshot.rooms()) {
+            adoptRestoredRoom(saved);
+        }
+    }
+    // 回放时游戏会广播状态，广播需要获取mutex_，所以逐条回放时不持锁
+    for (const auto& record : recovery.records) {
+        applyJournalRecord(record);
+    }
+
+    std::vector<std::shared_ptr<Room>> rooms;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [roomId, room] : rooms_) {
+            rooms.push_back(room);
+        }
+    }
+    size_t restored = 0;
+    for (const auto& room : rooms) {
+        auto game = room->getGameInstance();
+        if ((game && game->isGameOver()) || room->playerCount() == 0) {
+            closeRoom(room->id());
+            continue;
+        }
+        ++restored;
+        scheduleIdleCheck(room->id(), room->activity());
+        if (game) {
+            game->resumeAfterRestore();
+        } else {
+            scheduleBotFill(room->id());
+        }
+        for (uint32_t playerId : room->getPlayers()) {
+            if (!sanguosha::isBotPlayer(playerId)) {
+                serverPtr_->holdSeat(playerId);
+            }
+        }
+    }
+    std::cout << "Restored " << restored << " rooms (snapshot generation "
+              << recovery.snapshot.generation() << ", " << recovery.records.size()
+              << " journal records replayed)" << std::endl;
+    return restored;
+}
+
+void RoomManager::adoptRestoredRoom(const sanguosha::RoomSnapshot& snapshot) {
+    // 同一房间的新状态取代旧状态，离开的玩家不再指向这个房间
+    if (rooms_.count(snapshot.room_id())) {
+        removeRoomLocked(snapshot.room_id());
+    }
+    rooms_[snapshot.room_id()] = Room::fromSnapshot(snapshot, *this, *serverPtr_);
+    indexPlayersLocked(snapshot.room_id(), std::vector<uint32_t>(snapshot.players().begin(), snapshot.players().end()));
+    nextRoomId_ = std::max(nextRoomId_, snapshot.room_id() + 1);
+    for (uint32_t playerId : snapshot.players()) {
+        if (sanguosha::isBotPlayer(playerId)) {
+            nextBotId_ = std::max(nextBotId_, (playerId & ~sanguosha::BOT_ID_BASE) + 1);
+        }
+    }
+}
+
+void RoomManager::applyJournalRecord(const sanguosha::RoomJournalRecord& record) {
+    switch (record.kind()) {
+        case sanguosha::RoomJournalRecord::ROOM_STATE: {
+            std::lock_guard<std::mutex> lock(mutex_);
+            adoptRestoredRoom(record.room());
+            break;
+        }
+        case sanguosha::RoomJournalRecord::ROOM_CLOSED: {
+            std::lock_guard<std::mutex> lock(mutex_);
+            removeRoomLocked(record.room_id());
+            break;
+        }
+        default:
+            if (auto room = getRoom(record.room_id())) {
+                if (auto game = room->getGameInstance()) {
+                    game->replay(record);
+                }
+            }
+            break;
+    }
+}
+
+void RoomManager::enableJournal(const std::string& directory) {
+    journal_ = std::make_unique<RoomJournal>(directory);
+    // 第一份快照包含恢复出来的全部状态，之后旧的日志就可以删掉了
+    snapshot();
+}
+
+void RoomManager::disableJournal() {
+    if (!journal_) {
+        return;
+    }
+    snapshot();
+    journal_.reset(); // 析构时写完排队的内容
+}
+
+void RoomManager::snapshot() {
+    if (!journal_) {
+        return;
+    }
+    // 在io线程上只做拷贝（每个房间几百字节），序列化和写盘在日志的后台线程上
+    auto snapshot = std::make_unique<sanguosha::RoomManagerSnapshot>();
+    std::vector<std::shared_ptr<Room>> rooms;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        snapshot->set_next_room_id(nextRoomId_);
+        snapshot->set_next_bot_id(nextBotId_);
+        rooms.reserve(rooms_.size());
+        for (const auto& [roomId, room] : rooms_) {
+            rooms.push_back(room);
+        }
+        // 休眠的房间已经是编码好的快照
+        for (const auto& [roomId, hibernated] : hibernated_) {
+            snapshot->add_rooms()->ParseFromString(hibernated.record);
+        }
+    }
+    for (const auto& room : rooms) {
+        auto game = room->getGameInstance();
+        if ((game && game->isGameOver()) || room->playerCount() == 0) {
+            continue; // 马上会被回收的房间不必保存
+        }
+        room->saveSnapshot(snapshot->add_rooms());
+    }
+    journal_->writeSnapshot(std::move(snapshot));
+}
+
+void RoomManager::journalRoom(Room& room) {
+    if (!journal_) {
+        return;
+    }
+    sanguosha::RoomJournalRecord record;
+    record.set_kind(sanguosha::RoomJournalRecord::ROOM_STATE);
+    record.set_room_id(room.id());
+    room.saveSnapshot(record.mutable_room());
+    journal_->append(record);
+}
+
+void RoomManager::journalClosed(uint32_t roomId) {
+    if (!journal_) {
+        return;
+    }
+    sanguosha::RoomJournalRecord record;
+    record.set_kind(sanguosha::RoomJournalRecord::ROOM_CLOSED);
+    record.set_room_id(roomId);
+    journal_->append(record);
+}
+
+void RoomManager::journalGameEvent(const sanguosha::RoomJournalRecord& record) {
+    if (journal_) {
+        journal_->append(record);
+    }
+}
+
+void RoomManager::broadcastMessage(uint32_t roomId, sanguosha::MessageType type, const google::protobuf::Message& message) {
+    std::shared_ptr<Room> room;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // 休眠的房间没有人在等消息，不为广播唤醒
         auto it = rooms_.find(roomId);
         if (it == rooms_.end()) {
             return;
         }
-        players = it->second->getPlayers();
+        room = it->second;
     } // 释放锁后再发送消息
+    room->touch();
     
-    sanguosha::GameMessage gameMsg;
-    gameMsg.set_type(type);
-    
-    // 根据不同的消息类型，设置对应的字段
+    // 根据不同的消息类型，确定payload在GameMessage中的字段编号
+    int fieldNumber = 0;
+    const char* expectedType = nullptr;
     switch (type) {
         case sanguosha::GAME_STATE:
-            if (message.GetTypeName() == "sanguosha.GameState") {
-                gameMsg.mutable_game_state()->CopyFrom(dynamic_cast<const sanguosha::GameState&>(message));
-            }
+            fieldNumber = sanguosha::GameMessage::kGameStateFieldNumber;
+            expectedType = "sanguosha.GameState";
             break;
         case sanguosha::GAME_START:
-            if (message.GetTypeName() == "sanguosha.GameStart") {
-                gameMsg.mutable_game_start()->CopyFrom(dynamic_cast<const sanguosha::GameStart&>(message));
-            }
+            fieldNumber = sanguosha::GameMessage::kGameStartFieldNumber;
+            expectedType = "sanguosha.GameStart";
             break;
         case sanguosha::ROOM_RESPONSE:
-            if (message.GetTypeName() == "sanguosha.RoomResponse") {
-                gameMsg.mutable_room_response()->CopyFrom(dynamic_cast<const sanguosha::RoomResponse&>(message));
-            }
+            fieldNumber = sanguosha::GameMessage::kRoomResponseFieldNumber;
+            expectedType = "sanguosha.RoomResponse";
             break;
         case sanguosha::GAME_OVER:
-            if (message.GetTypeName() == "sanguosha.GameOver") {
-                gameMsg.mutable_game_over()->CopyFrom(dynamic_cast<const sanguosha::GameOver&>(message));
-            }
+            fieldNumber = sanguosha::GameMessage::kGameOverFieldNumber;
+            expectedType = "sanguosha.GameOver";
             break;
         default:
             std::cerr << "Unknown message type for broadcast: " << type << std::endl;
             return;
     }
+    const google::protobuf::MessageLite* payload = message.GetTypeName() == expectedType ? &message : nullptr;
 
-    for (uint32_t playerId : players) {
-        if (auto session = server.getSession(playerId)) {
-            session->send(gameMsg);
-        }
+    // 只序列化一次，所有座位共享同一帧；payload直接编码进帧，不再拷贝进GameMessage
+    auto frame = std::make_shared<const std::vector<char>>(
+        Network::MessageCodec::encodeEnvelope(type, fieldNumber, payload));
+    if (type == sanguosha::GAME_STATE) {
+        room->setStateFrame(frame);
+    }
+    // 广播的游戏状态是完整快照，慢速客户端积压时可以被更新的快照取代
+    auto kind = type == sanguosha::GAME_STATE ? Network::Session::FrameKind::STATE
+                                               : Network::Session::FrameKind::CONTROL;
+    for (const auto& session : room->getSessions()) {
+        session->sendFrame(frame, kind);
     }
 }
 
@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include "common/buffer_pool.h"
+
+using Sanguosha::Common::BufferPool;
+
+TEST(BufferPoolTest, RoundsUpToSizeClass) {
+    BufferPool pool;
+    auto small = pool.acquire(10);
+    EXPECT_EQ(small.size(), 10u);
+    EXPECT_EQ(small.capacity(), BufferPool::MIN_CLASS_SIZE);
+
+    auto medium = pool.acquire(3000);
+    EXPECT_EQ(medium.capacity(), 4096u);
+    std::memset(medium.data(), 0xAB, medium.size());
+
+    auto none = pool.acquire(0);
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.data(), nullptr);
+}
+
+TEST(BufferPoolTest, ReusesReleasedBuffers) {
+    BufferPool pool;
+    const char* first;
+    {
+        auto buffer = pool.acquire(100);
+        first = buffer.data();
+    }
+    EXPECT_EQ(pool.cachedBytes(), BufferPool::MIN_CLASS_SIZE);
+
+    auto again = pool.acquire(200);
+    EXPECT_EQ(again.data(), first);
+    EXPECT_EQ(pool.hits(), 1u);
+    EXPECT_EQ(pool.misses(), 1u);
+    EXPECT_EQ(pool.cachedBytes(), 0u);
+}
+
+TEST(BufferPoolTest, CachedBytesAreBounded) {
+    BufferPool pool(1024); // 每级最多缓存1KB
+    std::vector<BufferPool::Buffer> buffers;
+    for (int i = 0; i < 10; ++i) {
+        buffers.push_back(pool.acquire(256));
+    }
+    buffers.push_back(pool.acquire(2 * 1024 * 1024)); // 超出最大分级，不走池
+    buffers.clear();
+    EXPECT_EQ(pool.cachedBytes(), 1024u);
+}
+
+TEST(BufferPoolTest, MoveTransfersOwnership) {
+    BufferPool pool;
+    auto a = pool.acquire(50);
+    char* data = a.data();
+    BufferPool::Buffer b = std::move(a);
+    EXPECT_EQ(a.data(), nullptr);
+    EXPECT_EQ(b.data(), data);
+    b.reset();
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(pool.cachedBytes(), BufferPool::MIN_CLASS_SIZE);
+}
@@ -0,0 +1,28 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "common/cpu_topology.h"
+
+using namespace Sanguosha::Common;
+
+TEST(CpuTopologyTest, ParsesAndFormatsCpuLists) {
+    EXPECT_EQ(parseCpuList("0-3,8,10-11"), (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(parseCpuList("5"), (std::vector<int>{5}));
+    EXPECT_EQ(formatCpuList({0, 1, 2, 3, 8, 10, 11}), "0-3,8,10-11");
+    EXPECT_EQ(formatCpuList({}), "");
+
+    EXPECT_THROW(parseCpuList(""), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("1,x"), std::invalid_argument);
+    EXPECT_THROW(parseCpuList("-2"), std::invalid_argument);
+}
+
+TEST(CpuTopologyTest, PinsToAnAllowedCpu) {
+    auto topology = CpuTopology::detect();
+    ASSERT_FALSE(topology.allowedCpus().empty());
+    EXPECT_GE(topology.nodeCount(), 1u);
+
+    int cpu = topology.allowedCpus().front();
+    EXPECT_TRUE(topology.isAllowed(cpu));
+    EXPECT_NO_THROW(pinCurrentThread(cpu));
+    EXPECT_THROW(pinCurrentThread(-1), std::system_error);
+}
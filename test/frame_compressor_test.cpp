@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "network/frame_compressor.h"
+#include "network/message_codec.h"
+
+using Sanguosha::Network::FrameCompressor;
+using Sanguosha::Network::FrameDecompressor;
+using Sanguosha::Network::MessageCodec;
+
+namespace {
+
+sanguosha::GameMessage makeState(uint32_t players, uint32_t current) {
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::GAME_STATE);
+    auto* state = msg.mutable_game_state();
+    state->set_current_player(current);
+    state->set_phase(sanguosha::PLAY_PHASE);
+    for (uint32_t seat = 0; seat < players; ++seat) {
+        auto* player = state->add_players();
+        player->set_player_id(2000 + seat);
+        player->set_hp(3);
+        player->set_max_hp(4);
+        player->set_seat(seat);
+        for (int card = 0; card < 5; ++card) {
+            player->add_hand_cards(card % 3 + 1);
+        }
+    }
+    state->set_game_log("玩家 " + std::to_string(current) + " 的回合开始");
+    return msg;
+}
+
+} // namespace
+
+TEST(FrameCompressorTest, StreamRoundTripAndShrinks) {
+    FrameCompressor compressor;
+    FrameDecompressor decompressor;
+
+    for (uint32_t turn = 0; turn < 5; ++turn) {
+        auto msg = makeState(8, 2000 + turn);
+        auto frame = MessageCodec::encode(msg);
+        auto compressed = compressor.compress(frame);
+        EXPECT_LT(compressed.size(), frame.size());
+
+        const char* body = compressed.data() + MessageCodec::HEADER_LENGTH;
+        size_t size = compressed.size() - MessageCodec::HEADER_LENGTH;
+        EXPECT_EQ(static_cast<uint8_t>(body[0]), MessageCodec::COMPRESSED);
+
+        std::string plain;
+        ASSERT_TRUE(decompressor.decompress(body, size, plain));
+        sanguosha::GameMessage decoded;
+        ASSERT_TRUE(decoded.ParseFromString(plain));
+        EXPECT_EQ(decoded.game_state().current_player(), 2000 + turn);
+        EXPECT_EQ(decoded.game_state().players_size(), 8);
+    }
+}
+
+TEST(FrameCompressorTest, LaterFramesReuseStreamHistory) {
+    FrameCompressor compressor;
+    auto frame = MessageCodec::encode(makeState(8, 2003));
+    size_t first = compressor.compress(frame).size();
+    size_t repeat = compressor.compress(frame).size();
+    EXPECT_LT(repeat, first);
+}
+
+TEST(FrameCompressorTest, DictionaryIsStable) {
+    EXPECT_FALSE(FrameCompressor::dictionary().empty());
+    EXPECT_LE(FrameCompressor::dictionary().size(), 32u * 1024);
+    EXPECT_EQ(FrameCompressor::dictionaryId(), FrameCompressor::dictionaryId());
+}
@@ -0,0 +1,533 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "game/game_instance.h"
+#include "network/server.h"
+#include "room/room_manager.h"
+
+using namespace sanguosha;
+using Sanguosha::Network::Server;
+using Sanguosha::Network::ServerConfig;
+using Sanguosha::Room::RoomManager;
+
+class GameInstanceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        config.userStorePath = ::testing::TempDir() + "game_instance_test_" + std::to_string(::getpid()) + ".db";
+        // 缩短时限，计时相关的用例直接驱动io_context
+        config.timerTickMs = 10;
+        config.responseTimeoutMs = 100;
+        config.turnTimeoutMs = 300;
+        server = std::make_unique<Server>(config);
+        RoomManager::Instance().setServer(*server);
+    }
+    void TearDown() override {
+        server.reset();
+        std::remove(config.userStorePath.c_str());
+    }
+
+    // 不在房间表里的游戏：广播直接丢弃，只检查游戏自身的状态
+    std::shared_ptr<GameInstance> makeGame(const GameSnapshot& snapshot) {
+        auto game = std::make_shared<GameInstance>(1, RoomManager::Instance(), *server);
+        game->restoreSnapshot(snapshot);
+        return game;
+    }
+
+    void runFor(std::chrono::milliseconds duration) {
+        server->getIoContext().restart();
+        server->getIoContext().run_for(duration);
+    }
+
+    ServerConfig config;
+    std::unique_ptr<Server> server;
+};
+
+namespace {
+
+void addSeat(GameSnapshot& snapshot, uint32_t playerId, Role role, std::initializer_list<uint32_t> cards) {
+    auto* seat = snapshot.add_seats();
+    seat->set_player_id(playerId);
+    seat->set_hp(4);
+    seat->set_max_hp(4);
+    seat->set_role(role);
+    for (uint32_t card : cards) {
+        seat->add_hand_cards(card);
+    }
+}
+
+GameAction attack(uint32_t target) {
+    GameAction action;
+    action.set_type(ACTION_PLAY_CARD);
+    action.set_card_id(CARD_ATTACK);
+    action.set_target_player(target);
+    return action;
+}
+
+GameAction respond(CardType card, uint32_t promptId = 0) {
+    GameAction action;
+    action.set_type(ACTION_RESPOND);
+    action.set_card_id(card);
+    action.set_prompt_id(promptId);
+    return action;
+}
+
+int countCards(const PlayerState& state, CardType card) {
+    int count = 0;
+    for (uint32_t held : state.hand_cards()) {
+        count += held == static_cast<uint32_t>(card);
+    }
+    return count;
+}
+
+// 按当前局面打一回合：受了伤就吃桃，最多对下家出两张杀，然后结束回合；log非空时把每个操作记进去
+void playTurn(GameInstance& game, std::vector<RoomJournalRecord>* log = nullptr) {
+    GameSnapshot state;
+    game.saveSnapshot(&state);
+    const PlayerState& seat = state.seats(state.current_seat());
+    uint32_t target = state.seats((state.current_seat() + 1) % state.seats_size()).player_id();
+
+    std::vector<GameAction> actions;
+    int heals = std::min(countCards(seat, CARD_HEAL), static_cast<int>(seat.max_hp() - seat.hp()));
+    for (int i = 0; i < heals; ++i) {
+        GameAction heal;
+        heal.set_type(ACTION_PLAY_CARD);
+        heal.set_card_id(CARD_HEAL);
+        actions.push_back(heal);
+    }
+    for (int i = 0; i < std::min(countCards(seat, CARD_ATTACK), 2); ++i) {
+        actions.push_back(attack(target));
+    }
+    GameAction endTurn;
+    endTurn.set_type(ACTION_END_TURN);
+    actions.push_back(endTurn);
+
+    for (const auto& action : actions) {
+        EXPECT_TRUE(game.processPlayerAction(seat.player_id(), action));
+        if (log != nullptr) {
+            RoomJournalRecord record;
+            record.set_kind(RoomJournalRecord::GAME_ACTION);
+            record.set_room_id(1);
+            record.set_player_id(seat.player_id());
+            *record.mutable_action() = action;
+            log->push_back(record);
+        }
+    }
+}
+
+std::vector<uint32_t> cards(const google::protobuf::RepeatedField<uint32_t>& field) {
+    return std::vector<uint32_t>(field.begin(), field.end());
+}
+
+// 牌堆、弃牌堆、各座位的手牌和体力、当前座位都相同
+void expectSameGame(GameInstance& expected, GameInstance& actual) {
+    GameSnapshot a, b;
+    expected.saveSnapshot(&a);
+    actual.saveSnapshot(&b);
+    EXPECT_EQ(a.current_seat(), b.current_seat());
+    EXPECT_EQ(cards(a.deck()), cards(b.deck()));
+    EXPECT_EQ(cards(a.discard_pile()), cards(b.discard_pile()));
+    ASSERT_EQ(a.seats_size(), b.seats_size());
+    for (int seat = 0; seat < a.seats_size(); ++seat) {
+        EXPECT_EQ(cards(a.seats(seat).hand_cards()), cards(b.seats(seat).hand_cards())) << "seat " << seat;
+        EXPECT_EQ(a.seats(seat).hp(), b.seats(seat).hp()) << "seat " << seat;
+    }
+    EXPECT_EQ(a.rng_draws(), b.rng_draws());
+}
+
+} // namespace
+
+TEST_F(GameInstanceTest, AttackerForfeitingDuringResponseWindowPassesTheTurn) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_REBEL, {CARD_ATTACK});
+    addSeat(snapshot, 1002, ROLE_LORD, {CARD_DEFEND});
+    addSeat(snapshot, 1003, ROLE_REBEL, {});
+    snapshot.set_alive_mask(0b111);
+    snapshot.set_current_seat(0);
+    for (int i = 0; i < 10; ++i) {
+        snapshot.add_deck(CARD_ATTACK);
+    }
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+
+    ASSERT_TRUE(game->processPlayerAction(1001, attack(1002)));
+    ASSERT_TRUE(game->isAwaitingResponse());
+    // 出杀的一方在目标响应之前断线判负，回合要等响应结算后才能切换
+    game->forfeitPlayer(1001);
+    ASSERT_TRUE(game->isAwaitingResponse());
+    ASSERT_TRUE(game->processPlayerAction(1002, respond(CARD_DEFEND)));
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_FALSE(game->isGameOver());
+    EXPECT_FALSE(game->isAwaitingResponse());
+    EXPECT_EQ(after.alive_mask(), 0b110u);
+    EXPECT_EQ(after.current_seat(), 1u);
+}
+
+TEST_F(GameInstanceTest, TargetForfeitingResolvesTheAttackWithoutDodge) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {CARD_ATTACK});
+    addSeat(snapshot, 1002, ROLE_REBEL, {CARD_DEFEND});
+    addSeat(snapshot, 1003, ROLE_RENEGADE, {});
+    snapshot.set_alive_mask(0b111);
+    snapshot.set_current_seat(0);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+
+    ASSERT_TRUE(game->processPlayerAction(1001, attack(1002)));
+    game->forfeitPlayer(1002);
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_FALSE(game->isGameOver());
+    EXPECT_FALSE(game->isAwaitingResponse());
+    EXPECT_EQ(after.alive_mask(), 0b101u);
+    EXPECT_EQ(after.current_seat(), 0u); // 当前玩家还活着，回合继续
+}
+
+TEST_F(GameInstanceTest, DodgeInsideResponseWindowCancelsDamage) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {CARD_ATTACK});
+    addSeat(snapshot, 1002, ROLE_REBEL, {CARD_DEFEND});
+    snapshot.set_alive_mask(0b11);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+
+    ASSERT_TRUE(game->processPlayerAction(1001, attack(1002)));
+    ASSERT_TRUE(game->isAwaitingResponse());
+    ASSERT_TRUE(game->processPlayerAction(1002, respond(CARD_DEFEND, 1)));
+    EXPECT_FALSE(game->isAwaitingResponse());
+    // 窗口已经关闭，原来的截止时间到了也不能再扣血
+    runFor(std::chrono::milliseconds(300));
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_EQ(after.seats(1).hp(), 4u);
+    EXPECT_EQ(countCards(after.seats(1), CARD_DEFEND), 0);
+}
+
+TEST_F(GameInstanceTest, ResponseWindowExpiryAppliesDamage) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {CARD_ATTACK});
+    addSeat(snapshot, 1002, ROLE_REBEL, {CARD_DEFEND});
+    snapshot.set_alive_mask(0b11);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+
+    ASSERT_TRUE(game->processPlayerAction(1001, attack(1002)));
+    ASSERT_TRUE(game->isAwaitingResponse());
+    runFor(std::chrono::milliseconds(300));
+    EXPECT_FALSE(game->isAwaitingResponse());
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_EQ(after.seats(1).hp(), 3u);
+    EXPECT_EQ(countCards(after.seats(1), CARD_DEFEND), 1); // 超时按不出闪处理，闪还在手里
+    EXPECT_EQ(after.current_seat(), 0u);
+}
+
+TEST_F(GameInstanceTest, LateResponseIsRejected) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {CARD_ATTACK, CARD_ATTACK});
+    addSeat(snapshot, 1002, ROLE_REBEL, {CARD_DEFEND, CARD_DEFEND});
+    snapshot.set_alive_mask(0b11);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+
+    ASSERT_TRUE(game->processPlayerAction(1001, attack(1002)));
+    runFor(std::chrono::milliseconds(300));
+    ASSERT_FALSE(game->isAwaitingResponse());
+    // 窗口已经超时结算，迟到的闪不被接受
+    EXPECT_FALSE(game->processPlayerAction(1002, respond(CARD_DEFEND, 1)));
+
+    // 新窗口里带着上一个提示编号的响应同样是过期的
+    ASSERT_TRUE(game->processPlayerAction(1001, attack(1002)));
+    ASSERT_TRUE(game->isAwaitingResponse());
+    EXPECT_FALSE(game->processPlayerAction(1002, respond(CARD_DEFEND, 1)));
+    EXPECT_TRUE(game->isAwaitingResponse());
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_EQ(after.seats(1).hp(), 3u);
+    EXPECT_EQ(countCards(after.seats(1), CARD_DEFEND), 2);
+}
+
+TEST_F(GameInstanceTest, TurnDeadlineDiscardsDownToHpAndPassesTheTurn) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {CARD_ATTACK, CARD_DEFEND, CARD_HEAL, CARD_ATTACK, CARD_DEFEND});
+    addSeat(snapshot, 1002, ROLE_REBEL, {});
+    snapshot.mutable_seats(0)->set_hp(2);
+    snapshot.set_alive_mask(0b11);
+    for (int i = 0; i < 10; ++i) {
+        snapshot.add_deck(CARD_HEAL);
+    }
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+    game->resumeAfterRestore();
+
+    runFor(std::chrono::milliseconds(200));
+    GameSnapshot before;
+    game->saveSnapshot(&before);
+    EXPECT_EQ(before.current_seat(), 0u);
+    EXPECT_EQ(before.seats(0).hand_cards_size(), 5);
+
+    runFor(std::chrono::milliseconds(150));
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_EQ(after.current_seat(), 1u);
+    // 从最后摸到的牌开始弃，留下的手牌数等于体力值
+    ASSERT_EQ(after.seats(0).hand_cards_size(), 2);
+    EXPECT_EQ(after.seats(0).hand_cards(0), static_cast<uint32_t>(CARD_ATTACK));
+    EXPECT_EQ(after.seats(0).hand_cards(1), static_cast<uint32_t>(CARD_DEFEND));
+    EXPECT_EQ(after.discard_pile_size(), 3);
+    EXPECT_EQ(after.consecutive_timeouts(0), 1u);
+    EXPECT_EQ(after.seats(1).hand_cards_size(), 2); // 下一位玩家摸了2张牌
+}
+
+TEST_F(GameInstanceTest, StaleTurnTimeoutIsIgnored) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {});
+    addSeat(snapshot, 1002, ROLE_REBEL, {});
+    snapshot.set_alive_mask(0b11);
+    for (int i = 0; i < 10; ++i) {
+        snapshot.add_deck(CARD_HEAL);
+    }
+    snapshot.set_turn_seq(7);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+    game->resumeAfterRestore();
+
+    // 玩家在截止前主动结束回合，原回合的截止时间过后不能再结束下一位玩家的回合
+    runFor(std::chrono::milliseconds(200));
+    GameAction endTurn;
+    endTurn.set_type(ACTION_END_TURN);
+    ASSERT_TRUE(game->processPlayerAction(1001, endTurn));
+    runFor(std::chrono::milliseconds(150));
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_EQ(after.current_seat(), 1u);
+    EXPECT_EQ(after.turn_seq(), 8u);
+    EXPECT_EQ(after.consecutive_timeouts(1), 0u);
+
+    // 带着过期回合序号的超时事件（例如回放的日志）同样被忽略
+    RoomJournalRecord stale;
+    stale.set_kind(RoomJournalRecord::TURN_TIMEOUT);
+    stale.set_sequence(7);
+    game->replay(stale);
+    GameSnapshot replayed;
+    game->saveSnapshot(&replayed);
+    EXPECT_EQ(replayed.current_seat(), 1u);
+    EXPECT_EQ(replayed.turn_seq(), 8u);
+}
+
+TEST_F(GameInstanceTest, ThirdConsecutiveTimeoutForfeits) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {});
+    addSeat(snapshot, 1002, ROLE_REBEL, {});
+    snapshot.set_alive_mask(0b11);
+    for (int i = 0; i < 10; ++i) {
+        snapshot.add_deck(CARD_HEAL);
+    }
+    // 座位0已经连续超时两次
+    snapshot.add_consecutive_timeouts(2);
+    snapshot.add_consecutive_timeouts(0);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+    game->resumeAfterRestore();
+
+    runFor(std::chrono::milliseconds(350));
+    EXPECT_TRUE(game->isGameOver());
+    EXPECT_EQ(game->getWinners(), std::vector<uint32_t>{1002});
+}
+
+TEST_F(GameInstanceTest, ActingResetsTheTimeoutCount) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {});
+    addSeat(snapshot, 1002, ROLE_REBEL, {});
+    snapshot.set_alive_mask(0b11);
+    for (int i = 0; i < 10; ++i) {
+        snapshot.add_deck(CARD_HEAL);
+    }
+    snapshot.add_consecutive_timeouts(2);
+    snapshot.add_consecutive_timeouts(0);
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+    game->resumeAfterRestore();
+
+    // 超时次数只算连续的：中间有过一次操作就重新计数
+    GameAction heal;
+    heal.set_type(ACTION_PLAY_CARD);
+    heal.set_card_id(CARD_HEAL);
+    ASSERT_TRUE(game->processPlayerAction(1001, heal));
+    runFor(std::chrono::milliseconds(350));
+    EXPECT_FALSE(game->isGameOver());
+
+    GameSnapshot after;
+    game->saveSnapshot(&after);
+    EXPECT_EQ(after.current_seat(), 1u);
+    EXPECT_EQ(after.consecutive_timeouts(0), 1u);
+}
+
+TEST_F(GameInstanceTest, RoleCountsFollowPlayerCount) {
+    struct Expected {
+        size_t players;
+        int lords, loyalists, rebels, renegades;
+    };
+    // 2人为1v1没有身份；3~8人身份局
+    const Expected table[] = {
+        {2, 0, 0, 0, 0}, {3, 1, 0, 1, 1}, {4, 1, 1, 1, 1}, {5, 1, 1, 2, 1},
+        {6, 1, 1, 3, 1}, {7, 1, 2, 3, 1}, {8, 1, 2, 4, 1},
+    };
+    for (const auto& expected : table) {
+        SCOPED_TRACE("players=" + std::to_string(expected.players));
+        std::vector<uint32_t> playerIds;
+        for (size_t i = 0; i < expected.players; ++i) {
+            playerIds.push_back(1001 + i);
+        }
+        auto game = std::make_shared<GameInstance>(1, RoomManager::Instance(), *server);
+        game->startGame(playerIds);
+
+        GameSnapshot snapshot;
+        game->saveSnapshot(&snapshot);
+        ASSERT_EQ(snapshot.seats_size(), static_cast<int>(expected.players));
+        int counts[ROLE_RENEGADE + 1] = {};
+        for (const auto& seat : snapshot.seats()) {
+            ++counts[seat.role()];
+        }
+        EXPECT_EQ(counts[ROLE_LORD], expected.lords);
+        EXPECT_EQ(counts[ROLE_LOYALIST], expected.loyalists);
+        EXPECT_EQ(counts[ROLE_REBEL], expected.rebels);
+        EXPECT_EQ(counts[ROLE_RENEGADE], expected.renegades);
+        EXPECT_EQ(snapshot.alive_mask(), (1u << expected.players) - 1);
+    }
+}
+
+TEST_F(GameInstanceTest, LordHasExtraHpAndMovesFirst) {
+    for (size_t players = 2; players <= GameInstance::MAX_SEATS; ++players) {
+        SCOPED_TRACE("players=" + std::to_string(players));
+        std::vector<uint32_t> playerIds;
+        for (size_t i = 0; i < players; ++i) {
+            playerIds.push_back(1001 + i);
+        }
+        auto game = std::make_shared<GameInstance>(1, RoomManager::Instance(), *server);
+        game->startGame(playerIds);
+
+        GameSnapshot snapshot;
+        game->saveSnapshot(&snapshot);
+        // 1v1没有主公，座位0先手
+        uint32_t firstSeat = 0;
+        for (int seat = 0; seat < snapshot.seats_size(); ++seat) {
+            const auto& state = snapshot.seats(seat);
+            bool lord = state.role() == ROLE_LORD;
+            if (lord) {
+                firstSeat = seat;
+            }
+            EXPECT_EQ(state.hp(), lord ? 5u : 4u);
+            EXPECT_EQ(state.max_hp(), lord ? 5u : 4u);
+        }
+        EXPECT_EQ(snapshot.current_seat(), firstSeat);
+        // 起手4张，先手玩家的回合已经开始，多摸了2张
+        for (int seat = 0; seat < snapshot.seats_size(); ++seat) {
+            EXPECT_EQ(snapshot.seats(seat).hand_cards_size(), seat == static_cast<int>(firstSeat) ? 6 : 4);
+        }
+    }
+}
+
+TEST_F(GameInstanceTest, TurnOrderSkipsDeadSeats) {
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {});
+    addSeat(snapshot, 1002, ROLE_LOYALIST, {});
+    addSeat(snapshot, 1003, ROLE_REBEL, {});
+    addSeat(snapshot, 1004, ROLE_RENEGADE, {});
+    addSeat(snapshot, 1005, ROLE_REBEL, {});
+    snapshot.set_alive_mask(0b10101); // 座位1、3已阵亡
+    for (int i = 0; i < 20; ++i) {
+        snapshot.add_deck(CARD_HEAL);
+    }
+    snapshot.set_next_prompt_id(1);
+    auto game = makeGame(snapshot);
+
+    GameAction endTurn;
+    endTurn.set_type(ACTION_END_TURN);
+    auto currentSeat = [&game]() {
+        GameSnapshot state;
+        game->saveSnapshot(&state);
+        return state.current_seat();
+    };
+
+    EXPECT_FALSE(game->processPlayerAction(1002, endTurn)); // 阵亡玩家的操作被拒绝
+    ASSERT_TRUE(game->processPlayerAction(1001, endTurn));
+    EXPECT_EQ(currentSeat(), 2u);
+    ASSERT_TRUE(game->processPlayerAction(1003, endTurn));
+    EXPECT_EQ(currentSeat(), 4u);
+    ASSERT_TRUE(game->processPlayerAction(1005, endTurn));
+    EXPECT_EQ(currentSeat(), 0u); // 绕回最小的存活座位
+
+    // 座位2判负后，座位0的下一位直接是座位4
+    game->forfeitPlayer(1003);
+    ASSERT_FALSE(game->isGameOver());
+    ASSERT_TRUE(game->processPlayerAction(1001, endTurn));
+    EXPECT_EQ(currentSeat(), 4u);
+    ASSERT_TRUE(game->processPlayerAction(1005, endTurn));
+    EXPECT_EQ(currentSeat(), 0u);
+}
+
+TEST_F(GameInstanceTest, RestoredGameReplaysTheLogAndContinuesIdentically) {
+    // 没有闪，不会打开响应窗口；牌堆是空的，第一次摸牌就要洗弃牌堆
+    GameSnapshot snapshot;
+    addSeat(snapshot, 1001, ROLE_LORD, {CARD_ATTACK, CARD_ATTACK});
+    addSeat(snapshot, 1002, ROLE_REBEL, {CARD_ATTACK});
+    addSeat(snapshot, 1003, ROLE_REBEL, {CARD_HEAL});
+    for (auto& seat : *snapshot.mutable_seats()) {
+        seat.set_hp(20);
+        seat.set_max_hp(20);
+    }
+    snapshot.set_alive_mask(0b111);
+    snapshot.set_current_seat(0);
+    for (int i = 0; i < 4; ++i) {
+        snapshot.add_discard_pile(CARD_ATTACK);
+        snapshot.add_discard_pile(CARD_HEAL);
+    }
+    snapshot.set_rng_seed(2024);
+    snapshot.set_turn_seq(1);
+    snapshot.set_next_prompt_id(1);
+    auto live = makeGame(snapshot);
+    auto control = makeGame(snapshot); // 同样的局面和操作，但中途不写快照
+
+    for (int turn = 0; turn < 5; ++turn) {
+        playTurn(*live);
+        playTurn(*control);
+    }
+    GameSnapshot checkpoint;
+    live->saveSnapshot(&checkpoint);
+    EXPECT_GT(checkpoint.rng_draws(), 0u);
+
+    // 快照之后的操作进日志，然后“崩溃”：从快照恢复并回放日志
+    std::vector<RoomJournalRecord> log;
+    for (int turn = 0; turn < 5; ++turn) {
+        playTurn(*live, &log);
+        playTurn(*control);
+    }
+    auto restored = makeGame(checkpoint);
+    for (const auto& record : log) {
+        restored->replay(record);
+    }
+    expectSameGame(*live, *restored);
+    expectSameGame(*live, *control); // 写快照不影响之后的洗牌
+
+    // 恢复后接着打，之后的洗牌也与没崩溃时一致
+    for (int turn = 0; turn < 6; ++turn) {
+        playTurn(*live);
+        playTurn(*restored);
+    }
+    GameSnapshot after;
+    live->saveSnapshot(&after);
+    EXPECT_GT(after.rng_draws(), checkpoint.rng_draws());
+    expectSameGame(*live, *restored);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <boost/asio.hpp>
+#include "network/handler_memory.h"
+
+using Sanguosha::Network::HandlerMemory;
+using Sanguosha::Network::withHandlerMemory;
+
+namespace {
+std::atomic<uint64_t> heapAllocations{0};
+}
+
+// 统计全局堆分配次数
+void* operator new(size_t size) {
+    ++heapAllocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+// 定时器反复等待，每次在回调里重新发起，模拟会话的心跳
+struct Rearm {
+    boost::asio::steady_timer& timer;
+    HandlerMemory& memory;
+    int& remaining;
+
+    void start() {
+        timer.expires_after(std::chrono::microseconds(0));
+        timer.async_wait(withHandlerMemory(memory, [this](const boost::system::error_code& ec) {
+            if (!ec && --remaining > 0) {
+                start();
+            }
+        }));
+    }
+};
+
+} // namespace
+
+TEST(HandlerMemoryTest, RepeatedWaitsDoNotTouchTheHeap) {
+    boost::asio::io_context io;
+    boost::asio::steady_timer timer(io);
+    HandlerMemory memory;
+
+    int remaining = 1;
+    Rearm rearm{timer, memory, remaining};
+    rearm.start();
+    io.run(); // 预热：io_context内部的首次分配不计入
+
+    remaining = 1000;
+    io.restart();
+    uint64_t before = heapAllocations.load();
+    rearm.start();
+    io.run();
+
+    EXPECT_EQ(remaining, 0);
+    EXPECT_EQ(heapAllocations.load(), before);
+    EXPECT_EQ(memory.fallbackAllocations(), 0u);
+}
+
+// 会话心跳的用法：收到数据只更新活动时间，定时器只在自己的完成回调里重新发起
+TEST(HandlerMemoryTest, ActivityDuringPendingWaitDoesNotRearm) {
+    boost::asio::io_context io;
+    boost::asio::steady_timer timer(io);
+    HandlerMemory memory;
+    auto lastActivity = std::chrono::steady_clock::now();
+    int remaining = 20;
+    Rearm rearm{timer, memory, remaining};
+    rearm.start();
+
+    // 定时器等待期间不断有"数据到达"
+    for (int i = 0; i < 100; ++i) {
+        boost::asio::post(io, [&lastActivity]() { lastActivity = std::chrono::steady_clock::now(); });
+    }
+    io.run();
+
+    EXPECT_EQ(remaining, 0);
+    EXPECT_EQ(memory.fallbackAllocations(), 0u);
+}
+
+// 等待还没完成时重新发起：被取消的操作要等回调执行后才释放内存，新的等待只能退回堆分配
+TEST(HandlerMemoryTest, RearmingWhileWaitPendingFallsBack) {
+    boost::asio::io_context io;
+    boost::asio::steady_timer timer(io);
+    HandlerMemory memory;
+    int completions = 0;
+    auto arm = [&]() {
+        timer.expires_after(std::chrono::seconds(60));
+        timer.async_wait(withHandlerMemory(memory, [&completions](const boost::system::error_code&) {
+            ++completions;
+        }));
+    };
+
+    arm();
+    arm(); // expires_after取消了第一次等待，但它的操作对象还没释放
+    EXPECT_EQ(memory.fallbackAllocations(), 1u);
+    timer.cancel();
+    io.run();
+    EXPECT_EQ(completions, 2);
+}
+
+TEST(HandlerMemoryTest, FallsBackWhenBusyOrTooLarge) {
+    HandlerMemory memory;
+    void* first = memory.allocate(64);
+    void* second = memory.allocate(64); // 第一块还没释放
+    EXPECT_NE(first, second);
+    void* large = memory.allocate(HandlerMemory::STORAGE_SIZE + 1);
+    EXPECT_EQ(memory.fallbackAllocations(), 2u);
+
+    memory.deallocate(second);
+    memory.deallocate(large);
+    memory.deallocate(first);
+    EXPECT_EQ(memory.allocate(HandlerMemory::STORAGE_SIZE), first); // 释放后重新可用
+    EXPECT_EQ(memory.fallbackAllocations(), 2u);
+}
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include "network/handler_registry.h"
+
+using Sanguosha::Network::MessageHandlerRegistry;
+
+namespace {
+
+struct FakeSession {
+    int logins = 0;
+    int heartbeats = 0;
+};
+
+sanguosha::GameMessage makeMessage(sanguosha::MessageType type) {
+    sanguosha::GameMessage msg;
+    msg.set_type(type);
+    return msg;
+}
+
+} // namespace
+
+TEST(HandlerRegistryTest, DispatchesByTypeAndCounts) {
+    MessageHandlerRegistry<FakeSession> registry;
+    registry.add(sanguosha::LOGIN_REQUEST, [](FakeSession& s, const sanguosha::GameMessage&) { ++s.logins; });
+    registry.add(sanguosha::HEARTBEAT, [](FakeSession& s, const sanguosha::GameMessage&) { ++s.heartbeats; });
+
+    FakeSession session;
+    EXPECT_TRUE(registry.dispatch(session, makeMessage(sanguosha::LOGIN_REQUEST), 10));
+    EXPECT_TRUE(registry.dispatch(session, makeMessage(sanguosha::HEARTBEAT), 2));
+    EXPECT_TRUE(registry.dispatch(session, makeMessage(sanguosha::HEARTBEAT), 2));
+    EXPECT_EQ(session.logins, 1);
+    EXPECT_EQ(session.heartbeats, 2);
+
+    const auto& heartbeat = registry.at(sanguosha::HEARTBEAT);
+    EXPECT_EQ(heartbeat.count.load(), 2u);
+    EXPECT_EQ(heartbeat.bytes.load(), 4u);
+    EXPECT_EQ(heartbeat.errors.load(), 0u);
+    uint64_t samples = 0;
+    for (const auto& bucket : heartbeat.latency) {
+        samples += bucket.load();
+    }
+    EXPECT_EQ(samples, 2u);
+}
+
+TEST(HandlerRegistryTest, UnregisteredTypeCountsAsError) {
+    MessageHandlerRegistry<FakeSession> registry;
+    FakeSession session;
+    EXPECT_FALSE(registry.dispatch(session, makeMessage(sanguosha::GAME_STATE), 7));
+    EXPECT_EQ(registry.at(sanguosha::GAME_STATE).errors.load(), 1u);
+
+    registry.recordError(sanguosha::GAME_ACTION, 3);
+    EXPECT_EQ(registry.at(sanguosha::GAME_ACTION).count.load(), 1u);
+    EXPECT_EQ(registry.at(sanguosha::GAME_ACTION).errors.load(), 1u);
+    EXPECT_NE(registry.report().find("GAME_ACTION"), std::string::npos);
+}
+
+TEST(HandlerRegistryTest, HandlerExceptionIsCountedAndRethrown) {
+    MessageHandlerRegistry<FakeSession> registry;
+    registry.add(sanguosha::ROOM_REQUEST, [](FakeSession&, const sanguosha::GameMessage&) {
+        throw std::runtime_error("bad room");
+    });
+    FakeSession session;
+    EXPECT_THROW(registry.dispatch(session, makeMessage(sanguosha::ROOM_REQUEST), 1), std::runtime_error);
+    EXPECT_EQ(registry.at(sanguosha::ROOM_REQUEST).errors.load(), 1u);
+}
+
+TEST(HandlerRegistryTest, LatencyPercentileUsesBucketUpperBound) {
+    Sanguosha::Network::MessageStats stats;
+    for (int i = 0; i < 99; ++i) {
+        stats.recordLatency(std::chrono::microseconds(3)); // 落在[2,4)桶
+    }
+    stats.recordLatency(std::chrono::milliseconds(5));
+    EXPECT_EQ(stats.percentileMicros(0.5), 4u);
+    EXPECT_GE(stats.percentileMicros(0.999), 4096u);
+}
+
+TEST(HandlerRegistryTest, AccessIsCheckedByCallerBeforeParsing) {
+    MessageHandlerRegistry<FakeSession> registry;
+    registry.add(sanguosha::LOGIN_REQUEST, [](FakeSession&, const sanguosha::GameMessage&) {});
+    registry.add(sanguosha::GAME_ACTION, [](FakeSession&, const sanguosha::GameMessage&) {},
+                 Sanguosha::Network::HandlerAccess::LOGGED_IN);
+
+    EXPECT_TRUE(registry.has(sanguosha::LOGIN_REQUEST));
+    EXPECT_FALSE(registry.has(sanguosha::GAME_STATE));
+    EXPECT_FALSE(registry.has(static_cast<sanguosha::MessageType>(1000)));
+    EXPECT_EQ(registry.access(sanguosha::LOGIN_REQUEST), Sanguosha::Network::HandlerAccess::ANY);
+    EXPECT_EQ(registry.access(sanguosha::GAME_ACTION), Sanguosha::Network::HandlerAccess::LOGGED_IN);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <csignal>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "network/hot_restart.h"
+#include "network/server.h"
+#include "room/room_manager.h"
+#include "test_client.h"
+
+using namespace Sanguosha::Network;
+
+namespace {
+
+// 两个描述符指向同一个文件时inode相同
+bool sameFile(int a, int b) {
+    struct stat sa{}, sb{};
+    return ::fstat(a, &sa) == 0 && ::fstat(b, &sb) == 0 && sa.st_ino == sb.st_ino && sa.st_dev == sb.st_dev;
+}
+
+} // namespace
+
+TEST(HotRestartTest, PassesDescriptorsAndSessionState) {
+    int pair[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+    HandoffChannel oldSide(pair[0]);
+    HandoffChannel newSide(pair[1]);
+
+    int pipeFds[2];
+    ASSERT_EQ(::pipe(pipeFds), 0);
+    int listener = pipeFds[0];
+    int connection = pipeFds[1];
+
+    oldSide.sendListener(listener);
+    oldSide.sendSession({connection, 1001, 3, "token-1001"});
+    oldSide.sendSession({connection, 0, 0, ""});
+    oldSide.sendDone();
+
+    auto state = newSide.receiveAll();
+    ASSERT_GE(state.listenerFd, 0);
+    EXPECT_NE(state.listenerFd, listener); // 收到的是新的描述符
+    EXPECT_TRUE(sameFile(state.listenerFd, listener));
+    ASSERT_EQ(state.sessions.size(), 2u);
+    EXPECT_TRUE(sameFile(state.sessions[0].fd, connection));
+    EXPECT_EQ(state.sessions[0].playerId, 1001u);
+    EXPECT_EQ(state.sessions[0].capabilities, 3u);
+    EXPECT_EQ(state.sessions[0].resumeToken, "token-1001");
+    EXPECT_EQ(state.sessions[1].playerId, 0u);
+    EXPECT_TRUE(state.sessions[1].resumeToken.empty());
+
+    newSide.sendAck();
+    EXPECT_NO_THROW(oldSide.awaitAck());
+
+    ::close(state.listenerFd);
+    for (const auto& session : state.sessions) {
+        ::close(session.fd);
+    }
+    ::close(pipeFds[0]);
+    ::close(pipeFds[1]);
+}
+
+TEST(HotRestartTest, FailsWithoutListenerOrWhenPeerCloses) {
+    int pair[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+    {
+        HandoffChannel oldSide(pair[0]);
+        HandoffChannel newSide(pair[1]);
+        oldSide.sendDone();
+        EXPECT_THROW(newSide.receiveAll(), std::runtime_error);
+    }
+
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+    HandoffChannel newSide(pair[1]);
+    ::close(pair[0]); // 旧进程中途退出
+    EXPECT_THROW(newSide.receiveAll(), std::runtime_error);
+}
+
+// 交接之后留在旧进程打完游戏的连接再登录：旧进程不能再写用户表（新进程可能已经换掉了文件）
+TEST(HotRestartTest, DrainingServerRejectsLoginAfterHandoff) {
+    std::string suffix = std::to_string(::getpid());
+    Sanguosha::Network::ServerConfig config;
+    config.port = static_cast<unsigned short>(20000 + ::getpid() % 20000);
+    config.userStorePath = ::testing::TempDir() + "hot_restart_test_" + suffix + ".db";
+    config.handoffSocket = ::testing::TempDir() + "hot_restart_test_" + suffix + ".sock";
+    config.statsIntervalSec = 0;
+    std::remove(config.userStorePath.c_str());
+
+    Server server(config);
+    Sanguosha::Room::RoomManager::Instance().setServer(server);
+    std::thread serverThread([&server, &config]() { server.start(config.port); });
+
+    // 两人开一局，交接时都留在旧进程
+    TestClient alice(config.port), bob(config.port);
+    ASSERT_TRUE(alice.login("alice").success());
+    ASSERT_TRUE(bob.login("bob").success());
+    uint32_t roomId = alice.room(sanguosha::CREATE_ROOM, 0, 2).room_info().room_id();
+    ASSERT_TRUE(bob.room(sanguosha::JOIN_ROOM, roomId).success());
+    sanguosha::GameMessage msg;
+    ASSERT_TRUE(alice.waitFor(sanguosha::GAME_START, msg));
+
+    // 测试自己扮演新进程
+    auto channel = HandoffChannel::connect(config.handoffSocket);
+    auto state = channel.receiveAll();
+    EXPECT_TRUE(state.sessions.empty());
+    channel.sendAck();
+    uint64_t usersBefore = server.getUserStore().size();
+
+    auto response = alice.login("mallory");
+    EXPECT_FALSE(response.success());
+    EXPECT_EQ(response.error_message(), "Server restarting");
+    EXPECT_GT(response.retry_after_ms(), 0u);
+    EXPECT_EQ(server.getUserStore().size(), usersBefore);
+
+    // 已经在排空，再来一次信号直接停机
+    ::raise(SIGTERM);
+    serverThread.join();
+    ::close(state.listenerFd);
+    std::remove(config.userStorePath.c_str());
+    std::remove(config.handoffSocket.c_str());
+}
@@ -7,12 +7,8 @@ class RoomIntegrationTest : public ::testing::Test {
 protected:
     void SetUp() override {
         // 初始化房间管理器
-        auto& roomMgr = Sanguosha::Room::RoomManager::Instance();
-        
         // 创建模拟IO上下文
         io_ = std::make_shared<boost::asio::io_context>();
-        roomMgr.setIoContext(*io_);
-        roomMgr.startCleanupTask();
     }
     
     std::shared_ptr<boost::asio::io_context> io_;
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include "common/token_bucket.h"
+#include "network/login_admission.h"
+
+using Sanguosha::Common::TimerWheel;
+using Sanguosha::Common::TokenBucket;
+using Sanguosha::Network::LoginAdmission;
+
+TEST(TokenBucketTest, BurstThenRefill) {
+    TokenBucket bucket(10.0, 3.0);
+    auto now = TokenBucket::Clock::now();
+    EXPECT_TRUE(bucket.tryAcquire(1.0, now));
+    EXPECT_TRUE(bucket.tryAcquire(1.0, now));
+    EXPECT_TRUE(bucket.tryAcquire(1.0, now));
+    EXPECT_FALSE(bucket.tryAcquire(1.0, now));
+    EXPECT_EQ(bucket.timeUntilAvailable(1.0, now).count(), 100);
+
+    // 10个/秒，100ms补充1个
+    now += std::chrono::milliseconds(150);
+    EXPECT_TRUE(bucket.tryAcquire(1.0, now));
+    EXPECT_FALSE(bucket.tryAcquire(1.0, now));
+
+    // 不会超过突发上限
+    now += std::chrono::seconds(10);
+    EXPECT_EQ(bucket.timeUntilAvailable(3.0, now).count(), 0);
+    EXPECT_GT(bucket.timeUntilAvailable(4.0, now).count(), 0);
+}
+
+TEST(TokenBucketTest, ZeroRateIsUnlimited) {
+    TokenBucket bucket(0.0, 1.0);
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(bucket.tryAcquire());
+    }
+}
+
+TEST(LoginAdmissionTest, QueuesThenRejects) {
+    boost::asio::io_context io;
+    TimerWheel wheel(io, std::chrono::milliseconds(10), 16);
+    LoginAdmission admission(wheel, 20.0, 2, 2);
+
+    int ran = 0;
+    uint32_t retryAfter = 0;
+    EXPECT_EQ(admission.submit([&]() { ++ran; }, retryAfter), LoginAdmission::Result::ADMITTED);
+    EXPECT_EQ(admission.submit([&]() { ++ran; }, retryAfter), LoginAdmission::Result::ADMITTED);
+    EXPECT_EQ(ran, 2);
+
+    EXPECT_EQ(admission.submit([&]() { ++ran; }, retryAfter), LoginAdmission::Result::QUEUED);
+    EXPECT_GT(retryAfter, 0u);
+    EXPECT_EQ(admission.submit([&]() { ++ran; }, retryAfter), LoginAdmission::Result::QUEUED);
+    EXPECT_EQ(admission.submit([&]() { ++ran; }, retryAfter), LoginAdmission::Result::REJECTED);
+    EXPECT_GE(retryAfter, 50u);
+    EXPECT_EQ(admission.queued(), 2u);
+    EXPECT_EQ(admission.rejectedCount(), 1u);
+
+    // 按速率放行排队的请求
+    io.run_for(std::chrono::milliseconds(300));
+    EXPECT_EQ(ran, 4);
+    EXPECT_EQ(admission.queued(), 0u);
+    EXPECT_EQ(admission.admittedCount(), 4u);
+}
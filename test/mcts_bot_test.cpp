@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <future>
+#include <thread>
+#include "common/io_gate.h"
+#include "common/work_stealing_pool.h"
+#include "game/mcts_bot.h"
+
+using namespace sanguosha;
+
+namespace {
+
+GameSimulator::Seat makeSeat(uint32_t playerId, uint8_t hp, Role role = ROLE_NONE) {
+    GameSimulator::Seat seat;
+    seat.playerId = playerId;
+    seat.hp = hp;
+    seat.maxHp = 4;
+    seat.role = role;
+    return seat;
+}
+
+} // namespace
+
+TEST(GameSimulatorTest, AttackWithoutDodgeDealsDamage) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 4));
+    sim.seats().push_back(makeSeat(2, 1));
+    sim.seats()[0].cards[CARD_ATTACK] = 1;
+    sim.alive().set(0);
+    sim.alive().set(1);
+
+    sim.apply({ACTION_PLAY_CARD, CARD_ATTACK, 1});
+    EXPECT_TRUE(sim.isTerminal());
+    EXPECT_EQ(sim.reward(0), 1.0);
+    EXPECT_EQ(sim.reward(1), 0.0);
+}
+
+TEST(GameSimulatorTest, AttackOpensResponseWindow) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 4));
+    sim.seats().push_back(makeSeat(2, 1));
+    sim.seats()[0].cards[CARD_ATTACK] = 1;
+    sim.seats()[1].cards[CARD_DEFEND] = 1;
+    sim.alive().set(0);
+    sim.alive().set(1);
+
+    sim.apply({ACTION_PLAY_CARD, CARD_ATTACK, 1});
+    EXPECT_FALSE(sim.isTerminal());
+    EXPECT_EQ(sim.actingSeat(), 1u);
+    EXPECT_EQ(sim.legalActions().size(), 2u); // 出闪或不出
+
+    sim.apply({ACTION_RESPOND, CARD_DEFEND, 0});
+    EXPECT_FALSE(sim.isTerminal());
+    EXPECT_EQ(sim.actingSeat(), 0u);
+}
+
+TEST(GameSimulatorTest, RenegadeWinsLastStanding) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 1, ROLE_LORD));
+    sim.seats().push_back(makeSeat(2, 3, ROLE_RENEGADE));
+    sim.seats().push_back(makeSeat(3, 0, ROLE_REBEL));
+    sim.seats()[1].cards[CARD_ATTACK] = 1;
+    sim.alive().set(0);
+    sim.alive().set(1);
+    sim.setCurrentSeat(1);
+
+    sim.apply({ACTION_PLAY_CARD, CARD_ATTACK, 0});
+    EXPECT_TRUE(sim.isTerminal());
+    EXPECT_EQ(sim.reward(1), 1.0);
+    EXPECT_EQ(sim.reward(2), 0.0);
+}
+
+TEST(MctsBotTest, FindsLethalAttack) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 4));
+    sim.seats().push_back(makeSeat(2, 1));
+    sim.seats()[0].cards[CARD_ATTACK] = 1;
+    sim.seats()[1].cards[CARD_HEAL] = 2;
+    sim.alive().set(0);
+    sim.alive().set(1);
+    for (int i = 0; i < 20; ++i) {
+        sim.deck().push_back(CARD_HEAL);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(100);
+    auto stats = MctsBot::search(sim, 0, deadline, 42);
+    SimAction best = MctsBot::pickBest({stats});
+    EXPECT_EQ(best.type, ACTION_PLAY_CARD);
+    EXPECT_EQ(best.card, CARD_ATTACK);
+    EXPECT_EQ(best.targetSeat, 1);
+}
+
+TEST(MctsBotTest, SlicedSearchKeepsGrowingTheSameTree) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 4));
+    sim.seats().push_back(makeSeat(2, 4));
+    sim.seats()[0].cards[CARD_ATTACK] = 2;
+    sim.alive().set(0);
+    sim.alive().set(1);
+    for (int i = 0; i < 20; ++i) {
+        sim.deck().push_back(CARD_HEAL);
+    }
+
+    auto visits = [](const std::vector<MctsBot::ActionStats>& stats) {
+        uint32_t total = 0;
+        for (const auto& s : stats) {
+            total += s.visits;
+        }
+        return total;
+    };
+    MctsSearch search(sim, 0, 7);
+    auto later = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    EXPECT_FALSE(search.run(BotPlanner::SLICE_ITERATIONS, later));
+    EXPECT_EQ(visits(search.rootStats()), BotPlanner::SLICE_ITERATIONS);
+    // 下一段（可能在另一个线程上）接着同一棵树跑
+    EXPECT_FALSE(search.run(BotPlanner::SLICE_ITERATIONS, later));
+    EXPECT_EQ(visits(search.rootStats()), 2 * BotPlanner::SLICE_ITERATIONS);
+    // 截止时间已过：分段立即结束
+    EXPECT_TRUE(search.run(BotPlanner::SLICE_ITERATIONS, std::chrono::steady_clock::now()));
+    EXPECT_EQ(visits(search.rootStats()), 2 * BotPlanner::SLICE_ITERATIONS);
+}
+
+TEST(BotPlannerTest, ConfiguredWorkerCountIsUsed) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 4));
+    sim.seats().push_back(makeSeat(2, 4));
+    sim.seats()[0].cards[CARD_ATTACK] = 1;
+    sim.alive().set(0);
+    sim.alive().set(1);
+
+    auto& planner = BotPlanner::Instance();
+    size_t original = planner.workerCount();
+    planner.configureWorkers(3, {});
+    EXPECT_EQ(planner.workerCount(), 3u);
+
+    // 同时思考的机器人比线程多，分段在线程之间窃取，所有请求都在时限附近返回
+    constexpr int kBots = 8;
+    std::vector<std::promise<SimAction>> decided(kBots);
+    auto start = std::chrono::steady_clock::now();
+    for (auto& promise : decided) {
+        planner.requestMove(sim, 0, [&promise](SimAction action) { promise.set_value(action); });
+    }
+    for (auto& promise : decided) {
+        ASSERT_EQ(promise.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, BotPlanner::MOVE_BUDGET * 3);
+
+    planner.configureWorkers(original, {});
+    EXPECT_EQ(planner.workerCount(), original);
+}
+
+TEST(BotPlannerTest, CancelAllSuppressesPendingDecisions) {
+    GameSimulator sim;
+    sim.seats().push_back(makeSeat(1, 4));
+    sim.seats().push_back(makeSeat(2, 4));
+    sim.seats()[0].cards[CARD_ATTACK] = 1;
+    sim.alive().set(0);
+    sim.alive().set(1);
+
+    auto& planner = BotPlanner::Instance();
+    auto decisions = std::make_shared<std::atomic<int>>(0);
+    planner.requestMove(sim, 0, [decisions](SimAction) { ++*decisions; });
+    planner.cancelAll();
+    int afterCancel = decisions->load();
+    std::this_thread::sleep_for(BotPlanner::MOVE_BUDGET * 2);
+    EXPECT_EQ(decisions->load(), afterCancel);
+
+    // 取消之后提交的请求照常返回
+    std::promise<SimAction> decided;
+    planner.requestMove(sim, 0, [&decided](SimAction action) { decided.set_value(action); });
+    auto future = decided.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+TEST(IoGateTest, DropsPostsAfterClose) {
+    boost::asio::io_context io;
+    Sanguosha::Common::IoGate gate(io);
+    int ran = 0;
+    EXPECT_TRUE(gate.post([&ran]() { ++ran; }));
+    gate.close();
+    EXPECT_FALSE(gate.post([&ran]() { ++ran; }));
+    io.run();
+    EXPECT_EQ(ran, 1);
+}
+
+TEST(WorkStealingPoolTest, RunsAllTasksIncludingNested) {
+    Sanguosha::Common::WorkStealingPool pool(4);
+    std::atomic<int> count{0};
+    std::promise<void> done;
+    constexpr int kTasks = 1000;
+
+    for (int i = 0; i < kTasks / 2; ++i) {
+        pool.submit([&]() {
+            // 池内提交的子任务进入本线程队列，可被其他线程窃取
+            pool.submit([&]() {
+                if (++count == kTasks) {
+                    done.set_value();
+                }
+            });
+            if (++count == kTasks) {
+                done.set_value();
+            }
+        });
+    }
+
+    auto future = done.get_future();
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_EQ(count.load(), kTasks);
+}
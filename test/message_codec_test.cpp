@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include "network/message_codec.h"
+
+using Sanguosha::Network::MessageCodec;
+
+TEST(MessageCodecTest, PeekTypeWithoutParsing) {
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::GAME_ACTION);
+    msg.mutable_game_action()->set_type(sanguosha::ACTION_PLAY_CARD);
+    msg.mutable_game_action()->set_card_id(sanguosha::CARD_ATTACK);
+    std::string body = msg.SerializeAsString();
+
+    sanguosha::MessageType type;
+    ASSERT_TRUE(MessageCodec::peekType(body.data(), body.size(), type));
+    EXPECT_EQ(type, sanguosha::GAME_ACTION);
+}
+
+TEST(MessageCodecTest, PeekTypeFindsFieldOutOfOrder) {
+    // 手工拼出type排在消息内容后面的编码
+    sanguosha::GameMessage content;
+    content.mutable_login_request()->set_username("alice");
+    std::string body = content.SerializeAsString();
+    body.push_back(0x08);
+    body.push_back(static_cast<char>(sanguosha::LOGIN_REQUEST));
+
+    sanguosha::MessageType type;
+    ASSERT_TRUE(MessageCodec::peekType(body.data(), body.size(), type));
+    EXPECT_EQ(type, sanguosha::LOGIN_REQUEST);
+}
+
+TEST(MessageCodecTest, PeekTypeRejectsTruncatedBody) {
+    sanguosha::GameMessage msg;
+    msg.mutable_login_request()->set_username("alice");
+    msg.set_type(sanguosha::LOGIN_REQUEST);
+    std::string body = msg.SerializeAsString();
+
+    sanguosha::MessageType type;
+    // 截断在长度前缀字段中间
+    EXPECT_FALSE(MessageCodec::peekType(body.data() + 2, 3, type));
+
+    // 空消息体：type为默认值
+    ASSERT_TRUE(MessageCodec::peekType(body.data(), 0, type));
+    EXPECT_EQ(type, sanguosha::UNKNOWN);
+}
+
+TEST(MessageCodecTest, EncodeBatchConcatenatesEncodedFrames) {
+    std::vector<std::shared_ptr<const std::vector<char>>> frames;
+    for (uint32_t id = 1; id <= 3; ++id) {
+        sanguosha::GameMessage msg;
+        msg.set_type(sanguosha::ROOM_RESPONSE);
+        msg.set_request_id(id);
+        msg.mutable_room_response()->set_success(true);
+        frames.push_back(std::make_shared<std::vector<char>>(MessageCodec::encode(msg)));
+    }
+
+    sanguosha::GameMessage batch = MessageCodec::decode(MessageCodec::encodeBatch(frames));
+    EXPECT_EQ(batch.type(), sanguosha::BATCH);
+    ASSERT_EQ(batch.batch().messages_size(), 3);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(batch.batch().messages(i).type(), sanguosha::ROOM_RESPONSE);
+        EXPECT_EQ(batch.batch().messages(i).request_id(), static_cast<uint32_t>(i + 1));
+        EXPECT_TRUE(batch.batch().messages(i).room_response().success());
+    }
+}
+
+TEST(MessageCodecTest, CompactGameActionRoundTrip) {
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::GAME_ACTION);
+    msg.set_request_id(77);
+    auto* action = msg.mutable_game_action();
+    action->set_type(sanguosha::ACTION_RESPOND);
+    action->set_card_id(sanguosha::CARD_DEFEND);
+    action->set_target_player(1001);
+    action->set_prompt_id(0x01020304);
+
+    std::vector<char> frame;
+    ASSERT_TRUE(MessageCodec::encodeCompact(msg, frame));
+    ASSERT_EQ(frame.size(), MessageCodec::HEADER_LENGTH + sizeof(MessageCodec::CompactGameAction));
+    const char* body = frame.data() + MessageCodec::HEADER_LENGTH;
+    size_t size = frame.size() - MessageCodec::HEADER_LENGTH;
+    ASSERT_TRUE(MessageCodec::isCompact(body, size));
+    EXPECT_EQ(MessageCodec::compactType(body, size), sanguosha::GAME_ACTION);
+
+    // 复用的消息对象里残留的旧值要被覆盖
+    sanguosha::GameMessage decoded;
+    decoded.mutable_game_action()->set_card_id(999);
+    ASSERT_TRUE(MessageCodec::decodeCompact(body, size, decoded));
+    EXPECT_EQ(decoded.type(), sanguosha::GAME_ACTION);
+    EXPECT_EQ(decoded.request_id(), 77u);
+    EXPECT_EQ(decoded.game_action().type(), sanguosha::ACTION_RESPOND);
+    EXPECT_EQ(decoded.game_action().card_id(), static_cast<uint32_t>(sanguosha::CARD_DEFEND));
+    EXPECT_EQ(decoded.game_action().target_player(), 1001u);
+    EXPECT_EQ(decoded.game_action().prompt_id(), 0x01020304u);
+}
+
+TEST(MessageCodecTest, CompactRejectsMalformedAndNeverMatchesProtobuf) {
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::HEARTBEAT);
+    msg.mutable_heartbeat()->set_timestamp(123456789);
+    std::string body = msg.SerializeAsString();
+    EXPECT_FALSE(MessageCodec::isCompact(body.data(), body.size()));
+
+    std::vector<char> frame;
+    ASSERT_TRUE(MessageCodec::encodeCompact(msg, frame));
+    sanguosha::GameMessage decoded;
+    // 长度不对的紧凑消息不接受
+    EXPECT_FALSE(MessageCodec::decodeCompact(frame.data() + MessageCodec::HEADER_LENGTH,
+                                             frame.size() - MessageCodec::HEADER_LENGTH - 1, decoded));
+    ASSERT_TRUE(MessageCodec::decodeCompact(frame.data() + MessageCodec::HEADER_LENGTH,
+                                            frame.size() - MessageCodec::HEADER_LENGTH, decoded));
+    EXPECT_EQ(decoded.heartbeat().timestamp(), 123456789u);
+
+    sanguosha::GameMessage room;
+    room.set_type(sanguosha::ROOM_REQUEST);
+    EXPECT_FALSE(MessageCodec::encodeCompact(room, frame));
+}
+
+TEST(MessageCodecTest, EncodeIntoCallerBuffer) {
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::ROOM_REQUEST);
+    msg.set_request_id(9);
+    msg.mutable_room_request()->set_room_id(42);
+
+    size_t size = MessageCodec::frameSize(msg);
+    std::vector<char> small(size - 1);
+    EXPECT_EQ(MessageCodec::encodeInto(msg, small.data(), small.size()), 0u);
+
+    std::vector<char> buffer(size + 16);
+    ASSERT_EQ(MessageCodec::encodeInto(msg, buffer.data(), buffer.size()), size);
+    EXPECT_EQ(MessageCodec::readHeader(buffer.data()), size - MessageCodec::HEADER_LENGTH);
+
+    sanguosha::GameMessage decoded;
+    ASSERT_TRUE(MessageCodec::decode(buffer.data() + MessageCodec::HEADER_LENGTH,
+                                     size - MessageCodec::HEADER_LENGTH, decoded));
+    EXPECT_EQ(decoded.room_request().room_id(), 42u);
+    EXPECT_EQ(decoded.request_id(), 9u);
+}
+
+TEST(MessageCodecTest, EnvelopeMatchesProtobufEncoding) {
+    sanguosha::GameState state;
+    state.set_current_player(1001);
+    state.set_game_log("玩家 1001 的回合开始");
+    state.add_players()->set_player_id(1001);
+
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::GAME_STATE);
+    *msg.mutable_game_state() = state;
+    EXPECT_EQ(MessageCodec::encodeEnvelope(sanguosha::GAME_STATE,
+                                           sanguosha::GameMessage::kGameStateFieldNumber, &state),
+              MessageCodec::encode(msg));
+
+    sanguosha::GameMessage typeOnly;
+    typeOnly.set_type(sanguosha::GAME_OVER);
+    EXPECT_EQ(MessageCodec::encodeEnvelope(sanguosha::GAME_OVER, 0, nullptr), MessageCodec::encode(typeOnly));
+}
+
+TEST(MessageCodecTest, PeekEnvelopeLocatesPayloadWithoutParsing) {
+    sanguosha::GameMessage msg;
+    msg.set_type(sanguosha::ROOM_REQUEST);
+    msg.set_request_id(300);
+    msg.mutable_room_request()->set_room_id(7);
+    std::string body = msg.SerializeAsString();
+
+    MessageCodec::Envelope envelope;
+    ASSERT_TRUE(MessageCodec::peekEnvelope(body.data(), body.size(), envelope));
+    EXPECT_EQ(envelope.type, sanguosha::ROOM_REQUEST);
+    EXPECT_EQ(envelope.requestId, 300u);
+    EXPECT_EQ(envelope.payloadField, sanguosha::GameMessage::kRoomRequestFieldNumber);
+
+    sanguosha::RoomRequest payload;
+    ASSERT_TRUE(payload.ParseFromArray(envelope.payload, static_cast<int>(envelope.payloadSize)));
+    EXPECT_EQ(payload.room_id(), 7u);
+
+    // 截断的数据不能越界
+    EXPECT_FALSE(MessageCodec::peekEnvelope(body.data(), body.size() - 1, envelope));
+}
+
+TEST(MessageCodecTest, BatchItemsIterateInOrder) {
+    sanguosha::GameMessage batch;
+    batch.set_type(sanguosha::BATCH);
+    for (uint32_t id = 1; id <= 3; ++id) {
+        auto* item = batch.mutable_batch()->add_messages();
+        item->set_type(sanguosha::HEARTBEAT);
+        item->set_request_id(id);
+    }
+    std::string body = batch.SerializeAsString();
+
+    MessageCodec::Envelope envelope;
+    ASSERT_TRUE(MessageCodec::peekEnvelope(body.data(), body.size(), envelope));
+    ASSERT_EQ(envelope.type, sanguosha::BATCH);
+
+    const char* cursor = envelope.payload;
+    const char* end = envelope.payload + envelope.payloadSize;
+    const char* item = nullptr;
+    size_t itemSize = 0;
+    uint32_t expected = 1;
+    while (MessageCodec::nextBatchItem(cursor, end, item, itemSize)) {
+        MessageCodec::Envelope inner;
+        ASSERT_TRUE(MessageCodec::peekEnvelope(item, itemSize, inner));
+        EXPECT_EQ(inner.type, sanguosha::HEARTBEAT);
+        EXPECT_EQ(inner.requestId, expected++);
+    }
+    EXPECT_EQ(expected, 4u);
+    EXPECT_EQ(cursor, end);
+}
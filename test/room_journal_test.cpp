@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include <zlib.h>
+#include "room/room_journal.h"
+
+using Sanguosha::Room::RoomJournal;
+namespace fs = std::filesystem;
+
+namespace {
+
+fs::path makeTempDir() {
+    char pattern[] = "/tmp/room_journal_test_XXXXXX";
+    return fs::path(::mkdtemp(pattern));
+}
+
+sanguosha::RoomJournalRecord actionRecord(uint32_t roomId, uint32_t playerId) {
+    sanguosha::RoomJournalRecord record;
+    record.set_kind(sanguosha::RoomJournalRecord::GAME_ACTION);
+    record.set_room_id(roomId);
+    record.set_player_id(playerId);
+    record.mutable_action()->set_type(sanguosha::ACTION_END_TURN);
+    return record;
+}
+
+std::unique_ptr<sanguosha::RoomManagerSnapshot> snapshotWithRoom(uint32_t roomId) {
+    auto snapshot = std::make_unique<sanguosha::RoomManagerSnapshot>();
+    snapshot->set_next_room_id(roomId + 1);
+    auto* room = snapshot->add_rooms();
+    room->set_room_id(roomId);
+    room->set_capacity(2);
+    room->add_players(1000);
+    return snapshot;
+}
+
+} // namespace
+
+TEST(RoomJournalTest, RecoversSnapshotAndLaterRecords) {
+    fs::path dir = makeTempDir();
+    {
+        RoomJournal journal(dir.string());
+        journal.append(actionRecord(1, 1000)); // 第一份快照之前的记录没有日志文件可写
+        journal.writeSnapshot(snapshotWithRoom(1));
+        journal.append(actionRecord(1, 1000));
+        journal.flush();
+        journal.writeSnapshot(snapshotWithRoom(2));
+        journal.append(actionRecord(2, 1001));
+        journal.append(actionRecord(2, 1002));
+    } // 析构时写完
+
+    auto recovery = RoomJournal::recover(dir.string());
+    EXPECT_EQ(recovery.snapshot.generation(), 2u);
+    ASSERT_EQ(recovery.snapshot.rooms_size(), 1);
+    EXPECT_EQ(recovery.snapshot.rooms(0).room_id(), 2u);
+    ASSERT_EQ(recovery.records.size(), 2u);
+    EXPECT_EQ(recovery.records[0].player_id(), 1001u);
+    EXPECT_EQ(recovery.records[1].player_id(), 1002u);
+    EXPECT_FALSE(fs::exists(dir / "rooms.wal.1")); // 新快照落盘后删除旧日志
+
+    // 重新打开时代数继续递增
+    {
+        RoomJournal journal(dir.string());
+        EXPECT_EQ(journal.generation(), 2u);
+    }
+    fs::remove_all(dir);
+}
+
+TEST(RoomJournalTest, DiscardsTornTailAndReplaysOlderGenerations) {
+    fs::path dir = makeTempDir();
+    {
+        RoomJournal journal(dir.string());
+        journal.writeSnapshot(snapshotWithRoom(1));
+        journal.append(actionRecord(1, 1000));
+        journal.append(actionRecord(1, 1001));
+    }
+    // 模拟崩溃：日志末尾只写了半条记录，而且新一代日志已经建好但快照还没替换
+    std::string wal = (dir / "rooms.wal.1").string();
+    auto size = fs::file_size(wal);
+    fs::resize_file(wal, size - 3);
+    {
+        std::ofstream next(dir / "rooms.wal.2", std::ios::binary);
+        sanguosha::RoomJournalRecord record = actionRecord(1, 1002);
+        std::string payload = record.SerializeAsString();
+        std::string frame;
+        uint32_t length = static_cast<uint32_t>(payload.size());
+        uint32_t crc = static_cast<uint32_t>(::crc32(0L, reinterpret_cast<const Bytef*>(payload.data()),
+                                                     static_cast<uInt>(payload.size())));
+        frame.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        frame.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+        frame += payload;
+        next << frame;
+    }
+
+    auto recovery = RoomJournal::recover(dir.string());
+    EXPECT_EQ(recovery.snapshot.generation(), 1u);
+    ASSERT_EQ(recovery.records.size(), 2u);
+    EXPECT_EQ(recovery.records[0].player_id(), 1000u); // 1001那条只写了一半
+    EXPECT_EQ(recovery.records[1].player_id(), 1002u);
+    fs::remove_all(dir);
+}
+
+TEST(RoomJournalTest, FailedSnapshotKeepsLoggingToThePreviousGeneration) {
+    fs::path dir = makeTempDir();
+    {
+        RoomJournal journal(dir.string());
+        journal.writeSnapshot(snapshotWithRoom(1));
+        journal.append(actionRecord(1, 1000));
+        journal.flush();
+
+        // 第2代日志建不出来：这次快照失败，之后的事件仍然写进第1代日志
+        fs::create_directory(dir / "rooms.wal.2");
+        journal.writeSnapshot(snapshotWithRoom(2));
+        journal.append(actionRecord(1, 1001));
+        journal.flush();
+    }
+    fs::remove(dir / "rooms.wal.2");
+
+    auto recovery = RoomJournal::recover(dir.string());
+    EXPECT_EQ(recovery.snapshot.generation(), 1u);
+    ASSERT_EQ(recovery.records.size(), 2u);
+    EXPECT_EQ(recovery.records[0].player_id(), 1000u);
+    EXPECT_EQ(recovery.records[1].player_id(), 1001u);
+
+    // 故障排除后下一次快照正常切换
+    {
+        RoomJournal journal(dir.string());
+        journal.writeSnapshot(snapshotWithRoom(3));
+        journal.append(actionRecord(3, 1002));
+    }
+    recovery = RoomJournal::recover(dir.string());
+    EXPECT_EQ(recovery.snapshot.generation(), 2u);
+    ASSERT_EQ(recovery.records.size(), 1u);
+    EXPECT_EQ(recovery.records[0].player_id(), 1002u);
+    EXPECT_FALSE(fs::exists(dir / "rooms.wal.1"));
+    fs::remove_all(dir);
+}
@@ -0,0 +1,671 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+#include "network/message_codec.h"
+#include "network/server.h"
+#include "network/session.h"
+#include "room/room.h"
+#include "room/room_manager.h"
+#include "test_client.h"
+
+using Sanguosha::Network::MessageCodec;
+using Sanguosha::Network::OutboundPolicy;
+using Sanguosha::Network::Server;
+using Sanguosha::Network::ServerConfig;
+using Sanguosha::Network::Session;
+using Sanguosha::Room::RoomManager;
+using boost::asio::ip::tcp;
+
+// 会话层的端到端测试：在后台线程上运行真实的Server，用阻塞客户端收发消息
+class SessionTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        static std::atomic<int> counter{0};
+        int index = counter++;
+        config.port = static_cast<unsigned short>(21000 + (::getpid() * 31 + index) % 19000);
+        config.userStorePath = ::testing::TempDir() + "session_test_" + std::to_string(::getpid()) + "_" +
+                               std::to_string(index) + ".db";
+        config.statsIntervalSec = 0;
+        config.timerTickMs = 10;
+        std::remove(config.userStorePath.c_str());
+    }
+
+    void TearDown() override {
+        stopServer();
+        std::remove(config.userStorePath.c_str());
+    }
+
+    void startServer() {
+        server = std::make_unique<Server>(config);
+        auto& roomManager = RoomManager::Instance();
+        roomManager.setServer(*server);
+        roomManager.resumeMatchmaking(); // 上一个用例的停机排空会关掉匹配
+        serverThread = std::thread([this]() {
+            server->start(config.port);
+            serverExited = true;
+        });
+    }
+
+    // 等事件循环自己退出，不替它发信号
+    bool waitForServerExit(int timeoutMs) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (!serverExited && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return serverExited;
+    }
+
+    // 第一次SIGTERM开始排空，已经在排空时第二次直接停机
+    void stopServer() {
+        if (!serverThread.joinable()) {
+            return;
+        }
+        ::raise(SIGTERM);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        if (!server->getIoContext().stopped()) {
+            ::raise(SIGTERM);
+        }
+        serverThread.join();
+        server.reset();
+    }
+
+    // 两人开一局1v1，返回房间号
+    uint32_t startDuel(TestClient& alice, TestClient& bob) {
+        uint32_t roomId = alice.room(sanguosha::CREATE_ROOM, 0, 2).room_info().room_id();
+        EXPECT_TRUE(bob.room(sanguosha::JOIN_ROOM, roomId).success());
+        sanguosha::GameMessage msg;
+        // 坐满即开局；加入者的GAME_START可能先于入房响应到达，只等房主的
+        EXPECT_TRUE(alice.waitFor(sanguosha::GAME_START, msg));
+        return roomId;
+    }
+
+    ServerConfig config;
+    std::unique_ptr<Server> server;
+    std::thread serverThread;
+    std::atomic<bool> serverExited{false};
+};
+
+TEST_F(SessionTest, SecondLoginOnTheSameConnectionIsRejected) {
+    startServer();
+    TestClient client(config.port);
+    auto first = client.login("alice");
+    ASSERT_TRUE(first.success());
+    size_t users = server->getUserStore().size();
+
+    auto second = client.login("bob");
+    EXPECT_FALSE(second.success());
+    EXPECT_EQ(second.error_message(), "Already logged in");
+    EXPECT_EQ(server->getUserStore().size(), users); // 没有为bob建账号
+    // 连接仍然是alice
+    EXPECT_NE(server->getSession(first.user_id()), nullptr);
+    uint32_t roomId = client.room(sanguosha::CREATE_ROOM, 0, 2).room_info().room_id();
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(first.user_id()), roomId);
+    EXPECT_TRUE(client.room(sanguosha::LEAVE_ROOM, roomId).success());
+}
+
+TEST_F(SessionTest, DisconnectedPlayerResumesSeatWithKeyframe) {
+    startServer();
+    auto alice = std::make_unique<TestClient>(config.port);
+    TestClient bob(config.port);
+    auto login = alice->login("alice");
+    ASSERT_TRUE(login.success());
+    ASSERT_TRUE(bob.login("bob").success());
+    uint32_t roomId = startDuel(*alice, bob);
+
+    // 断线：座位保留，游戏继续等着
+    alice->disconnect();
+    alice.reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(server->getSession(login.user_id()), nullptr);
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(login.user_id()), roomId);
+    EXPECT_EQ(RoomManager::Instance().activeGameCount(), 1u);
+
+    // 凭令牌在新连接上恢复，登录响应之后收到一帧完整状态
+    TestClient resumed(config.port);
+    auto again = resumed.login("", login.resume_token());
+    ASSERT_TRUE(again.success());
+    EXPECT_TRUE(again.resumed());
+    EXPECT_EQ(again.user_id(), login.user_id());
+    EXPECT_EQ(again.room_id(), roomId);
+    sanguosha::GameMessage keyframe;
+    ASSERT_TRUE(resumed.receive(keyframe));
+    ASSERT_EQ(keyframe.type(), sanguosha::GAME_STATE);
+    EXPECT_EQ(keyframe.game_state().players_size(), 2);
+    EXPECT_NE(keyframe.game_state().current_player(), 0u);
+
+    // 离开即判负，对局结束
+    EXPECT_TRUE(resumed.room(sanguosha::LEAVE_ROOM, roomId).success());
+    sanguosha::GameMessage over;
+    ASSERT_TRUE(bob.waitFor(sanguosha::GAME_OVER, over));
+    EXPECT_NE(over.game_over().winner_id(), login.user_id());
+}
+
+TEST_F(SessionTest, GraceExpiryForfeitsTheSeat) {
+    config.resumeGraceMs = 200;
+    startServer();
+    auto alice = std::make_unique<TestClient>(config.port);
+    TestClient bob(config.port);
+    auto login = alice->login("alice");
+    ASSERT_TRUE(login.success());
+    auto bobLogin = bob.login("bob");
+    ASSERT_TRUE(bobLogin.success());
+    startDuel(*alice, bob);
+
+    alice.reset();
+    sanguosha::GameMessage over;
+    ASSERT_TRUE(bob.waitFor(sanguosha::GAME_OVER, over));
+    EXPECT_EQ(over.game_over().winner_id(), bobLogin.user_id());
+    // 房间在GAME_OVER发出之后才由io线程回收
+    for (int i = 0; i < 100 && RoomManager::Instance().roomIdOf(login.user_id()) != 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(login.user_id()), 0u);
+
+    // 过期的令牌不再恢复，按游客重新登录
+    TestClient late(config.port);
+    auto again = late.login("", login.resume_token());
+    EXPECT_TRUE(again.success());
+    EXPECT_FALSE(again.resumed());
+    EXPECT_NE(again.user_id(), login.user_id());
+}
+
+TEST_F(SessionTest, RepliesEchoTheRequestId) {
+    startServer();
+    TestClient alice(config.port), bob(config.port);
+    auto aliceLogin = alice.login("alice");
+    auto bobLogin = bob.login("bob");
+    ASSERT_TRUE(aliceLogin.success());
+    ASSERT_TRUE(bobLogin.success());
+    uint32_t roomId = startDuel(alice, bob);
+
+    // 跳过服务器主动推送的消息（request_id为0），直到收到对某个请求的回复
+    auto replyTo = [](TestClient& client, uint32_t requestId, sanguosha::GameMessage& msg) {
+        while (client.receive(msg)) {
+            if (msg.request_id() == requestId) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    sanguosha::GameMessage heartbeat;
+    heartbeat.set_type(sanguosha::HEARTBEAT);
+    heartbeat.set_request_id(7);
+    heartbeat.mutable_heartbeat()->set_timestamp(123456);
+    alice.send(heartbeat);
+    sanguosha::GameMessage msg;
+    ASSERT_TRUE(replyTo(alice, 7, msg));
+    EXPECT_EQ(msg.type(), sanguosha::HEARTBEAT);
+    EXPECT_EQ(msg.heartbeat().timestamp(), 123456u);
+
+    // 1v1由座位0（房主）先手：不在回合中的bob结束回合被拒绝，alice的被接受，两个回复都带回各自的request_id
+    sanguosha::GameMessage endTurn;
+    endTurn.set_type(sanguosha::GAME_ACTION);
+    endTurn.mutable_game_action()->set_type(sanguosha::ACTION_END_TURN);
+    endTurn.set_request_id(41);
+    bob.send(endTurn);
+    ASSERT_TRUE(replyTo(bob, 41, msg));
+    EXPECT_EQ(msg.type(), sanguosha::GAME_STATE);
+    EXPECT_EQ(msg.game_state().game_log(), "操作无效");
+
+    endTurn.set_request_id(42);
+    alice.send(endTurn);
+    ASSERT_TRUE(replyTo(alice, 42, msg));
+    EXPECT_EQ(msg.type(), sanguosha::ACTION_RESULT);
+    EXPECT_TRUE(msg.action_result().success());
+
+    EXPECT_TRUE(alice.room(sanguosha::LEAVE_ROOM, roomId).success());
+    ASSERT_TRUE(bob.waitFor(sanguosha::GAME_OVER, msg));
+}
+
+TEST_F(SessionTest, BusyPollEventLoopExitsWhenStopped) {
+    config.busyPoll = true;
+    startServer();
+    TestClient client(config.port);
+    ASSERT_TRUE(client.login("alice").success());
+
+    // 空闲时事件循环退避到限时阻塞，从别的线程stop()也要能及时退出
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    server->getIoContext().stop();
+    ASSERT_TRUE(waitForServerExit(1000));
+    serverThread.join();
+}
+
+TEST_F(SessionTest, BusyPollEventLoopExitsOnSigterm) {
+    config.busyPoll = true;
+    startServer();
+    TestClient client(config.port);
+    ASSERT_TRUE(client.login("alice").success());
+
+    // 没有进行中的游戏：排空立即结束，停机走finishShutdown里的io_context::stop()
+    ::raise(SIGTERM);
+    ASSERT_TRUE(waitForServerExit(1000));
+    serverThread.join();
+    EXPECT_TRUE(client.closedByPeer(1000));
+}
+
+// 停机排空（SIGTERM）：不再接受连接和开新局，等进行中的游戏打完或超时，发送队列写完后才断开
+class DrainTest : public SessionTest {
+protected:
+    // 监听socket关闭后新连接直接被拒绝
+    bool acceptsConnections() {
+        int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(config.port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bool connected = ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+        ::close(fd);
+        return connected;
+    }
+
+    bool waitUntilDraining() {
+        for (int i = 0; i < 200 && RoomManager::Instance().acceptingGames(); ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return !RoomManager::Instance().acceptingGames();
+    }
+};
+
+TEST_F(DrainTest, RefusesNewGamesAndWaitsForRunningGames) {
+    startServer();
+    TestClient alice(config.port), bob(config.port), carol(config.port);
+    ASSERT_TRUE(alice.login("alice").success());
+    ASSERT_TRUE(bob.login("bob").success());
+    auto carolLogin = carol.login("carol");
+    ASSERT_TRUE(carolLogin.success());
+    uint32_t roomId = startDuel(alice, bob);
+    ASSERT_TRUE(carol.room(sanguosha::CREATE_ROOM, 0, 2).success());
+
+    ::raise(SIGTERM);
+    ASSERT_TRUE(waitUntilDraining());
+    // 没开局的房间解散，不能再建房，也不接受新连接
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(carolLogin.user_id()), 0u);
+    EXPECT_FALSE(carol.room(sanguosha::CREATE_ROOM, 0, 2).success());
+    EXPECT_FALSE(acceptsConnections());
+
+    // 进行中的游戏照常进行，服务器等它结束
+    std::this_thread::sleep_for(Server::DRAIN_POLL_INTERVAL * 2);
+    EXPECT_FALSE(serverExited);
+    EXPECT_EQ(RoomManager::Instance().activeGameCount(), 1u);
+
+    EXPECT_TRUE(alice.room(sanguosha::LEAVE_ROOM, roomId).success());
+    sanguosha::GameMessage msg;
+    ASSERT_TRUE(bob.waitFor(sanguosha::GAME_OVER, msg));
+    ASSERT_TRUE(waitForServerExit(2000));
+    serverThread.join();
+    EXPECT_TRUE(bob.closedByPeer(1000));
+}
+
+TEST_F(DrainTest, DeadlineShutsDownWithGamesStillRunning) {
+    config.drainTimeoutSec = 1;
+    startServer();
+    TestClient alice(config.port), bob(config.port);
+    ASSERT_TRUE(alice.login("alice").success());
+    ASSERT_TRUE(bob.login("bob").success());
+    uint32_t roomId = startDuel(alice, bob);
+
+    auto started = std::chrono::steady_clock::now();
+    ::raise(SIGTERM);
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    EXPECT_FALSE(serverExited);
+    ASSERT_TRUE(waitForServerExit(3000));
+    serverThread.join();
+    EXPECT_GE(std::chrono::steady_clock::now() - started, std::chrono::seconds(config.drainTimeoutSec));
+    // 游戏没打完也停机，连接被关闭
+    EXPECT_EQ(RoomManager::Instance().activeGameCount(), 1u);
+    EXPECT_TRUE(alice.closedByPeer(1000));
+    EXPECT_TRUE(bob.closedByPeer(1000));
+
+    // 单例里残留的房间要在Server析构前清掉，它的游戏还挂着Server的计时器
+    RoomManager::Instance().closeRoom(roomId);
+}
+
+TEST_F(DrainTest, FlushesQueuedFramesBeforeClosing) {
+    // 回环连接的内核发送缓冲区能涨到几MB，塞的数据要比它多
+    constexpr int FRAMES = 512;
+    constexpr size_t FRAME_BYTES = 16 * 1024;
+    config.maxOutboundBytes = 16 * 1024 * 1024;
+    startServer();
+    TestClient client(config.port, 4096);
+    auto login = client.login("alice");
+    ASSERT_TRUE(login.success());
+
+    // 读得慢的客户端：一次塞进去的帧大部分还在服务器的发送队列里
+    std::atomic<size_t> queuedBytes{0};
+    boost::asio::post(server->getIoContext(), [&]() {
+        auto session = server->getSession(login.user_id());
+        for (int i = 0; i < FRAMES; ++i) {
+            sanguosha::GameMessage msg;
+            msg.set_type(sanguosha::GAME_STATE);
+            msg.mutable_game_state()->set_game_log(std::to_string(i) + "|" + std::string(FRAME_BYTES, '.'));
+            session->send(msg);
+        }
+        queuedBytes = session->outboundBytes();
+    });
+    for (int i = 0; i < 200 && queuedBytes == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_GT(queuedBytes.load(), 0u);
+
+    // 没有游戏，排空立即结束，但要等发送队列写完才断开
+    ::raise(SIGTERM);
+    std::this_thread::sleep_for(Server::DRAIN_POLL_INTERVAL * 2);
+    EXPECT_FALSE(serverExited);
+
+    sanguosha::GameMessage msg;
+    for (int i = 0; i < FRAMES; ++i) {
+        ASSERT_TRUE(client.receive(msg, 1000)) << "frame " << i;
+        const auto& log = msg.game_state().game_log();
+        EXPECT_EQ(log.substr(0, log.find('|')), std::to_string(i));
+    }
+    EXPECT_TRUE(client.closedByPeer(1000));
+    ASSERT_TRUE(waitForServerExit(1000));
+    serverThread.join();
+}
+
+// 房间休眠：空闲的房间序列化后释放，下一次访问或截止时间到达时还原，状态不变
+class HibernationTest : public SessionTest {
+protected:
+    void SetUp() override {
+        SessionTest::SetUp();
+        config.hibernateIdleMs = 100;
+    }
+
+    bool waitForHibernated(size_t count, int timeoutMs = 2000) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        while (RoomManager::Instance().hibernatedRoomCount() != count) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+
+    // 房间和游戏只在io线程上访问
+    void runOnServer(const std::function<void()>& fn) {
+        std::promise<void> done;
+        boost::asio::post(server->getIoContext(), [&]() {
+            fn();
+            done.set_value();
+        });
+        done.get_future().wait();
+    }
+
+    sanguosha::GameSnapshot gameState(uint32_t roomId) {
+        sanguosha::RoomSnapshot snapshot;
+        runOnServer([&]() { RoomManager::Instance().getRoom(roomId)->saveSnapshot(&snapshot); });
+        return snapshot.game();
+    }
+
+    const sanguosha::RoomInfo* findRoom(const sanguosha::RoomListResponse& list, uint32_t roomId) {
+        for (const auto& room : list.rooms()) {
+            if (room.room_id() == roomId) {
+                return &room;
+            }
+        }
+        return nullptr;
+    }
+};
+
+TEST_F(HibernationTest, WaitingRoomWakesOnJoin) {
+    startServer();
+    TestClient alice(config.port), bob(config.port);
+    auto aliceLogin = alice.login("alice");
+    ASSERT_TRUE(aliceLogin.success());
+    ASSERT_TRUE(bob.login("bob").success());
+    uint32_t roomId = alice.room(sanguosha::CREATE_ROOM, 0, 3).room_info().room_id();
+    ASSERT_TRUE(waitForHibernated(1));
+
+    // 列房间和按玩家查房间号直接读休眠记录，不唤醒
+    sanguosha::GameMessage request;
+    request.set_type(sanguosha::ROOM_LIST_REQUEST);
+    bob.send(request);
+    sanguosha::GameMessage msg;
+    ASSERT_TRUE(bob.waitFor(sanguosha::ROOM_LIST_RESPONSE, msg));
+    const auto* listed = findRoom(msg.room_list_response(), roomId);
+    ASSERT_NE(listed, nullptr);
+    EXPECT_EQ(listed->max_players(), 3u);
+    EXPECT_EQ(std::vector<uint32_t>(listed->players().begin(), listed->players().end()),
+              std::vector<uint32_t>{aliceLogin.user_id()});
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(aliceLogin.user_id()), roomId);
+    EXPECT_EQ(RoomManager::Instance().hibernatedRoomCount(), 1u);
+
+    // 入房唤醒，房主和容量都还在
+    ASSERT_TRUE(bob.room(sanguosha::JOIN_ROOM, roomId).success());
+    EXPECT_EQ(RoomManager::Instance().hibernatedRoomCount(), 0u);
+    sanguosha::RoomListResponse list;
+    RoomManager::Instance().listRooms(&list);
+    listed = findRoom(list, roomId);
+    ASSERT_NE(listed, nullptr);
+    EXPECT_EQ(listed->max_players(), 3u);
+    ASSERT_EQ(listed->players_size(), 2);
+    EXPECT_EQ(listed->players(0), aliceLogin.user_id());
+
+    EXPECT_TRUE(bob.room(sanguosha::LEAVE_ROOM, roomId).success());
+    EXPECT_TRUE(alice.room(sanguosha::LEAVE_ROOM, roomId).success());
+}
+
+TEST_F(HibernationTest, GameWaitingOnDisconnectedPlayerWakesOnAction) {
+    config.turnTimeoutMs = 10000;
+    startServer();
+    auto alice = std::make_unique<TestClient>(config.port);
+    TestClient bob(config.port);
+    auto aliceLogin = alice->login("alice");
+    ASSERT_TRUE(aliceLogin.success());
+    ASSERT_TRUE(bob.login("bob").success());
+    uint32_t roomId = startDuel(*alice, bob);
+    auto before = gameState(roomId);
+
+    // 轮到的alice断线，对局只能等她或计时器，房间休眠
+    alice.reset();
+    ASSERT_TRUE(waitForHibernated(1));
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(aliceLogin.user_id()), roomId);
+    EXPECT_EQ(RoomManager::Instance().activeGameCount(), 1u);
+    EXPECT_EQ(RoomManager::Instance().hibernatedRoomCount(), 1u);
+
+    // bob的操作唤醒房间（不是他的回合，被拒绝），局面与休眠前相同
+    sanguosha::GameMessage endTurn;
+    endTurn.set_type(sanguosha::GAME_ACTION);
+    endTurn.mutable_game_action()->set_type(sanguosha::ACTION_END_TURN);
+    endTurn.set_request_id(1);
+    bob.send(endTurn);
+    sanguosha::GameMessage msg;
+    do {
+        ASSERT_TRUE(bob.receive(msg));
+    } while (msg.request_id() != 1);
+    EXPECT_EQ(msg.game_state().game_log(), "操作无效");
+    EXPECT_EQ(RoomManager::Instance().hibernatedRoomCount(), 0u);
+
+    auto after = gameState(roomId);
+    EXPECT_EQ(after.current_seat(), before.current_seat());
+    EXPECT_EQ(after.turn_seq(), before.turn_seq());
+    EXPECT_EQ(after.rng_draws(), before.rng_draws());
+    EXPECT_EQ(std::vector<uint32_t>(after.deck().begin(), after.deck().end()),
+              std::vector<uint32_t>(before.deck().begin(), before.deck().end()));
+    ASSERT_EQ(after.seats_size(), before.seats_size());
+    for (int seat = 0; seat < after.seats_size(); ++seat) {
+        EXPECT_EQ(after.seats(seat).SerializeAsString(), before.seats(seat).SerializeAsString()) << "seat " << seat;
+    }
+
+    EXPECT_TRUE(bob.room(sanguosha::LEAVE_ROOM, roomId).success());
+}
+
+TEST_F(HibernationTest, GameWakesAtTheTurnDeadline) {
+    config.turnTimeoutMs = 600;
+    startServer();
+    auto alice = std::make_unique<TestClient>(config.port);
+    TestClient bob(config.port);
+    auto aliceLogin = alice->login("alice");
+    ASSERT_TRUE(aliceLogin.success());
+    auto bobLogin = bob.login("bob");
+    ASSERT_TRUE(bobLogin.success());
+    uint32_t roomId = startDuel(*alice, bob);
+
+    alice.reset();
+    ASSERT_TRUE(waitForHibernated(1));
+
+    // 没人访问：到了alice的回合截止时间自己醒来，按超时把回合交给bob
+    sanguosha::GameMessage msg;
+    bool bobsTurn = false;
+    while (!bobsTurn && bob.waitFor(sanguosha::GAME_STATE, msg, 2000)) {
+        bobsTurn = msg.game_state().current_player() == bobLogin.user_id();
+    }
+    EXPECT_TRUE(bobsTurn);
+    EXPECT_EQ(RoomManager::Instance().hibernatedRoomCount(), 0u);
+    EXPECT_EQ(RoomManager::Instance().roomIdOf(aliceLogin.user_id()), roomId);
+    EXPECT_EQ(gameState(roomId).consecutive_timeouts(0), 1u);
+
+    EXPECT_TRUE(bob.room(sanguosha::LEAVE_ROOM, roomId).success());
+}
+
+// 发送队列超限策略：会话连在本地socket上，不启动Server，直接驱动它的io_context
+class OutboundPolicyTest : public ::testing::Test {
+protected:
+    using Burst = std::vector<std::pair<std::string, Session::FrameKind>>;
+    static constexpr Session::FrameKind CONTROL = Session::FrameKind::CONTROL;
+    static constexpr Session::FrameKind STATE = Session::FrameKind::STATE;
+
+    void SetUp() override {
+        config.userStorePath = ::testing::TempDir() + "outbound_policy_test_" + std::to_string(::getpid()) + ".db";
+        // 每帧约300字节，排到第4帧时超限
+        config.maxOutboundBytes = 1000;
+    }
+    void TearDown() override {
+        session.reset();
+        peer.reset();
+        server.reset();
+        std::remove(config.userStorePath.c_str());
+    }
+
+    void connect(OutboundPolicy policy) {
+        config.outboundPolicy = policy;
+        server = std::make_unique<Server>(config);
+        auto& io = server->getIoContext();
+        tcp::acceptor acceptor(io, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        peer = std::make_unique<tcp::socket>(io);
+        peer->connect(acceptor.local_endpoint());
+        tcp::socket accepted(io);
+        acceptor.accept(accepted);
+        session = std::make_shared<Session>(std::move(accepted), *server);
+    }
+
+    // 在io线程的同一次处理里连续发送：第一帧立即开始写，写完成之前其余的都在队列里，
+    // 然后让写完成，返回对端按顺序收到的帧标签；closed表示对端读到了EOF
+    std::vector<std::string> send(const Burst& burst, bool& closed) {
+        auto& io = server->getIoContext();
+        boost::asio::post(io, [this, &burst]() {
+            for (const auto& [label, kind] : burst) {
+                sanguosha::GameMessage msg;
+                msg.set_type(sanguosha::GAME_STATE);
+                msg.mutable_game_state()->set_game_log(label + "|" + std::string(280, '.'));
+                session->sendFrame(std::make_shared<std::vector<char>>(MessageCodec::encode(msg)), kind);
+            }
+        });
+        io.restart();
+        for (int i = 0; i < 200; ++i) {
+            io.poll();
+            if (session->outboundFrames() == 0) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        EXPECT_EQ(session->outboundFrames(), 0u);
+
+        std::vector<char> data;
+        closed = false;
+        peer->non_blocking(true);
+        char buffer[4096];
+        for (;;) {
+            boost::system::error_code ec;
+            size_t n = peer->read_some(boost::asio::buffer(buffer), ec);
+            if (ec == boost::asio::error::would_block) {
+                break;
+            }
+            if (ec) {
+                closed = true;
+                break;
+            }
+            data.insert(data.end(), buffer, buffer + n);
+        }
+
+        std::vector<std::string> labels;
+        size_t offset = 0;
+        while (offset + MessageCodec::HEADER_LENGTH <= data.size()) {
+            uint32_t size;
+            std::memcpy(&size, data.data() + offset, sizeof(size));
+            size = ntohl(size);
+            offset += MessageCodec::HEADER_LENGTH;
+            sanguosha::GameMessage msg;
+            EXPECT_TRUE(msg.ParseFromArray(data.data() + offset, static_cast<int>(size)));
+            offset += size;
+            const auto& log = msg.game_state().game_log();
+            labels.push_back(log.substr(0, log.find('|')));
+        }
+        return labels;
+    }
+
+    uint64_t droppedFrames() { return server->outboundMetrics().droppedFrames.load(); }
+    uint64_t disconnects() { return server->outboundMetrics().slowConsumerDisconnects.load(); }
+
+    ServerConfig config;
+    std::unique_ptr<Server> server;
+    std::unique_ptr<tcp::socket> peer;
+    std::shared_ptr<Session> session;
+};
+
+TEST_F(OutboundPolicyTest, DisconnectPolicyClosesOnOverflow) {
+    connect(OutboundPolicy::DISCONNECT);
+    bool closed;
+    auto labels = send({{"C0", CONTROL}, {"S1", STATE}, {"S2", STATE}, {"S3", STATE}}, closed);
+    EXPECT_TRUE(closed);
+    // 只有已经在写的第一帧可能送达，排队的都随连接丢弃
+    EXPECT_LE(labels.size(), 1u);
+    EXPECT_EQ(disconnects(), 1u);
+    EXPECT_EQ(droppedFrames(), 0u);
+}
+
+TEST_F(OutboundPolicyTest, DropOldestStateMakesRoomFromOldestSnapshot) {
+    connect(OutboundPolicy::DROP_OLDEST_STATE);
+    bool closed;
+    auto labels = send({{"C0", CONTROL}, {"S1", STATE}, {"S2", STATE}, {"S3", STATE}}, closed);
+    EXPECT_FALSE(closed);
+    EXPECT_EQ(labels, (std::vector<std::string>{"C0", "S2", "S3"}));
+    EXPECT_EQ(droppedFrames(), 1u);
+}
+
+TEST_F(OutboundPolicyTest, DropOldestStateDisconnectsWhenOnlyControlFramesQueued) {
+    connect(OutboundPolicy::DROP_OLDEST_STATE);
+    bool closed;
+    auto labels = send({{"C0", CONTROL}, {"C1", CONTROL}, {"C2", CONTROL}, {"C3", CONTROL}}, closed);
+    EXPECT_TRUE(closed); // 控制帧不能丢，腾不出空间只能断开
+    EXPECT_LE(labels.size(), 1u);
+    EXPECT_EQ(disconnects(), 1u);
+}
+
+TEST_F(OutboundPolicyTest, LatestKeyframeKeepsOnlyTheNewestSnapshot) {
+    connect(OutboundPolicy::LATEST_KEYFRAME);
+    bool closed;
+    // 新来的是快照：之前排队的快照全部作废
+    auto labels = send({{"C0", CONTROL}, {"S1", STATE}, {"S2", STATE}, {"S3", STATE}}, closed);
+    EXPECT_FALSE(closed);
+    EXPECT_EQ(labels, (std::vector<std::string>{"C0", "S3"}));
+    EXPECT_EQ(droppedFrames(), 2u);
+
+    // 新来的是控制帧：保留最新的一帧快照
+    labels = send({{"C4", CONTROL}, {"S5", STATE}, {"S6", STATE}, {"C7", CONTROL}}, closed);
+    EXPECT_FALSE(closed);
+    EXPECT_EQ(labels, (std::vector<std::string>{"C4", "S6", "C7"}));
+    EXPECT_EQ(droppedFrames(), 3u);
+}
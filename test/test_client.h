@@ -0,0 +1,143 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "network/message_codec.h"
+#include "sanguosha.pb.h"
+
+// 阻塞式的测试客户端，用于对真实的Server做端到端测试
+class TestClient {
+public:
+    // receiveBufferBytes>0时在连接前缩小接收缓冲区，用来模拟读得慢的客户端
+    explicit TestClient(unsigned short port, int receiveBufferBytes = 0) {
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        // 服务器线程可能还没开始监听
+        for (int attempt = 0; attempt < 100; ++attempt) {
+            fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (receiveBufferBytes > 0) {
+                ::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &receiveBufferBytes, sizeof(receiveBufferBytes));
+            }
+            if (::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+                return;
+            }
+            ::close(fd_);
+            fd_ = -1;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        throw std::runtime_error("cannot connect to test server");
+    }
+    ~TestClient() {
+        disconnect();
+    }
+
+    TestClient(const TestClient&) = delete;
+    TestClient& operator=(const TestClient&) = delete;
+
+    void disconnect() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    void send(const sanguosha::GameMessage& msg) {
+        auto frame = Sanguosha::Network::MessageCodec::encode(msg);
+        ASSERT_EQ(::send(fd_, frame.data(), frame.size(), MSG_NOSIGNAL), static_cast<ssize_t>(frame.size()));
+    }
+
+    // 读下一条消息，超时或连接断开返回false
+    bool receive(sanguosha::GameMessage& msg, int timeoutMs = 5000) {
+        char header[4];
+        if (!readExactly(header, sizeof(header), timeoutMs)) {
+            return false;
+        }
+        uint32_t size;
+        std::memcpy(&size, header, sizeof(size));
+        std::vector<char> body(ntohl(size));
+        return readExactly(body.data(), body.size(), timeoutMs) && msg.ParseFromArray(body.data(), body.size());
+    }
+
+    // 跳过其他消息，直到收到指定类型
+    bool waitFor(sanguosha::MessageType type, sanguosha::GameMessage& msg, int timeoutMs = 5000) {
+        for (int i = 0; i < 100; ++i) {
+            if (!receive(msg, timeoutMs)) {
+                return false;
+            }
+            if (msg.type() == type) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // 对端是否已经关闭连接（读到EOF）；期间收到的消息丢弃
+    bool closedByPeer(int timeoutMs = 5000) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+        char buffer[4096];
+        while (std::chrono::steady_clock::now() < deadline) {
+            pollfd pfd{fd_, POLLIN, 0};
+            if (::poll(&pfd, 1, 50) <= 0) {
+                continue;
+            }
+            ssize_t n = ::recv(fd_, buffer, sizeof(buffer), 0);
+            if (n <= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    sanguosha::LoginResponse login(const std::string& username, const std::string& resumeToken = "") {
+        sanguosha::GameMessage msg;
+        msg.set_type(sanguosha::LOGIN_REQUEST);
+        msg.mutable_login_request()->set_username(username);
+        msg.mutable_login_request()->set_resume_token(resumeToken);
+        send(msg);
+        sanguosha::GameMessage reply;
+        EXPECT_TRUE(waitFor(sanguosha::LOGIN_RESPONSE, reply));
+        return reply.login_response();
+    }
+
+    sanguosha::RoomResponse room(sanguosha::RoomAction action, uint32_t roomId, uint32_t maxPlayers = 0) {
+        sanguosha::GameMessage msg;
+        msg.set_type(sanguosha::ROOM_REQUEST);
+        msg.mutable_room_request()->set_action(action);
+        msg.mutable_room_request()->set_room_id(roomId);
+        msg.mutable_room_request()->set_max_players(maxPlayers);
+        send(msg);
+        sanguosha::GameMessage reply;
+        EXPECT_TRUE(waitFor(sanguosha::ROOM_RESPONSE, reply));
+        return reply.room_response();
+    }
+
+private:
+    bool readExactly(char* out, size_t size, int timeoutMs) {
+        while (size > 0) {
+            pollfd pfd{fd_, POLLIN, 0};
+            if (::poll(&pfd, 1, timeoutMs) <= 0) {
+                return false;
+            }
+            ssize_t n = ::recv(fd_, out, size, 0);
+            if (n <= 0) {
+                return false;
+            }
+            out += n;
+            size -= static_cast<size_t>(n);
+        }
+        return true;
+    }
+
+    int fd_ = -1;
+};
@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+#include <boost/asio.hpp>
+#include "common/timer_wheel.h"
+
+using Sanguosha::Common::TimerWheel;
+
+class TimerWheelTest : public ::testing::Test {
+protected:
+    boost::asio::io_context io;
+    TimerWheel wheel{io, std::chrono::milliseconds(10), 8};
+};
+
+TEST_F(TimerWheelTest, FiresAfterDeadline) {
+    bool fired = false;
+    auto start = std::chrono::steady_clock::now();
+    wheel.schedule(std::chrono::milliseconds(50), [&]() { fired = true; });
+    EXPECT_EQ(wheel.pending(), 1u);
+
+    io.run_for(std::chrono::milliseconds(200));
+    EXPECT_TRUE(fired);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+    EXPECT_EQ(wheel.pending(), 0u);
+}
+
+TEST_F(TimerWheelTest, CancelledTimerDoesNotFire) {
+    bool fired = false;
+    auto id = wheel.schedule(std::chrono::milliseconds(30), [&]() { fired = true; });
+    EXPECT_TRUE(wheel.cancel(id));
+    EXPECT_FALSE(wheel.cancel(id)); // 重复取消
+
+    io.run_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(fired);
+}
+
+TEST_F(TimerWheelTest, DelayLongerThanOneRevolution) {
+    // 8个槽 * 10ms = 80ms一圈，150ms需要转两圈
+    int order = 0;
+    int shortAt = 0, longAt = 0;
+    wheel.schedule(std::chrono::milliseconds(150), [&]() { longAt = ++order; });
+    wheel.schedule(std::chrono::milliseconds(20), [&]() { shortAt = ++order; });
+
+    io.run_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(shortAt, 1);
+    EXPECT_EQ(longAt, 0);
+
+    io.restart();
+    io.run_for(std::chrono::milliseconds(150));
+    EXPECT_EQ(longAt, 2);
+}
+
+TEST_F(TimerWheelTest, CallbackCanReschedule) {
+    int count = 0;
+    std::function<void()> tick = [&]() {
+        if (++count < 3) {
+            wheel.schedule(std::chrono::milliseconds(10), tick);
+        }
+    };
+    wheel.schedule(std::chrono::milliseconds(10), tick);
+
+    io.run_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(count, 3);
+}
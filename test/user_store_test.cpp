@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "common/user_store.h"
+
+using Sanguosha::Common::UserStore;
+
+class UserStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path = ::testing::TempDir() + "user_store_test_" + std::to_string(::getpid()) + ".db";
+        std::remove(path.c_str());
+    }
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+    std::string path;
+};
+
+TEST_F(UserStoreTest, SameNameSameId) {
+    UserStore store(path, 16);
+    auto alice = store.findOrCreate("alice");
+    auto bob = store.findOrCreate("bob");
+    EXPECT_GE(alice, UserStore::FIRST_USER_ID);
+    EXPECT_NE(alice, bob);
+    EXPECT_EQ(store.findOrCreate("alice"), alice);
+    EXPECT_EQ(store.find("bob"), bob);
+    EXPECT_EQ(store.find("carol"), UserStore::INVALID_USER);
+    EXPECT_EQ(store.size(), 2u);
+}
+
+TEST_F(UserStoreTest, RejectsInvalidNames) {
+    UserStore store(path, 16);
+    EXPECT_EQ(store.findOrCreate(""), UserStore::INVALID_USER);
+    EXPECT_EQ(store.findOrCreate(std::string(UserStore::MAX_USERNAME_LENGTH + 1, 'x')), UserStore::INVALID_USER);
+    EXPECT_NE(store.findOrCreate(std::string(UserStore::MAX_USERNAME_LENGTH, 'x')), UserStore::INVALID_USER);
+}
+
+TEST_F(UserStoreTest, GrowsAndPersistsAcrossReopen) {
+    std::vector<UserStore::UserId> ids;
+    {
+        UserStore store(path, 16);
+        for (int i = 0; i < 5000; ++i) {
+            ids.push_back(store.findOrCreate("user" + std::to_string(i)));
+        }
+        EXPECT_GT(store.capacity(), 5000u);
+    }
+
+    UserStore reopened(path, 16);
+    EXPECT_EQ(reopened.size(), 5000u);
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_EQ(reopened.find("user" + std::to_string(i)), ids[i]);
+    }
+    // 计数器持久化，重启后新ID不会与旧ID重复
+    auto guest = reopened.allocateId();
+    EXPECT_EQ(std::set<UserStore::UserId>(ids.begin(), ids.end()).count(guest), 0u);
+}
+
+TEST_F(UserStoreTest, ConcurrentLoginsGetUniqueIds) {
+    UserStore store(path, 16);
+    constexpr int kThreads = 8;
+    constexpr int kUsers = 2000;
+    std::vector<std::vector<UserStore::UserId>> results(kThreads);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            // 所有线程注册同一批用户名，外加各自的游客ID
+            for (int i = 0; i < kUsers; ++i) {
+                results[t].push_back(store.findOrCreate("player" + std::to_string(i)));
+            }
+            results[t].push_back(store.allocateId());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<UserStore::UserId> unique;
+    for (int t = 0; t < kThreads; ++t) {
+        for (int i = 0; i < kUsers; ++i) {
+            EXPECT_EQ(results[t][i], results[0][i]);
+        }
+        unique.insert(results[t].begin(), results[t].end());
+    }
+    EXPECT_EQ(unique.size(), static_cast<size_t>(kUsers + kThreads));
+    EXPECT_EQ(store.size(), static_cast<uint64_t>(kUsers));
+}
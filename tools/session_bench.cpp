@@ -0,0 +1,296 @@
+// Session压测客户端：多连接并发，每个连接登录后保持固定深度的流水线请求，
+// 统计吞吐和往返延迟。用于比较不同构建和运行参数（如忙轮询、绑核）在同一负载下的表现。
+//
+// 典型用法（服务器需放宽对应消息的限流，否则测到的是令牌桶）：
+//   sanguosha_server --rate-limit.ROOM_LIST_REQUEST=1000000/1000000
+//   session_bench --connections=64 --depth=16 --seconds=10
+#include "network/message_codec.h"
+#include "sanguosha.pb.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using Sanguosha::Network::MessageCodec;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    std::string host = "127.0.0.1";
+    unsigned short port = 9527;
+    uint32_t connections = 16;
+    uint32_t depth = 8;     // 每个连接同时在途的请求数
+    uint32_t seconds = 10;
+};
+
+// 延迟直方图：按微秒的log2分桶，与服务器端MessageStats一致
+struct LatencyHistogram {
+    static constexpr size_t BUCKETS = 24;
+    uint64_t buckets[BUCKETS] = {};
+    uint64_t count = 0;
+
+    void record(uint64_t micros) {
+        size_t bucket = 0;
+        while (bucket + 1 < BUCKETS && (1ull << bucket) <= micros) {
+            ++bucket;
+        }
+        ++buckets[bucket];
+        ++count;
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            buckets[i] += other.buckets[i];
+        }
+        count += other.count;
+    }
+
+    // 返回所在桶的上界（微秒）
+    uint64_t percentile(double p) const {
+        uint64_t target = static_cast<uint64_t>(count * p);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < BUCKETS; ++i) {
+            seen += buckets[i];
+            if (seen > target) {
+                return 1ull << i;
+            }
+        }
+        return 1ull << (BUCKETS - 1);
+    }
+};
+
+struct WorkerResult {
+    uint64_t responses = 0;
+    uint64_t bytesIn = 0;
+    LatencyHistogram latency;
+    std::string error;
+};
+
+class BenchConnection {
+public:
+    BenchConnection(const Options& options, uint32_t index) : options_(options) {
+        fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (fd_ < 0) {
+            throw std::runtime_error("socket failed");
+        }
+        int one = 1;
+        ::setsockopt(fd_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(options.port);
+        if (::inet_pton(AF_INET, options.host.c_str(), &addr.sin_addr) != 1 ||
+            ::connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            throw std::runtime_error("connect to " + options.host + " failed");
+        }
+        username_ = "bench_" + std::to_string(::getpid()) + "_" + std::to_string(index);
+    }
+
+    ~BenchConnection() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    void login() {
+        sanguosha::GameMessage msg;
+        msg.set_type(sanguosha::LOGIN_REQUEST);
+        msg.mutable_login_request()->set_username(username_);
+        send(msg);
+        sanguosha::GameMessage reply;
+        do {
+            receive(reply);
+        } while (reply.type() != sanguosha::LOGIN_RESPONSE);
+        if (!reply.login_response().success()) {
+            throw std::runtime_error("login rejected: " + reply.login_response().error_message());
+        }
+    }
+
+    void run(Clock::time_point deadline, WorkerResult& result) {
+        std::vector<Clock::time_point> sentAt(options_.depth);
+        uint32_t nextId = 1;
+        for (uint32_t i = 0; i < options_.depth; ++i) {
+            sentAt[nextId % options_.depth] = Clock::now();
+            sendRequest(nextId++);
+        }
+
+        sanguosha::GameMessage reply;
+        while (Clock::now() < deadline) {
+            result.bytesIn += receive(reply);
+            if (reply.type() != sanguosha::ROOM_LIST_RESPONSE || reply.request_id() == 0) {
+                continue; // 服务器心跳等推送
+            }
+            auto now = Clock::now();
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                now - sentAt[reply.request_id() % options_.depth]);
+            result.latency.record(static_cast<uint64_t>(elapsed.count()));
+            ++result.responses;
+
+            // 每收到一个响应补发一个请求，在途数量保持为depth
+            sentAt[nextId % options_.depth] = now;
+            sendRequest(nextId++);
+        }
+    }
+
+private:
+    void sendRequest(uint32_t requestId) {
+        sanguosha::GameMessage msg;
+        msg.set_type(sanguosha::ROOM_LIST_REQUEST);
+        msg.set_request_id(requestId);
+        send(msg);
+    }
+
+    void send(const sanguosha::GameMessage& msg) {
+        frame_.resize(MessageCodec::frameSize(msg));
+        MessageCodec::encodeInto(msg, frame_.data(), frame_.size());
+        size_t sent = 0;
+        while (sent < frame_.size()) {
+            ssize_t n = ::send(fd_, frame_.data() + sent, frame_.size() - sent, MSG_NOSIGNAL);
+            if (n <= 0) {
+                throw std::runtime_error("send failed");
+            }
+            sent += static_cast<size_t>(n);
+        }
+    }
+
+    // 读一整帧并解码，返回帧的字节数
+    size_t receive(sanguosha::GameMessage& msg) {
+        char header[MessageCodec::HEADER_LENGTH];
+        readExactly(header, sizeof(header));
+        uint32_t size = MessageCodec::readHeader(header);
+        body_.resize(size);
+        readExactly(body_.data(), size);
+        if (MessageCodec::isCompact(body_.data(), size) ||
+            !MessageCodec::decode(body_.data(), size, msg)) {
+            throw std::runtime_error("malformed frame from server");
+        }
+        return sizeof(header) + size;
+    }
+
+    void readExactly(char* out, size_t size) {
+        while (size > 0) {
+            ssize_t n = ::recv(fd_, out, size, 0);
+            if (n <= 0) {
+                throw std::runtime_error("connection closed by server");
+            }
+            out += n;
+            size -= static_cast<size_t>(n);
+        }
+    }
+
+    const Options& options_;
+    int fd_ = -1;
+    std::string username_;
+    std::vector<char> frame_;
+    std::vector<char> body_;
+};
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto eq = arg.find('=');
+        if (arg.rfind("--", 0) != 0 || eq == std::string::npos) {
+            throw std::invalid_argument("expected --key=value, got: " + arg);
+        }
+        std::string key = arg.substr(2, eq - 2);
+        std::string value = arg.substr(eq + 1);
+        if (key == "host") {
+            options.host = value;
+        } else if (key == "port") {
+            options.port = static_cast<unsigned short>(std::stoul(value));
+        } else if (key == "connections") {
+            options.connections = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "depth") {
+            options.depth = static_cast<uint32_t>(std::stoul(value));
+        } else if (key == "seconds") {
+            options.seconds = static_cast<uint32_t>(std::stoul(value));
+        } else {
+            throw std::invalid_argument("unknown option: --" + key);
+        }
+    }
+    if (options.connections == 0 || options.depth == 0 || options.seconds == 0) {
+        throw std::invalid_argument("connections, depth and seconds must be positive");
+    }
+    return options;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 2;
+    }
+
+    std::vector<WorkerResult> results(options.connections);
+    std::vector<std::thread> workers;
+    std::atomic<uint32_t> ready{0};
+    std::atomic<bool> go{false};
+    Clock::time_point deadline;
+
+    for (uint32_t i = 0; i < options.connections; ++i) {
+        workers.emplace_back([&, i] {
+            try {
+                BenchConnection connection(options, i);
+                connection.login();
+                ++ready;
+                while (!go.load()) {
+                    std::this_thread::yield();
+                }
+                connection.run(deadline, results[i]);
+            } catch (const std::exception& e) {
+                results[i].error = e.what();
+                ++ready;
+            }
+        });
+    }
+    // 所有连接登录完成后同时开始计时，登录限流不计入结果
+    while (ready.load() < options.connections) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    auto begin = Clock::now();
+    deadline = begin + std::chrono::seconds(options.seconds);
+    go = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    WorkerResult total;
+    uint32_t failed = 0;
+    for (const auto& result : results) {
+        if (!result.error.empty()) {
+            if (failed++ == 0) {
+                std::cerr << "connection error: " << result.error << std::endl;
+            }
+            continue;
+        }
+        total.responses += result.responses;
+        total.bytesIn += result.bytesIn;
+        total.latency.merge(result.latency);
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "connections=" << options.connections << " depth=" << options.depth
+              << " failed=" << failed << "\n"
+              << "responses=" << total.responses << " (" << total.responses / elapsed << "/s, "
+              << total.bytesIn / elapsed / (1024 * 1024) << " MiB/s in)\n"
+              << "latency p50<=" << total.latency.percentile(0.50) << "us"
+              << " p99<=" << total.latency.percentile(0.99) << "us"
+              << " p999<=" << total.latency.percentile(0.999) << "us" << std::endl;
+    return failed == options.connections ? 1 : 0;
+}